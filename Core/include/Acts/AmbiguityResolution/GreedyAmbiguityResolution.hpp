@@ -15,8 +15,8 @@
 #include "Acts/Utilities/Logger.hpp"
 
 #include <memory>
+#include <vector>
 
-#include <boost/container/flat_map.hpp>
 #include <boost/container/flat_set.hpp>
 
 namespace Acts {
@@ -34,6 +34,11 @@ namespace Acts {
 ///  3) Else, remove the track with the highest relative shared hits (i.e.
 ///     shared hits / hits).
 ///  4) Back to square 1.
+///
+/// The tracks are kept in an indexed max-heap ordered by the relative shared
+/// hits and the chi2. Removing a track only updates the shared hits of the
+/// tracks it shared measurements with, such that each iteration is
+/// logarithmic in the number of tracks.
 class GreedyAmbiguityResolution {
  public:
   struct Config {
@@ -53,13 +58,10 @@ class GreedyAmbiguityResolution {
     std::vector<float> trackChi2;
     std::vector<std::vector<std::size_t>> measurementsPerTrack;
 
-    // TODO consider boost 1.81 unordered_flat_map
-    boost::container::flat_map<std::size_t,
-                               boost::container::flat_set<std::size_t>>
-        tracksPerMeasurement;
+    // Tracks per measurement index, measurement indices are consecutive
+    std::vector<std::vector<std::size_t>> tracksPerMeasurement;
     std::vector<std::size_t> sharedMeasurementsPerTrack;
 
-    // TODO consider boost 1.81 unordered_flat_map
     boost::container::flat_set<std::size_t> selectedTracks;
   };
 
@@ -53,10 +53,15 @@ void GreedyAmbiguityResolution::computeInitialState(
     ++state.numberOfTracks;
   }
 
-  // Now we relate measurements to tracks
+  // Now we relate measurements to tracks, a track is listed once per
+  // measurement
+  state.tracksPerMeasurement.resize(measurementIndexMap.size());
   for (std::size_t iTrack = 0; iTrack < state.numberOfTracks; ++iTrack) {
     for (auto iMeasurement : state.measurementsPerTrack[iTrack]) {
-      state.tracksPerMeasurement[iMeasurement].insert(iTrack);
+      auto& tracks = state.tracksPerMeasurement[iMeasurement];
+      if (tracks.empty() || tracks.back() != iTrack) {
+        tracks.push_back(iTrack);
+      }
     }
   }
 
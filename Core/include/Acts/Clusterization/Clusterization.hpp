@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include "Acts/Utilities/ParallelFor.hpp"
+
 #include <memory>
 #include <vector>
 
@@ -72,6 +74,26 @@ template <typename CellCollection, std::size_t GridDim = 2,
               DefaultConnect<typename CellCollection::value_type, GridDim>>
 void labelClusters(CellCollection& cells, Connect connect = Connect());
 
+/// @brief labelSortedClusters
+///
+/// Single-pass connected component labelling for cells which are already
+/// sorted column-wise, i.e. by column and then by row, as done by
+/// `labelClusters`. Cells of a column with consecutive rows form a run, and
+/// each run is connected to the overlapping runs of the previous column.
+/// Instead of a separate disjoint set, the cell labels themselves hold the
+/// union-find links while labelling, so no memory is allocated. Cells at
+/// the same position are connected.
+///
+/// The connectivity is the one of `DefaultConnect`. After labelling, the
+/// label of each cell is the position of the first cell of its cluster in
+/// the collection plus one.
+///
+/// @param [in] cells the column-wise sorted cell collection to be labeled
+/// @param [in] commonCorner use 8-cell instead of 4-cell connectivity on
+///             2-D grids
+template <typename CellCollection, std::size_t GridDim = 2>
+void labelSortedClusters(CellCollection& cells, bool commonCorner = true);
+
 /// @brief mergeClusters
 ///
 /// Merge a set of cells previously labeled (for instance with `labelClusters`)
@@ -93,6 +115,26 @@ template <typename CellCollection, typename ClusterCollection,
 ClusterCollection createClusters(CellCollection& cells,
                                  Connect connect = Connect());
 
+/// @brief createClustersBatch
+///
+/// Runs `createClusters` on independent cell collections, e.g. the modules
+/// of an event. The collections are processed concurrently with the
+/// executor, and a single disjoint set is reused for all collections of a
+/// range processed by one call of the loop body.
+///
+/// @param [in] cellCollections the cell collections, each one is labeled
+/// @param [in] executor executor for the loop over the cell collections,
+///             they are processed sequentially if it is empty
+/// @param [in] connect the connection type (see DefaultConnect)
+/// @return the clusters of each cell collection
+template <typename CellCollection, typename ClusterCollection,
+          std::size_t GridDim = 2,
+          typename Connect =
+              DefaultConnect<typename CellCollection::value_type, GridDim>>
+std::vector<ClusterCollection> createClustersBatch(
+    std::vector<CellCollection>& cellCollections,
+    const ParallelForExecutor& executor, Connect connect = Connect());
+
 }  // namespace Acts::Ccl
 
 #include "Acts/Clusterization/Clusterization.ipp"
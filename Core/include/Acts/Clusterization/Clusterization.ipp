@@ -6,7 +6,10 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <algorithm>
 #include <array>
+#include <cassert>
+#include <cstdlib>
 #include <vector>
 
 #include <boost/pending/disjoint_sets.hpp>
@@ -121,6 +124,9 @@ class DisjointSets {
     return static_cast<Label>(m_globalId++);
   }
 
+  // Forget all sets, but keep the allocated memory
+  void reset() { m_globalId = 1; }
+
   void unionSet(std::size_t x, std::size_t y) { m_ds.union_set(x, y); }
   Label findSet(std::size_t x) { return static_cast<Label>(m_ds.find_set(x)); }
 
@@ -182,6 +188,114 @@ Connections<GridDim> getConnections(typename std::vector<Cell>::iterator it,
   return seen;
 }
 
+// Union-find on the cells of a collection, in which the label of each cell
+// links to its parent cell. Parents always precede their children, so the
+// root of each set is its first cell.
+template <typename CellCollection>
+class CellLabelSets {
+ public:
+  explicit CellLabelSets(CellCollection& cells) : m_cells(cells) {}
+
+  void makeSet(std::size_t i) { link(i, i); }
+  void link(std::size_t i, std::size_t parent) {
+    getCellLabel(m_cells[i]) = static_cast<Label>(parent + 1);
+  }
+  std::size_t parent(std::size_t i) const {
+    return static_cast<std::size_t>(getCellLabel(m_cells[i]) - 1);
+  }
+
+  std::size_t findSet(std::size_t i) {
+    // Path halving
+    while (parent(i) != i) {
+      std::size_t grandParent = parent(parent(i));
+      link(i, grandParent);
+      i = grandParent;
+    }
+    return i;
+  }
+
+  void unionSet(std::size_t i, std::size_t j) {
+    i = findSet(i);
+    j = findSet(j);
+    if (i != j) {
+      link(std::max(i, j), std::min(i, j));
+    }
+  }
+
+  // Label all cells with their root, which is the parent of their parent
+  // once the preceding cells are done
+  void flatten() {
+    for (std::size_t i = 0; i < m_cells.size(); ++i) {
+      link(i, parent(parent(i)));
+    }
+  }
+
+ private:
+  CellCollection& m_cells;
+};
+
+template <typename CellCollection>
+void labelSortedClusters1D(CellCollection& cells) {
+  // Clusters are runs of consecutive columns
+  std::size_t start = 0;
+  for (std::size_t i = 0; i < cells.size(); ++i) {
+    if (i == 0 || getCellColumn(cells[i]) > getCellColumn(cells[i - 1]) + 1) {
+      start = i;
+    }
+    getCellLabel(cells[i]) = static_cast<Label>(start + 1);
+  }
+}
+
+template <typename CellCollection>
+void labelSortedClusters2D(CellCollection& cells, bool commonCorner) {
+  CellLabelSets<CellCollection> sets(cells);
+  const int reach = commonCorner ? 1 : 0;
+  const std::size_t n = cells.size();
+
+  auto row = [&cells](std::size_t i) { return getCellRow(cells[i]); };
+  auto column = [&cells](std::size_t i) { return getCellColumn(cells[i]); };
+
+  std::size_t i = 0;
+  // First cell of the previous column
+  std::size_t prevColumnBegin = 0;
+  while (i < n) {
+    const std::size_t columnBegin = i;
+    const int col = column(i);
+    // Runs can only connect to the previous column if it is adjacent
+    std::size_t prev = (columnBegin > 0 && column(columnBegin - 1) == col - 1)
+                           ? prevColumnBegin
+                           : columnBegin;
+
+    while (i < n && column(i) == col) {
+      // Collect the run starting at cell i
+      const std::size_t start = i;
+      const int firstRow = row(i);
+      int lastRow = firstRow;
+      sets.makeSet(i);
+      for (++i; i < n && column(i) == col && row(i) <= lastRow + 1; ++i) {
+        sets.link(i, start);
+        lastRow = row(i);
+      }
+
+      // Connect it to the overlapping cells of the previous column
+      while (prev < columnBegin && row(prev) < firstRow - reach) {
+        ++prev;
+      }
+      for (std::size_t j = prev; j < columnBegin && row(j) <= lastRow + reach;
+           ++j) {
+        sets.unionSet(start, j);
+      }
+    }
+    prevColumnBegin = columnBegin;
+  }
+
+  sets.flatten();
+}
+
+template <typename CellCollection, std::size_t GridDim, typename Connect>
+void labelClustersImpl(CellCollection& cells, Connect connect,
+                       DisjointSets& ds);
+
 template <typename CellCollection, typename ClusterCollection>
 ClusterCollection mergeClustersImpl(CellCollection& cells) {
   using Cluster = typename ClusterCollection::value_type;
@@ -266,11 +380,9 @@ void recordEquivalences(const internal::Connections<GridDim> seen,
 }
 
 template <typename CellCollection, std::size_t GridDim, typename Connect>
-void labelClusters(CellCollection& cells, Connect connect) {
+void internal::labelClustersImpl(CellCollection& cells, Connect connect,
+                                 internal::DisjointSets& ds) {
   using Cell = typename CellCollection::value_type;
-  internal::staticCheckCellType<Cell, GridDim>();
-
-  internal::DisjointSets ds{};
 
   // Sort cells by position to enable in-order scan
   std::sort(cells.begin(), cells.end(), internal::Compare<Cell, GridDim>());
@@ -296,6 +408,31 @@ void labelClusters(CellCollection& cells, Connect connect) {
   }
 }
 
+template <typename CellCollection, std::size_t GridDim, typename Connect>
+void labelClusters(CellCollection& cells, Connect connect) {
+  using Cell = typename CellCollection::value_type;
+  internal::staticCheckCellType<Cell, GridDim>();
+
+  internal::DisjointSets ds{};
+  internal::labelClustersImpl<CellCollection, GridDim, Connect>(cells, connect,
+                                                                ds);
+}
+
+template <typename CellCollection, std::size_t GridDim>
+void labelSortedClusters(CellCollection& cells, bool commonCorner) {
+  using Cell = typename CellCollection::value_type;
+  internal::staticCheckGridDim<GridDim>();
+  internal::staticCheckCellType<Cell, GridDim>();
+  assert(std::is_sorted(cells.begin(), cells.end(),
+                        internal::Compare<Cell, GridDim>()));
+
+  if constexpr (GridDim == 1) {
+    internal::labelSortedClusters1D(cells);
+  } else {
+    internal::labelSortedClusters2D(cells, commonCorner);
+  }
+}
+
 template <typename CellCollection, typename ClusterCollection,
           std::size_t GridDim = 2>
 ClusterCollection mergeClusters(CellCollection& cells) {
@@ -327,4 +464,31 @@ ClusterCollection createClusters(CellCollection& cells, Connect connect) {
   return mergeClusters<CellCollection, ClusterCollection, GridDim>(cells);
 }
 
+template <typename CellCollection, typename ClusterCollection,
+          std::size_t GridDim, typename Connect>
+std::vector<ClusterCollection> createClustersBatch(
+    std::vector<CellCollection>& cellCollections,
+    const ParallelForExecutor& executor, Connect connect) {
+  using Cell = typename CellCollection::value_type;
+  using Cluster = typename ClusterCollection::value_type;
+  internal::staticCheckCellType<Cell, GridDim>();
+  internal::staticCheckClusterType<Cluster&, const Cell&>();
+
+  std::vector<ClusterCollection> clusters(cellCollections.size());
+  parallelFor(executor, cellCollections.size(),
+              [&](std::size_t begin, std::size_t end) {
+                internal::DisjointSets ds{};
+                for (std::size_t i = begin; i < end; ++i) {
+                  ds.reset();
+                  internal::labelClustersImpl<CellCollection, GridDim,
+                                              Connect>(cellCollections[i],
+                                                       connect, ds);
+                  clusters[i] =
+                      mergeClusters<CellCollection, ClusterCollection,
+                                    GridDim>(cellCollections[i]);
+                }
+              });
+  return clusters;
+}
+
 }  // namespace Acts::Ccl
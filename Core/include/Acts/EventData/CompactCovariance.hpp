@@ -0,0 +1,179 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+
+namespace Acts {
+
+/// Symmetric matrix stored as its packed lower triangle.
+///
+/// Only the `kSize * (kSize + 1) / 2` independent elements are stored in
+/// row-major order of the lower triangle, optionally with reduced precision.
+/// Packing into single precision reduces a bound covariance from 288 to 84
+/// bytes, which is intended for long-lived track EDM, e.g. as a dynamic
+/// column of a track state or track container. Computations should always be
+/// done on the unpacked double precision matrix.
+///
+/// @tparam kSize Number of rows and columns
+/// @tparam scalar_t Storage type of the elements
+template <unsigned int kSize, typename scalar_t = float>
+class PackedSymmetricMatrix {
+ public:
+  static constexpr std::size_t kPackedSize = kSize * (kSize + 1) / 2;
+
+  using Scalar = scalar_t;
+  using Storage = std::array<Scalar, kPackedSize>;
+  using Matrix = ActsSquareMatrix<kSize>;
+
+  /// Construct with all elements set to zero.
+  PackedSymmetricMatrix() { m_data.fill(Scalar{0}); }
+
+  /// Pack the lower triangle of a matrix.
+  ///
+  /// @param matrix Symmetric matrix, the upper triangle is not read
+  template <typename derived_t>
+  explicit PackedSymmetricMatrix(const Eigen::MatrixBase<derived_t>& matrix) {
+    pack(matrix);
+  }
+
+  /// Pack the lower triangle of a matrix.
+  ///
+  /// @param matrix Symmetric matrix, the upper triangle is not read
+  template <typename derived_t>
+  void pack(const Eigen::MatrixBase<derived_t>& matrix) {
+    static_assert(derived_t::RowsAtCompileTime == kSize &&
+                      derived_t::ColsAtCompileTime == kSize,
+                  "Matrix has the wrong size");
+    std::size_t k = 0;
+    for (unsigned int i = 0; i < kSize; ++i) {
+      for (unsigned int j = 0; j <= i; ++j) {
+        m_data[k++] = static_cast<Scalar>(matrix(i, j));
+      }
+    }
+  }
+
+  /// Unpack into a full matrix, e.g. a track state covariance map.
+  ///
+  /// @param matrix Output matrix, both triangles are written
+  /// @note Takes a const reference so temporary maps and blocks can be
+  ///       passed, as recommended by Eigen for writable expressions
+  template <typename derived_t>
+  void unpack(const Eigen::MatrixBase<derived_t>& matrix) const {
+    static_assert(derived_t::RowsAtCompileTime == kSize &&
+                      derived_t::ColsAtCompileTime == kSize,
+                  "Matrix has the wrong size");
+    auto& output = const_cast<Eigen::MatrixBase<derived_t>&>(matrix);
+    std::size_t k = 0;
+    for (unsigned int i = 0; i < kSize; ++i) {
+      for (unsigned int j = 0; j <= i; ++j) {
+        const auto value =
+            static_cast<typename derived_t::Scalar>(m_data[k++]);
+        output(i, j) = value;
+        output(j, i) = value;
+      }
+    }
+  }
+
+  /// Unpack into a full double precision matrix.
+  Matrix unpack() const {
+    Matrix matrix;
+    unpack(matrix);
+    return matrix;
+  }
+
+  /// Access a single element, the order of the indices is irrelevant.
+  Scalar operator()(unsigned int i, unsigned int j) const {
+    assert(i < kSize && j < kSize && "Index out of range");
+    return (i < j) ? m_data[index(j, i)] : m_data[index(i, j)];
+  }
+
+  /// The packed elements.
+  const Storage& data() const { return m_data; }
+
+ private:
+  static constexpr std::size_t index(unsigned int i, unsigned int j) {
+    return i * (i + 1) / 2 + j;
+  }
+
+  Storage m_data;
+};
+
+/// Full matrix stored with reduced precision.
+///
+/// Transport Jacobians are not symmetric, so only the precision of the
+/// elements is reduced. In single precision, a bound-to-bound Jacobian uses
+/// 144 instead of 288 bytes.
+///
+/// @tparam kRows Number of rows
+/// @tparam kCols Number of columns
+/// @tparam scalar_t Storage type of the elements
+template <unsigned int kRows, unsigned int kCols, typename scalar_t = float>
+class PackedMatrix {
+ public:
+  using Scalar = scalar_t;
+  using Storage = Eigen::Matrix<Scalar, kRows, kCols>;
+  using Matrix = ActsMatrix<kRows, kCols>;
+
+  /// Construct with all elements set to zero.
+  PackedMatrix() : m_data{Storage::Zero()} {}
+
+  /// Pack a matrix.
+  ///
+  /// @param matrix Input matrix
+  template <typename derived_t>
+  explicit PackedMatrix(const Eigen::MatrixBase<derived_t>& matrix) {
+    pack(matrix);
+  }
+
+  /// Pack a matrix.
+  ///
+  /// @param matrix Input matrix
+  template <typename derived_t>
+  void pack(const Eigen::MatrixBase<derived_t>& matrix) {
+    m_data = matrix.template cast<Scalar>();
+  }
+
+  /// Unpack into a full matrix, e.g. a track state Jacobian map.
+  ///
+  /// @param matrix Output matrix
+  /// @note Takes a const reference so temporary maps and blocks can be
+  ///       passed, as recommended by Eigen for writable expressions
+  template <typename derived_t>
+  void unpack(const Eigen::MatrixBase<derived_t>& matrix) const {
+    const_cast<Eigen::MatrixBase<derived_t>&>(matrix) =
+        m_data.template cast<typename derived_t::Scalar>();
+  }
+
+  /// Unpack into a full double precision matrix.
+  Matrix unpack() const { return m_data.template cast<ActsScalar>(); }
+
+  /// Access a single element.
+  Scalar operator()(unsigned int i, unsigned int j) const {
+    return m_data(i, j);
+  }
+
+  /// The packed elements.
+  const Storage& data() const { return m_data; }
+
+ private:
+  Storage m_data;
+};
+
+/// Bound covariance packed into single precision.
+using CompactBoundSymMatrix = PackedSymmetricMatrix<eBoundSize, float>;
+/// Bound-to-bound Jacobian with single precision elements.
+using CompactBoundMatrix = PackedMatrix<eBoundSize, eBoundSize, float>;
+
+}  // namespace Acts
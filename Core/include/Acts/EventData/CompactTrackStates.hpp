@@ -0,0 +1,215 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/CompactCovariance.hpp"
+#include "Acts/EventData/TrackStatePropMask.hpp"
+#include "Acts/Utilities/HashedString.hpp"
+#include "Acts/Utilities/Helpers.hpp"
+
+#include <stdexcept>
+#include <string_view>
+
+namespace Acts {
+
+class VectorMultiTrajectory;
+
+/// Bound parameters in double precision with a packed single precision
+/// covariance, the compact form of a track state parameter component.
+struct CompactBoundParameters {
+  BoundVector parameters = BoundVector::Zero();
+  CompactBoundSymMatrix covariance;
+};
+
+/// Keys of the dynamic columns holding the packed track state components.
+namespace CompactTrackStateColumns {
+/// Components of a track state which are stored packed
+inline constexpr std::string_view mask = "compactMask";
+/// @c CompactBoundParameters of the predicted component
+inline constexpr std::string_view predicted = "compactPredicted";
+/// @c CompactBoundParameters of the filtered component
+inline constexpr std::string_view filtered = "compactFiltered";
+/// @c CompactBoundParameters of the smoothed component
+inline constexpr std::string_view smoothed = "compactSmoothed";
+/// @c CompactBoundMatrix of the Jacobian
+inline constexpr std::string_view jacobian = "compactJacobian";
+}  // namespace CompactTrackStateColumns
+
+/// Add the dynamic columns used by @c packTrackState for the given
+/// components to a track state container if they do not exist yet.
+///
+/// Only the columns of the requested components are added, so a container
+/// never stores compact components it does not use.
+/// @tparam trajectory_t The track state container backend
+/// @param trajectory The track state container
+/// @param mask The components to add columns for
+template <typename trajectory_t>
+void addCompactTrackStateColumns(
+    trajectory_t& trajectory,
+    TrackStatePropMask mask = TrackStatePropMask::Predicted |
+                              TrackStatePropMask::Filtered |
+                              TrackStatePropMask::Smoothed |
+                              TrackStatePropMask::Jacobian) {
+  using PM = TrackStatePropMask;
+  namespace Columns = CompactTrackStateColumns;
+  auto add = [&](auto type, std::string_view key) {
+    if (!trajectory.hasColumn(hashString(key))) {
+      trajectory.template addColumn<decltype(type)>(std::string{key});
+    }
+  };
+  add(PM{}, Columns::mask);
+  if (ACTS_CHECK_BIT(mask, PM::Predicted)) {
+    add(CompactBoundParameters{}, Columns::predicted);
+  }
+  if (ACTS_CHECK_BIT(mask, PM::Filtered)) {
+    add(CompactBoundParameters{}, Columns::filtered);
+  }
+  if (ACTS_CHECK_BIT(mask, PM::Smoothed)) {
+    add(CompactBoundParameters{}, Columns::smoothed);
+  }
+  if (ACTS_CHECK_BIT(mask, PM::Jacobian)) {
+    add(CompactBoundMatrix{}, Columns::jacobian);
+  }
+}
+
+/// Pack the covariances and the Jacobian of a track state into the compact
+/// columns and unset the double precision components.
+///
+/// The parameters are kept in double precision next to the packed
+/// covariance. This only unsets the components, releasing their storage is
+/// up to the backend, see @c packTrackStates.
+/// @note The columns of the packed components need to be added with
+///       @c addCompactTrackStateColumns
+/// @tparam track_state_proxy_t The mutable track state proxy type
+/// @param trackState The track state to pack
+/// @param mask The components to pack, others are left untouched
+template <typename track_state_proxy_t>
+void packTrackState(track_state_proxy_t trackState,
+                    TrackStatePropMask mask = TrackStatePropMask::Predicted |
+                                              TrackStatePropMask::Filtered |
+                                              TrackStatePropMask::Smoothed |
+                                              TrackStatePropMask::Jacobian) {
+  using PM = TrackStatePropMask;
+  namespace Columns = CompactTrackStateColumns;
+
+  auto& packed =
+      trackState.template component<PM, hashString(Columns::mask)>();
+
+  auto pack = [&](PM component, auto& compact, auto parameters,
+                  auto covariance) {
+    compact.parameters = parameters;
+    compact.covariance.pack(covariance);
+    trackState.unset(component);
+    packed |= component;
+  };
+
+  if (ACTS_CHECK_BIT(mask, PM::Predicted) && trackState.hasPredicted()) {
+    pack(PM::Predicted,
+         trackState.template component<CompactBoundParameters,
+                                       hashString(Columns::predicted)>(),
+         trackState.predicted(), trackState.predictedCovariance());
+  }
+  if (ACTS_CHECK_BIT(mask, PM::Filtered) && trackState.hasFiltered()) {
+    pack(PM::Filtered,
+         trackState.template component<CompactBoundParameters,
+                                       hashString(Columns::filtered)>(),
+         trackState.filtered(), trackState.filteredCovariance());
+  }
+  if (ACTS_CHECK_BIT(mask, PM::Smoothed) && trackState.hasSmoothed()) {
+    pack(PM::Smoothed,
+         trackState.template component<CompactBoundParameters,
+                                       hashString(Columns::smoothed)>(),
+         trackState.smoothed(), trackState.smoothedCovariance());
+  }
+  if (ACTS_CHECK_BIT(mask, PM::Jacobian) && trackState.hasJacobian()) {
+    trackState
+        .template component<CompactBoundMatrix,
+                            hashString(Columns::jacobian)>()
+        .pack(trackState.jacobian());
+    trackState.unset(PM::Jacobian);
+    packed |= PM::Jacobian;
+  }
+}
+
+/// Components of a track state which were packed with @c packTrackState.
+/// @tparam track_state_proxy_t The track state proxy type
+/// @param trackState The track state
+/// @return the packed components, none if the container was never packed
+template <typename track_state_proxy_t>
+TrackStatePropMask packedComponents(const track_state_proxy_t& trackState) {
+  constexpr HashedString key = hashString(CompactTrackStateColumns::mask);
+  if (!trackState.template has<key>()) {
+    return TrackStatePropMask::None;
+  }
+  return trackState.template component<TrackStatePropMask, key>();
+}
+
+/// Packed parameters of a track state component.
+///
+/// The double precision covariance is restored with
+/// @c CompactBoundSymMatrix::unpack, e.g. into a component of another
+/// track state.
+/// @tparam track_state_proxy_t The track state proxy type
+/// @param trackState The track state
+/// @param component One of the predicted, filtered or smoothed components
+/// @return the parameters and the packed covariance
+template <typename track_state_proxy_t>
+const CompactBoundParameters& packedParameters(
+    const track_state_proxy_t& trackState, TrackStatePropMask component) {
+  using PM = TrackStatePropMask;
+  namespace Columns = CompactTrackStateColumns;
+
+  if (!ACTS_CHECK_BIT(packedComponents(trackState), component)) {
+    throw std::invalid_argument("Track state component is not packed");
+  }
+  std::string_view key = Columns::smoothed;
+  if (component == PM::Predicted) {
+    key = Columns::predicted;
+  } else if (component == PM::Filtered) {
+    key = Columns::filtered;
+  } else if (component != PM::Smoothed) {
+    throw std::invalid_argument("Track state component has no parameters");
+  }
+  return trackState.template component<CompactBoundParameters>(
+      hashString(key));
+}
+
+/// Packed Jacobian of a track state.
+/// @tparam track_state_proxy_t The track state proxy type
+/// @param trackState The track state
+/// @return the single precision Jacobian
+template <typename track_state_proxy_t>
+const CompactBoundMatrix& packedJacobian(
+    const track_state_proxy_t& trackState) {
+  if (!ACTS_CHECK_BIT(packedComponents(trackState),
+                      TrackStatePropMask::Jacobian)) {
+    throw std::invalid_argument("Track state Jacobian is not packed");
+  }
+  return trackState
+      .template component<CompactBoundMatrix,
+                          hashString(CompactTrackStateColumns::jacobian)>();
+}
+
+/// Pack all track states of a finished trajectory and release the storage of
+/// the double precision components.
+///
+/// Columns are only added for the components present in the trajectory. A
+/// fully fitted track state shrinks from 1296 to about 540 bytes of
+/// parameter, covariance and Jacobian storage. Use @c packedParameters and
+/// @c packedJacobian to read the components.
+/// @param trajectory The track state container
+/// @param mask The components to pack
+void packTrackStates(VectorMultiTrajectory& trajectory,
+                     TrackStatePropMask mask = TrackStatePropMask::Predicted |
+                                               TrackStatePropMask::Filtered |
+                                               TrackStatePropMask::Smoothed |
+                                               TrackStatePropMask::Jacobian);
+
+}  // namespace Acts
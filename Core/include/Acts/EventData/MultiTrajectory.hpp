@@ -387,7 +387,11 @@ class TrackStateProxy {
     typeFlags() = other.typeFlags();
 
     if (other.hasReferenceSurface()) {
-      setReferenceSurface(other.referenceSurface().getSharedPtr());
+      if (other.ownsReferenceSurface()) {
+        setReferenceSurface(other.referenceSurface().getSharedPtr());
+      } else {
+        setReferenceSurfaceUnowned(&other.referenceSurface());
+      }
     }
   }
 
@@ -398,6 +402,14 @@ class TrackStateProxy {
     m_traj->self().unset(target, m_istate);
   }
 
+  /// Add additional components to the track state
+  /// @param mask The components to add, already allocated ones are kept
+  /// @note The calibrated measurement is allocated with @c allocateCalibrated
+  template <bool RO = ReadOnly, typename = std::enable_if_t<!RO>>
+  void addComponents(TrackStatePropMask mask) {
+    m_traj->self().addTrackStateComponents(m_istate, mask);
+  }
+
   /// Reference surface.
   /// @return the reference surface
   const Surface& referenceSurface() const {
@@ -424,6 +436,23 @@ class TrackStateProxy {
   }
   // NOLINTEND(performance-unnecessary-value-param)
 
+  /// Set the reference surface without taking ownership
+  /// @param srf The surface to set, can be null
+  /// @note The surface has to outlive the container, e.g. a surface of the
+  ///       tracking geometry. Backends without non-owning storage share the
+  ///       ownership instead.
+  /// @note This overload is only present in case @c ReadOnly is false.
+  template <bool RO = ReadOnly, typename = std::enable_if_t<!RO>>
+  void setReferenceSurfaceUnowned(const Surface* srf) {
+    m_traj->setReferenceSurfaceUnowned(m_istate, srf);
+  }
+
+  /// Returns if the reference surface is kept alive by the container
+  /// @return whether the container shares the ownership of the surface
+  bool ownsReferenceSurface() const {
+    return m_traj->ownsReferenceSurface(m_istate);
+  }
+
   /// Check if a component is set
   /// @tparam key Hashed string key to check for
   /// @return true if the component exists, false if not
@@ -1041,6 +1070,17 @@ class TrackStateRange {
 };
 
 // implement track state visitor concept
+// optional backend support for reference surfaces without ownership
+template <typename T>
+using set_reference_surface_unowned_t =
+    decltype(std::declval<T&>().setReferenceSurfaceUnowned_impl(
+        std::declval<std::size_t>(), std::declval<const Surface*>()));
+
+template <typename T>
+using owns_reference_surface_t =
+    decltype(std::declval<const T&>().ownsReferenceSurface_impl(
+        std::declval<std::size_t>()));
+
 template <typename T, typename TS>
 using call_operator_t = decltype(std::declval<T>()(std::declval<TS>()));
 
@@ -1433,6 +1473,15 @@ class MultiTrajectory {
     self().unset_impl(target, istate);
   }
 
+  /// Add additional components to an existing track state
+  /// @param istate The track state index to operate on
+  /// @param mask The components to add, already allocated ones are kept
+  template <bool RO = ReadOnly, typename = std::enable_if_t<!RO>>
+  constexpr void addTrackStateComponents(IndexType istate,
+                                         TrackStatePropMask mask) {
+    self().addTrackStateComponents_impl(istate, mask);
+  }
+
   /// Retrieve a mutable reference to a component
   /// @tparam T The type of the component to access
   /// @tparam key String key for the component to access
@@ -1509,6 +1558,26 @@ class MultiTrajectory {
     self().setReferenceSurface_impl(istate, std::move(surface));
   }
 
+  template <bool RO = ReadOnly, typename = std::enable_if_t<!RO>>
+  void setReferenceSurfaceUnowned(IndexType istate, const Surface* surface) {
+    if constexpr (Concepts::exists<detail_lt::set_reference_surface_unowned_t,
+                                   Derived>) {
+      self().setReferenceSurfaceUnowned_impl(istate, surface);
+    } else {
+      self().setReferenceSurface_impl(
+          istate, surface != nullptr ? surface->getSharedPtr() : nullptr);
+    }
+  }
+
+  bool ownsReferenceSurface(IndexType istate) const {
+    if constexpr (Concepts::exists<detail_lt::owns_reference_surface_t,
+                                   Derived>) {
+      return self().ownsReferenceSurface_impl(istate);
+    } else {
+      return referenceSurface(istate) != nullptr;
+    }
+  }
+
  private:
   friend class detail_lt::TrackStateProxy<Derived, MeasurementSizeMax, true>;
   friend class detail_lt::TrackStateProxy<Derived, MeasurementSizeMax, false>;
@@ -108,6 +108,8 @@ concept MutableMultiTrajectoryBackend = CommonMultiTrajectoryBackend<T> &&
 
   {v.unset_impl(mask, istate)};
 
+  {v.addTrackStateComponents_impl(istate, mask)};
+
   {v.clear_impl()};
 
   // As far as I know there's no good way to assert that there's a generic
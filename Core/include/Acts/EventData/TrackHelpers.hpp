@@ -9,6 +9,10 @@
 
 #include "Acts/EventData/MultiTrajectory.hpp"
 #include "Acts/EventData/TrackContainer.hpp"
+#include "Acts/EventData/TrackStatePropMask.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/Result.hpp"
 
 namespace Acts {
 
@@ -51,4 +55,36 @@ void calculateTrackQuantities(
     }
   }
 }
+
+/// Helper function to smooth a track which was fitted without smoothing,
+/// e.g. with @c KalmanFitterOutputPolicy::filtered
+/// The smoothed component is added to the track states which do not have it
+/// yet, then the smoother runs from the tip of the track.
+/// @note The input track needs to be mutable, so @c ReadOnly=false
+/// @tparam track_container_t the track container backend
+/// @tparam track_state_container_t the track state container backend
+/// @tparam holder_t the holder type for the track container backends
+/// @tparam smoother_t the smoother type, e.g. @c GainMatrixSmoother
+/// @param gctx The geometry context
+/// @param track A mutable track proxy to operate on
+/// @param smoother The smoother to use
+/// @param logger The logger to use
+/// @return the result of the smoother
+template <typename track_container_t, typename track_state_container_t,
+          template <typename> class holder_t, typename smoother_t>
+Result<void> smoothTrack(
+    const GeometryContext& gctx,
+    Acts::TrackProxy<track_container_t, track_state_container_t, holder_t,
+                     false>
+        track,
+    const smoother_t& smoother, const Logger& logger = getDummyLogger()) {
+  for (auto trackState : track.trackStatesReversed()) {
+    if (!trackState.hasSmoothed()) {
+      trackState.addComponents(TrackStatePropMask::Smoothed);
+    }
+  }
+
+  return smoother(gctx, track.container().trackStateContainer(),
+                  track.tipIndex(), logger);
+}
 }  // namespace Acts
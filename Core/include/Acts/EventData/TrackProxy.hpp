@@ -335,6 +335,35 @@ class TrackProxy {
   }
   // NOLINTEND(performance-unnecessary-value-param)
 
+  /// Set a new reference surface for this track without taking ownership
+  /// @param srf The surface to set, can be null
+  /// @note The surface has to outlive the container. Backends without
+  ///       non-owning storage share the ownership instead.
+  template <bool RO = ReadOnly, typename = std::enable_if_t<!RO>>
+  void setReferenceSurfaceUnowned(const Surface* srf) {
+    auto& backend = m_container->container();
+    if constexpr (Concepts::exists<
+                      detail_lt::set_reference_surface_unowned_t,
+                      std::decay_t<decltype(backend)>>) {
+      backend.setReferenceSurfaceUnowned_impl(m_index, srf);
+    } else {
+      backend.setReferenceSurface_impl(
+          m_index, srf != nullptr ? srf->getSharedPtr() : nullptr);
+    }
+  }
+
+  /// Return whether the reference surface is kept alive by the container
+  /// @return whether the container shares the ownership of the surface
+  bool ownsReferenceSurface() const {
+    const auto& backend = m_container->container();
+    if constexpr (Concepts::exists<detail_lt::owns_reference_surface_t,
+                                   std::decay_t<decltype(backend)>>) {
+      return backend.ownsReferenceSurface_impl(m_index);
+    } else {
+      return hasReferenceSurface();
+    }
+  }
+
   /// Return whether a reference surface is associated to this track
   /// @return whether a surface exists or not
   bool hasReferenceSurface() const {
@@ -663,7 +692,11 @@ class TrackProxy {
     covariance() = other.covariance();
     setParticleHypothesis(other.particleHypothesis());
     if (other.hasReferenceSurface()) {
-      setReferenceSurface(other.referenceSurface().getSharedPtr());
+      if (other.ownsReferenceSurface()) {
+        setReferenceSurface(other.referenceSurface().getSharedPtr());
+      } else {
+        setReferenceSurfaceUnowned(&other.referenceSurface());
+      }
     }
     nMeasurements() = other.nMeasurements();
     nHoles() = other.nHoles();
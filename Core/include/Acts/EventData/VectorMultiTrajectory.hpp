@@ -24,6 +24,7 @@
 #include <cstddef>
 #include <iosfwd>
 #include <memory>
+#include <memory_resource>
 #include <optional>
 #include <stdexcept>
 #include <string>
@@ -143,6 +144,12 @@ class VectorMultiTrajectoryBase {
     return Statistics{h};
   }
 
+  /// The memory resource that backs the columns of this container. This is
+  /// the default resource unless one was given on construction.
+  std::pmr::memory_resource* memoryResource() const {
+    return m_index.get_allocator().resource();
+  }
+
  protected:
   struct IndexData {
     IndexType ipredicted = kInvalid;
@@ -164,6 +171,25 @@ class VectorMultiTrajectoryBase {
 
   VectorMultiTrajectoryBase() = default;
 
+  explicit VectorMultiTrajectoryBase(std::pmr::memory_resource* resource)
+      : m_index{resource},
+        m_previous{resource},
+        m_next{resource},
+        m_params{resource},
+        m_cov{resource},
+        m_meas{resource},
+        m_measOffset{resource},
+        m_measCov{resource},
+        m_measCovOffset{resource},
+        m_jac{resource},
+        m_sourceLinks{resource},
+        m_projectors{resource},
+        m_referenceSurfaces{resource},
+        m_referenceSurfaceOwners{resource},
+        m_ownedReferenceSurfaces{resource} {}
+
+  // Copies are always backed by the default memory resource, as the source
+  // resource might not outlive the copy.
   VectorMultiTrajectoryBase(const VectorMultiTrajectoryBase& other)
       : m_index{other.m_index},
         m_previous{other.m_previous},
@@ -177,7 +203,9 @@ class VectorMultiTrajectoryBase {
         m_jac{other.m_jac},
         m_sourceLinks{other.m_sourceLinks},
         m_projectors{other.m_projectors},
-        m_referenceSurfaces{other.m_referenceSurfaces} {
+        m_referenceSurfaces{other.m_referenceSurfaces},
+        m_referenceSurfaceOwners{other.m_referenceSurfaceOwners},
+        m_ownedReferenceSurfaces{other.m_ownedReferenceSurfaces} {
     for (const auto& [key, value] : other.m_dynamic) {
       m_dynamic.insert({key, value->clone()});
     }
@@ -300,32 +328,40 @@ class VectorMultiTrajectoryBase {
   }
 
   const Surface* referenceSurface_impl(IndexType istate) const {
-    return m_referenceSurfaces[istate].get();
+    return m_referenceSurfaces[istate];
+  }
+
+  bool ownsReferenceSurface_impl(IndexType istate) const {
+    IndexType owner = m_referenceSurfaceOwners[istate];
+    return owner != kInvalid && m_ownedReferenceSurfaces[owner] != nullptr;
   }
 
  protected:
   /// index to map track states to the corresponding
-  std::vector<IndexData> m_index;
-  std::vector<IndexType> m_previous;
-  std::vector<IndexType> m_next;
-  std::vector<typename detail_lt::Types<eBoundSize>::Coefficients> m_params;
-  std::vector<typename detail_lt::Types<eBoundSize>::Covariance> m_cov;
-
-  std::vector<double> m_meas;
-  std::vector<MultiTrajectoryTraits::IndexType> m_measOffset;
-  std::vector<double> m_measCov;
-  std::vector<MultiTrajectoryTraits::IndexType> m_measCovOffset;
-
-  std::vector<typename detail_lt::Types<eBoundSize>::Covariance> m_jac;
-  std::vector<std::optional<SourceLink>> m_sourceLinks;
-  std::vector<ProjectorBitset> m_projectors;
-
-  // owning vector of shared pointers to surfaces
-  //
-  // This might be problematic when appending a large number of surfaces
-  // trackstates, because vector has to reallocated and thus copy. This might
-  // be handled in a smart way by moving but not sure.
-  std::vector<std::shared_ptr<const Surface>> m_referenceSurfaces;
+  std::pmr::vector<IndexData> m_index;
+  std::pmr::vector<IndexType> m_previous;
+  std::pmr::vector<IndexType> m_next;
+  std::pmr::vector<typename detail_lt::Types<eBoundSize>::Coefficients>
+      m_params;
+  std::pmr::vector<typename detail_lt::Types<eBoundSize>::Covariance> m_cov;
+
+  std::pmr::vector<double> m_meas;
+  std::pmr::vector<MultiTrajectoryTraits::IndexType> m_measOffset;
+  std::pmr::vector<double> m_measCov;
+  std::pmr::vector<MultiTrajectoryTraits::IndexType> m_measCovOffset;
+
+  std::pmr::vector<typename detail_lt::Types<eBoundSize>::Covariance> m_jac;
+  std::pmr::vector<std::optional<SourceLink>> m_sourceLinks;
+  std::pmr::vector<ProjectorBitset> m_projectors;
+
+  // reference surfaces as seen by the proxies. Only surfaces set with
+  // ownership are kept alive, by an entry in `m_ownedReferenceSurfaces`
+  // whose index is stored per track state and reused when the surface is
+  // replaced. Surfaces set without ownership, e.g. detector surfaces, never
+  // touch a reference count.
+  std::pmr::vector<const Surface*> m_referenceSurfaces;
+  std::pmr::vector<IndexType> m_referenceSurfaceOwners;
+  std::pmr::vector<std::shared_ptr<const Surface>> m_ownedReferenceSurfaces;
 
   std::unordered_map<HashedString, std::unique_ptr<detail::DynamicColumnBase>>
       m_dynamic;
@@ -347,6 +383,13 @@ class VectorMultiTrajectory final
 
  public:
   VectorMultiTrajectory() = default;
+
+  /// Construct an empty container whose columns are allocated from
+  /// @p resource, e.g. an event-scoped `std::pmr::monotonic_buffer_resource`.
+  /// The resource must outlive the container and anything it is moved into.
+  explicit VectorMultiTrajectory(std::pmr::memory_resource* resource)
+      : VectorMultiTrajectoryBase{resource} {}
+
   VectorMultiTrajectory(const VectorMultiTrajectory& other)
       : VectorMultiTrajectoryBase{other} {}
 
@@ -418,12 +461,21 @@ class VectorMultiTrajectory final
 
   void reserve(std::size_t n);
 
+  /// Release the storage of parameters, covariances and Jacobians which are
+  /// no longer referenced by any track state, e.g. after they were unset.
+  /// The remaining components are moved into freshly sized storage, shared
+  /// components stay shared.
+  /// @note This invalidates all previously obtained component maps
+  void releaseUnusedComponents();
+
   void shareFrom_impl(IndexType iself, IndexType iother,
                       TrackStatePropMask shareSource,
                       TrackStatePropMask shareTarget);
 
   void unset_impl(TrackStatePropMask target, IndexType istate);
 
+  void addTrackStateComponents_impl(IndexType istate, TrackStatePropMask mask);
+
   constexpr bool has_impl(HashedString key, IndexType istate) const {
     return detail_vmt::VectorMultiTrajectoryBase::has_impl(*this, key, istate);
   }
@@ -446,8 +498,13 @@ class VectorMultiTrajectory final
 
   template <typename T>
   constexpr void addColumn_impl(const std::string& key) {
-    m_dynamic.insert(
-        {hashString(key), std::make_unique<detail::DynamicColumn<T>>()});
+    auto column = std::make_unique<detail::DynamicColumn<T>>(memoryResource());
+    // a column added later covers the existing track states
+    column->reserve(m_index.size());
+    for (std::size_t i = 0; i < m_index.size(); ++i) {
+      column->add();
+    }
+    m_dynamic.insert({hashString(key), std::move(column)});
   }
 
   constexpr bool hasColumn_impl(HashedString key) const {
@@ -478,9 +535,10 @@ class VectorMultiTrajectory final
   }
 
   void setReferenceSurface_impl(IndexType istate,
-                                std::shared_ptr<const Surface> surface) {
-    m_referenceSurfaces[istate] = std::move(surface);
-  }
+                                std::shared_ptr<const Surface> surface);
+
+  void setReferenceSurfaceUnowned_impl(IndexType istate,
+                                       const Surface* surface);
 
   // END INTERFACE
 };
@@ -21,6 +21,7 @@
 #include <cassert>
 #include <cstddef>
 #include <memory>
+#include <memory_resource>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
@@ -55,6 +56,10 @@ class VectorTrackContainerBase {
  protected:
   VectorTrackContainerBase() = default;
 
+  explicit VectorTrackContainerBase(std::pmr::memory_resource* resource);
+
+  // Copies are always backed by the default memory resource, as the source
+  // resource might not outlive the copy.
   VectorTrackContainerBase(const VectorTrackContainerBase& other);
 
   VectorTrackContainerBase(VectorTrackContainerBase&& other) = default;
@@ -125,6 +130,8 @@ class VectorTrackContainerBase {
     assert(result);
     result = result && m_referenceSurfaces.size() == size;
     assert(result);
+    result = result && m_referenceSurfaceOwners.size() == size;
+    assert(result);
     result = result && m_nMeasurements.size() == size;
     assert(result);
     result = result && m_nHoles.size() == size;
@@ -155,7 +162,12 @@ class VectorTrackContainerBase {
   }
 
   const Surface* referenceSurface_impl(IndexType itrack) const {
-    return m_referenceSurfaces[itrack].get();
+    return m_referenceSurfaces[itrack];
+  }
+
+  bool ownsReferenceSurface_impl(IndexType itrack) const {
+    IndexType owner = m_referenceSurfaceOwners[itrack];
+    return owner != kInvalid && m_ownedReferenceSurfaces[owner] != nullptr;
   }
 
   std::size_t size_impl() const {
@@ -164,19 +176,32 @@ class VectorTrackContainerBase {
   }
   // END INTERFACE HELPER
 
-  std::vector<IndexType> m_tipIndex;
-  std::vector<IndexType> m_stemIndex;
-  std::vector<ParticleHypothesis> m_particleHypothesis;
-  std::vector<typename detail_lt::Types<eBoundSize>::Coefficients> m_params;
-  std::vector<typename detail_lt::Types<eBoundSize>::Covariance> m_cov;
-  std::vector<std::shared_ptr<const Surface>> m_referenceSurfaces;
+  /// The memory resource that backs the columns of this container. This is
+  /// the default resource unless one was given on construction.
+  std::pmr::memory_resource* memoryResource() const {
+    return m_tipIndex.get_allocator().resource();
+  }
 
-  std::vector<unsigned int> m_nMeasurements;
-  std::vector<unsigned int> m_nHoles;
-  std::vector<float> m_chi2;
-  std::vector<unsigned int> m_ndf;
-  std::vector<unsigned int> m_nOutliers;
-  std::vector<unsigned int> m_nSharedHits;
+  std::pmr::vector<IndexType> m_tipIndex;
+  std::pmr::vector<IndexType> m_stemIndex;
+  std::pmr::vector<ParticleHypothesis> m_particleHypothesis;
+  std::pmr::vector<typename detail_lt::Types<eBoundSize>::Coefficients>
+      m_params;
+  std::pmr::vector<typename detail_lt::Types<eBoundSize>::Covariance> m_cov;
+  // reference surfaces as seen by the proxies. Only surfaces set with
+  // ownership are kept alive, by an entry in `m_ownedReferenceSurfaces`
+  // whose index is stored per track and reused when the surface is
+  // replaced. Surfaces set without ownership never touch a reference count.
+  std::pmr::vector<const Surface*> m_referenceSurfaces;
+  std::pmr::vector<IndexType> m_referenceSurfaceOwners;
+  std::pmr::vector<std::shared_ptr<const Surface>> m_ownedReferenceSurfaces;
+
+  std::pmr::vector<unsigned int> m_nMeasurements;
+  std::pmr::vector<unsigned int> m_nHoles;
+  std::pmr::vector<float> m_chi2;
+  std::pmr::vector<unsigned int> m_ndf;
+  std::pmr::vector<unsigned int> m_nOutliers;
+  std::pmr::vector<unsigned int> m_nSharedHits;
 
   std::unordered_map<HashedString, std::unique_ptr<detail::DynamicColumnBase>>
       m_dynamic;
@@ -193,6 +218,13 @@ struct IsReadOnlyTrackContainer<VectorTrackContainer> : std::false_type {};
 class VectorTrackContainer final : public detail_vtc::VectorTrackContainerBase {
  public:
   VectorTrackContainer() : VectorTrackContainerBase{} {}
+
+  /// Construct an empty container whose columns are allocated from
+  /// @p resource, e.g. an event-scoped `std::pmr::monotonic_buffer_resource`.
+  /// The resource must outlive the container and anything it is moved into.
+  explicit VectorTrackContainer(std::pmr::memory_resource* resource)
+      : VectorTrackContainerBase{resource} {}
+
   VectorTrackContainer(const VectorTrackContainer& other) = default;
   VectorTrackContainer(VectorTrackContainer&&) = default;
 
@@ -217,8 +249,13 @@ class VectorTrackContainer final : public detail_vtc::VectorTrackContainerBase {
 
   template <typename T>
   constexpr void addColumn_impl(const std::string& key) {
-    m_dynamic.insert(
-        {hashString(key), std::make_unique<detail::DynamicColumn<T>>()});
+    auto column = std::make_unique<detail::DynamicColumn<T>>(memoryResource());
+    // a column added later covers the existing tracks
+    column->reserve(m_tipIndex.size());
+    for (std::size_t i = 0; i < m_tipIndex.size(); ++i) {
+      column->add();
+    }
+    m_dynamic.insert({hashString(key), std::move(column)});
   }
 
   Parameters parameters(IndexType itrack) {
@@ -248,9 +285,10 @@ class VectorTrackContainer final : public detail_vtc::VectorTrackContainerBase {
   void clear();
 
   void setReferenceSurface_impl(IndexType itrack,
-                                std::shared_ptr<const Surface> surface) {
-    m_referenceSurfaces[itrack] = std::move(surface);
-  }
+                                std::shared_ptr<const Surface> surface);
+
+  void setReferenceSurfaceUnowned_impl(IndexType itrack,
+                                       const Surface* surface);
 
   void setParticleHypothesis_impl(
       IndexType itrack, const ParticleHypothesis& particleHypothesis) {
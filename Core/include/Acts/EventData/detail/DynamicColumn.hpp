@@ -11,6 +11,7 @@
 #include <any>
 #include <cassert>
 #include <memory>
+#include <memory_resource>
 #include <vector>
 
 namespace Acts::detail {
@@ -35,6 +36,10 @@ struct DynamicColumnBase {
 
 template <typename T>
 struct DynamicColumn : public DynamicColumnBase {
+  explicit DynamicColumn(
+      std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+      : m_vector{resource} {}
+
   std::any get(std::size_t i) override {
     assert(i < m_vector.size() && "DynamicColumn out of bounds");
     return &m_vector[i];
@@ -66,7 +71,7 @@ struct DynamicColumn : public DynamicColumnBase {
     m_vector.at(dstIdx) = other->m_vector.at(srcIdx);
   }
 
-  std::vector<T> m_vector;
+  std::pmr::vector<T> m_vector;
 };
 
 template <>
@@ -75,6 +80,10 @@ struct DynamicColumn<bool> : public DynamicColumnBase {
     bool value;
   };
 
+  explicit DynamicColumn(
+      std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+      : m_vector{resource} {}
+
   std::any get(std::size_t i) override {
     assert(i < m_vector.size() && "DynamicColumn out of bounds");
     return &m_vector[i].value;
@@ -106,7 +115,7 @@ struct DynamicColumn<bool> : public DynamicColumnBase {
     m_vector.at(dstIdx) = other->m_vector.at(srcIdx);
   }
 
-  std::vector<Wrapper> m_vector;
+  std::pmr::vector<Wrapper> m_vector;
 };
 
 }  // namespace Acts::detail
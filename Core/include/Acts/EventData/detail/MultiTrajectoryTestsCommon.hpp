@@ -243,6 +243,43 @@ class MultiTrajectoryTestsCommon {
     alwaysPresent(ts);
   }
 
+  void testAddComponents() {
+    using PM = TrackStatePropMask;
+
+    trajectory_t t = m_factory.create();
+
+    auto ts = t.getTrackState(t.addTrackState(PM::Predicted | PM::Filtered));
+    BOOST_CHECK(!ts.hasSmoothed());
+    BOOST_CHECK(!ts.hasJacobian());
+    BoundVector predicted = BoundVector::Random();
+    BoundVector filtered = BoundVector::Random();
+    ts.predicted() = predicted;
+    ts.filtered() = filtered;
+
+    // a second state allocated in between does not alias the new components
+    auto other = t.getTrackState(t.addTrackState(PM::All, ts.index()));
+    other.smoothed() = BoundVector::Random();
+
+    ts.addComponents(PM::Predicted | PM::Smoothed | PM::Jacobian);
+    BOOST_CHECK(ts.hasPredicted());
+    BOOST_CHECK(ts.hasFiltered());
+    BOOST_CHECK(ts.hasSmoothed());
+    BOOST_CHECK(ts.hasJacobian());
+    BOOST_CHECK(!ts.hasCalibrated());
+    // existing components are kept
+    BOOST_CHECK_EQUAL(ts.predicted(), predicted);
+    BOOST_CHECK_EQUAL(ts.filtered(), filtered);
+
+    BoundVector smoothed = BoundVector::Random();
+    ts.smoothed() = smoothed;
+    ts.jacobian() = BoundMatrix::Identity();
+    BOOST_CHECK_EQUAL(ts.smoothed(), smoothed);
+    BOOST_CHECK_EQUAL(ts.predicted(), predicted);
+    BOOST_CHECK_EQUAL(ts.filtered(), filtered);
+    BOOST_CHECK_NE(other.smoothed(), smoothed);
+    BOOST_CHECK_EQUAL(ts.jacobian(), BoundMatrix::Identity());
+  }
+
   void testTrackStateProxyCrossTalk(std::default_random_engine& rng) {
     TestTrackState pc(rng, 2u);
 
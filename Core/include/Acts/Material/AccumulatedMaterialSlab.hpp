@@ -71,6 +71,16 @@ class AccumulatedMaterialSlab {
   /// unless explicitly requested.
   void trackAverage(bool useEmptyTrack = false);
 
+  /// Add the total average of another accumulator, e.g. one that was filled
+  /// with a different set of tracks in another thread.
+  ///
+  /// @param other Accumulated material to be added
+  ///
+  /// The result is the same as if all tracks had been averaged by this
+  /// accumulator, up to rounding. The per-track store of @p other is ignored
+  /// and should be empty, i.e. all its tracks should have been averaged.
+  void merge(const AccumulatedMaterialSlab& other);
+
   /// Return the average material properties from all accumulated tracks.
   ///
   /// @returns Average material properties and the number of contributing tracks
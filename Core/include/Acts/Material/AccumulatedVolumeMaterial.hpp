@@ -22,6 +22,13 @@ class AccumulatedVolumeMaterial {
   /// Add one entry with the given material properties.
   void accumulate(const MaterialSlab& mat);
 
+  /// Add all entries accumulated by another object, e.g. in another thread.
+  ///
+  /// The average is the same as if all entries had been accumulated here,
+  /// up to rounding. Only the atomic number depends on the order of the
+  /// entries if some of them are vacuum, as is the case without merging.
+  void merge(const AccumulatedVolumeMaterial& other);
+
   /// Compute the average material collected so far.
   ///
   /// @returns Vacuum properties if no matter has been accumulated yet.
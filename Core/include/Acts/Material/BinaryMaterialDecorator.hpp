@@ -0,0 +1,63 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Material/BinaryMaterialMaps.hpp"
+#include "Acts/Material/IMaterialDecorator.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include <memory>
+#include <string>
+
+namespace Acts {
+
+class Surface;
+class TrackingVolume;
+
+/// @brief Material decorator from the compact binary format
+///
+/// This memory-maps material maps for surfaces and volumes written by
+/// writeBinaryMaterialMaps, the binned material is served from the mapped
+/// file without parsing it.
+class BinaryMaterialDecorator : public IMaterialDecorator {
+ public:
+  /// Constructor
+  ///
+  /// @param fileName is the binary material file
+  /// @param level is the output logging level
+  /// @param clearSurfaceMaterial clears surfaces without material in the file
+  /// @param clearVolumeMaterial clears volumes without material in the file
+  BinaryMaterialDecorator(const std::string& fileName,
+                          Acts::Logging::Level level,
+                          bool clearSurfaceMaterial = true,
+                          bool clearVolumeMaterial = true);
+
+  /// Decorate a surface
+  ///
+  /// @param surface the non-cost surface that is decorated
+  void decorate(Surface& surface) const final;
+
+  /// Decorate a TrackingVolume
+  ///
+  /// @param volume the non-cost volume that is decorated
+  void decorate(TrackingVolume& volume) const final;
+
+ private:
+  SurfaceMaterialMap m_surfaceMaterialMap;
+  VolumeMaterialMap m_volumeMaterialMap;
+
+  bool m_clearSurfaceMaterial{true};
+  bool m_clearVolumeMaterial{true};
+
+  std::unique_ptr<const Logger> m_logger;
+
+  const Logger& logger() const { return *m_logger; }
+};
+
+}  // namespace Acts
@@ -0,0 +1,58 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Material/ISurfaceMaterial.hpp"
+#include "Acts/Material/IVolumeMaterial.hpp"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace Acts {
+
+using SurfaceMaterialMap =
+    std::map<GeometryIdentifier, std::shared_ptr<const ISurfaceMaterial>>;
+
+using VolumeMaterialMap =
+    std::map<GeometryIdentifier, std::shared_ptr<const IVolumeMaterial>>;
+
+using DetectorMaterialMaps = std::pair<SurfaceMaterialMap, VolumeMaterialMap>;
+
+/// Write material maps in the compact binary format
+///
+/// The file holds a table of the distinct material slabs in their in-memory
+/// layout and, for every surface, the binning and the slab index of each bin.
+/// The indices have 2 bytes if there are less than 65536 distinct slabs and
+/// 4 bytes otherwise. Binned and homogeneous surface material as well as
+/// homogeneous volume material can be stored.
+///
+/// @param fileName is the name of the output file
+/// @param maps are the surface and volume material maps
+///
+/// @throw std::invalid_argument for material which can not be stored
+/// @throw std::runtime_error if the file can not be written
+void writeBinaryMaterialMaps(const std::string& fileName,
+                             const DetectorMaterialMaps& maps);
+
+/// Read material maps written by writeBinaryMaterialMaps
+///
+/// The file is memory-mapped and not parsed: binned surface material refers
+/// directly to the slab table and the bin indices in the mapped file, which
+/// is shared by all processes reading it. The mapping is released once no
+/// material refers to it anymore.
+///
+/// @param fileName is the name of the input file
+///
+/// @throw std::runtime_error if the file can not be mapped or is malformed
+DetectorMaterialMaps readBinaryMaterialMaps(const std::string& fileName);
+
+}  // namespace Acts
@@ -0,0 +1,107 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Material/ISurfaceMaterial.hpp"
+#include "Acts/Material/MaterialSlab.hpp"
+#include "Acts/Utilities/BinUtility.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+
+namespace Acts {
+
+/// @class CompactSurfaceMaterial
+///
+/// Binned surface material which stores a slab index per bin into a table of
+/// distinct material slabs, which is usually shared with other surfaces.
+/// The table and the indices are not owned, a storage handle (e.g. a
+/// memory-mapped material file) keeps them alive.
+class CompactSurfaceMaterial : public ISurfaceMaterial {
+ public:
+  /// Explicit constructor
+  ///
+  /// @param binUtility defines the binning structure on the surface (copied)
+  /// @param slabs is the table of material slabs
+  /// @param indices are the slab indices, ordered as bin0 + nBins0 * bin1
+  /// @param indexSize is the size of a single index, 2 or 4 bytes
+  /// @param storage keeps the slab table and the indices alive
+  /// @param splitFactor is the pre/post splitting directive
+  /// @param mappingType is the type of surface mapping associated to the
+  ///        surface
+  CompactSurfaceMaterial(const BinUtility& binUtility,
+                         const MaterialSlab* slabs, const void* indices,
+                         std::size_t indexSize,
+                         std::shared_ptr<const void> storage,
+                         double splitFactor = 0.,
+                         MappingType mappingType = MappingType::Default);
+
+  /// Destructor
+  ~CompactSurfaceMaterial() override = default;
+
+  /// Scale operator
+  ///
+  /// The slab table is read-only, so the slabs of all bins are copied into
+  /// storage owned by this material first.
+  ///
+  /// @param scale is the scale factor for the full material
+  CompactSurfaceMaterial& operator*=(double scale) final;
+
+  /// Return the BinUtility
+  const BinUtility& binUtility() const { return m_binUtility; }
+
+  /// @copydoc ISurfaceMaterial::materialSlab(const Vector2&) const
+  const MaterialSlab& materialSlab(const Vector2& lp) const final;
+
+  /// @copydoc ISurfaceMaterial::materialSlab(const Vector3&) const
+  const MaterialSlab& materialSlab(const Vector3& gp) const final;
+
+  /// @copydoc ISurfaceMaterial::materialSlab(std::size_t, std::size_t) const
+  const MaterialSlab& materialSlab(std::size_t bin0,
+                                   std::size_t bin1) const final;
+
+  /// Output Method for std::ostream, to be overloaded by child classes
+  std::ostream& toStream(std::ostream& sl) const final;
+
+ private:
+  /// The helper for the bin finding
+  BinUtility m_binUtility;
+
+  /// Number of bins in the first dimension
+  std::size_t m_nBins0 = 1;
+
+  /// The table of slabs the indices refer to
+  const MaterialSlab* m_slabs = nullptr;
+
+  /// The slab index of each bin, none if the slabs are stored per bin
+  const void* m_indices = nullptr;
+
+  /// Size of a single index in bytes
+  std::size_t m_indexSize = 0;
+
+  /// Keeps the slabs and the indices alive
+  std::shared_ptr<const void> m_storage;
+};
+
+inline const MaterialSlab& CompactSurfaceMaterial::materialSlab(
+    std::size_t bin0, std::size_t bin1) const {
+  std::size_t bin = bin0 + m_nBins0 * bin1;
+  if (m_indices == nullptr) {
+    return m_slabs[bin];
+  }
+  if (m_indexSize == sizeof(std::uint16_t)) {
+    return m_slabs[static_cast<const std::uint16_t*>(m_indices)[bin]];
+  }
+  return m_slabs[static_cast<const std::uint32_t*>(m_indices)[bin]];
+}
+
+}  // namespace Acts
@@ -165,6 +165,15 @@ class SurfaceMaterialMapper {
   /// @param mState
   void finalizeMaps(State& mState) const;
 
+  /// @brief Method to merge the accumulated material of another state
+  ///
+  /// Tracks can be mapped concurrently into separate states, which are
+  /// then merged into one state before finalizing it.
+  ///
+  /// @param mState The state to merge into
+  /// @param other The state to be merged, created for the same geometry
+  void mergeState(State& mState, const State& other) const;
+
   /// Process/map a single track
   ///
   /// @param mState The current state map
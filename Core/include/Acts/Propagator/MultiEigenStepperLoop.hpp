@@ -20,9 +20,11 @@
 #include "Acts/EventData/detail/CorrectedTransformationFreeToBound.hpp"
 #include "Acts/MagneticField/MagneticFieldProvider.hpp"
 #include "Acts/Propagator/ConstrainedStep.hpp"
+#include "Acts/Propagator/DefaultExtension.hpp"
 #include "Acts/Propagator/EigenStepper.hpp"
 #include "Acts/Propagator/EigenStepperError.hpp"
 #include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/StepperExtensionList.hpp"
 #include "Acts/Propagator/detail/LoopStepperUtils.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Utilities/Intersection.hpp"
@@ -35,6 +37,7 @@
 #include <limits>
 #include <numeric>
 #include <sstream>
+#include <type_traits>
 #include <vector>
 
 #include <boost/container/small_vector.hpp>
@@ -208,6 +211,15 @@ struct MaxMomentumReducerLoop {
 /// * There are certain redundancies between the global State and the component
 /// states
 /// * The components do not share a single magnetic-field-cache
+///
+/// With the DefaultExtension, the Runge-Kutta stages of all components are
+/// evaluated together on arrays laid out per coordinate (structure of arrays
+/// over the components), in batches of up to `batchSize` components. The
+/// step size is still adapted per component. The field lookups of a batch go
+/// through a single field cache, and components at the same position in a
+/// stage (e.g. the components emerging from one component in the material
+/// convolution) share a single lookup. The results are identical to stepping
+/// every component with the EigenStepper.
 /// @tparam extensionlist_t See EigenStepper for details
 /// @tparam component_reducer_t How to map the multi-component state to a single
 /// component
@@ -256,6 +268,14 @@ class MultiEigenStepperLoop
   /// @brief How many components can this stepper manage?
   static constexpr int maxComponents = std::numeric_limits<int>::max();
 
+  /// @brief Whether the components are integrated together, which is only
+  /// implemented for the DefaultExtension
+  static constexpr bool batchedStepping =
+      std::is_same_v<extensionlist_t, StepperExtensionList<DefaultExtension>>;
+
+  /// @brief How many components are integrated together at most
+  static constexpr std::size_t batchSize = 16;
+
   /// Constructor from a magnetic field and a optionally provided Logger
   MultiEigenStepperLoop(std::shared_ptr<const MagneticFieldProvider> bField,
                         std::unique_ptr<const Logger> logger =
@@ -820,6 +840,23 @@ class MultiEigenStepperLoop
   template <typename propagator_state_t, typename navigator_t>
   Result<double> step(propagator_state_t& state,
                       const navigator_t& navigator) const;
+
+ private:
+  /// Integrate all components which are not on a surface with the batched
+  /// Runge-Kutta integration and write one result per component
+  template <typename propagator_state_t, typename navigator_t,
+            typename results_t>
+  void stepComponentsBatched(propagator_state_t& state,
+                             const navigator_t& navigator,
+                             results_t& results) const;
+
+  /// Integrate the components with the indices @p lanes together and write
+  /// their results
+  template <typename propagator_state_t, typename navigator_t,
+            typename results_t>
+  void stepBatch(propagator_state_t& state, const navigator_t& navigator,
+                 const std::size_t* lanes, std::size_t nLanes,
+                 results_t& results) const;
 };
 
 }  // namespace Acts
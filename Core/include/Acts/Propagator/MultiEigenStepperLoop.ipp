@@ -9,6 +9,10 @@
 #include "Acts/Propagator/MultiEigenStepperLoop.hpp"
 #include "Acts/Utilities/Logger.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+
 namespace Acts {
 
 template <typename E, typename R, typename A>
@@ -148,47 +152,53 @@ Result<double> MultiEigenStepperLoop<E, R, A>::step(
     reweightNecessary = true;
   }
 
-  // Loop over all components and collect results in vector, write some
-  // summary information to a stringstream
-  SmallVector<std::optional<Result<double>>> results;
-  double accumulatedPathLength = 0.0;
-  std::size_t errorSteps = 0;
-
-  // Type of the proxy single propagation2 state
-  using ThisSinglePropState =
-      detail::SinglePropState<SingleState, decltype(state.navigation),
-                              decltype(state.options),
-                              decltype(state.geoContext)>;
+  // Step all components and collect the results in a vector, one entry per
+  // component in order. Components on a surface keep std::nullopt, so the
+  // propagation does not fail if we have only components on surfaces and
+  // failing states.
+  SmallVector<std::optional<Result<double>>> results(components.size());
 
-  // Lambda that performs the step for a component and returns false if the step
-  // went ok and true if there was an error
-  auto errorInStep = [&](auto& component) {
-    if (component.status == Status::onSurface) {
-      // We need to add these, so the propagation does not fail if we have only
-      // components on surfaces and failing states
-      results.emplace_back(std::nullopt);
-      return false;
-    }
+  if constexpr (batchedStepping) {
+    stepComponentsBatched(state, navigator, results);
+  } else {
+    // Type of the proxy single propagation2 state
+    using ThisSinglePropState =
+        detail::SinglePropState<SingleState, decltype(state.navigation),
+                                decltype(state.options),
+                                decltype(state.geoContext)>;
+
+    for (std::size_t i = 0; i < components.size(); ++i) {
+      if (components[i].status == Status::onSurface) {
+        continue;
+      }
 
-    ThisSinglePropState single_state(component.state, state.navigation,
-                                     state.options, state.geoContext);
+      ThisSinglePropState single_state(components[i].state, state.navigation,
+                                       state.options, state.geoContext);
 
-    results.emplace_back(SingleStepper::step(single_state, navigator));
+      results[i] = SingleStepper::step(single_state, navigator);
+    }
+  }
 
-    if (results.back()->ok()) {
-      accumulatedPathLength += component.weight * results.back()->value();
-      return false;
-    } else {
+  // Accumulate the path length and remove errorous components
+  double accumulatedPathLength = 0.0;
+  std::size_t errorSteps = 0;
+  std::size_t nKept = 0;
+  for (std::size_t i = 0; i < components.size(); ++i) {
+    const auto& result = results[i];
+    if (result && !result->ok()) {
       ++errorSteps;
       reweightNecessary = true;
-      return true;
+      continue;
     }
-  };
-
-  // Loop over components and remove errorous components
-  stepping.components.erase(
-      std::remove_if(components.begin(), components.end(), errorInStep),
-      components.end());
+    if (result) {
+      accumulatedPathLength += components[i].weight * result->value();
+    }
+    if (nKept != i) {
+      components[nKept] = std::move(components[i]);
+    }
+    ++nKept;
+  }
+  components.erase(components.begin() + nKept, components.end());
 
   // Reweight if necessary
   if (reweightNecessary) {
@@ -229,4 +239,272 @@ Result<double> MultiEigenStepperLoop<E, R, A>::step(
   return accumulatedPathLength;
 }
 
+template <typename E, typename R, typename A>
+template <typename propagator_state_t, typename navigator_t,
+          typename results_t>
+void MultiEigenStepperLoop<E, R, A>::stepComponentsBatched(
+    propagator_state_t& state, const navigator_t& navigator,
+    results_t& results) const {
+  using Status = Acts::Intersection3D::Status;
+
+  const auto& components = state.stepping.components;
+
+  // Components on a surface are not stepped
+  std::array<std::size_t, batchSize> lanes{};
+  std::size_t nLanes = 0;
+  for (std::size_t i = 0; i < components.size(); ++i) {
+    if (components[i].status == Status::onSurface) {
+      continue;
+    }
+    lanes[nLanes++] = i;
+    if (nLanes == batchSize) {
+      stepBatch(state, navigator, lanes.data(), nLanes, results);
+      nLanes = 0;
+    }
+  }
+  if (nLanes > 0) {
+    stepBatch(state, navigator, lanes.data(), nLanes, results);
+  }
+}
+
+template <typename E, typename R, typename A>
+template <typename propagator_state_t, typename navigator_t,
+          typename results_t>
+void MultiEigenStepperLoop<E, R, A>::stepBatch(propagator_state_t& state,
+                                               const navigator_t& navigator,
+                                               const std::size_t* lanes,
+                                               std::size_t nLanes,
+                                               results_t& results) const {
+  // One row per component, the fixed maximum size avoids heap allocations
+  using Lanes = Eigen::Array<double, Eigen::Dynamic, 1, Eigen::ColMajor,
+                             batchSize, 1>;
+  using Lanes3 = Eigen::Array<double, Eigen::Dynamic, 3, Eigen::ColMajor,
+                              batchSize, 3>;
+
+  using ThisSinglePropState =
+      detail::SinglePropState<SingleState, decltype(state.navigation),
+                              decltype(state.options),
+                              decltype(state.geoContext)>;
+
+  auto& components = state.stepping.components;
+  const SingleStepper& singleStepper = *this;
+  const auto n = static_cast<Eigen::Index>(nLanes);
+
+  Lanes3 pos(n, 3), dir(n, 3), tmp(n, 3);
+  Lanes3 k1(n, 3), k2(n, 3), k3(n, 3), k4(n, 3);
+  Lanes3 B1 = Lanes3::Zero(n, 3);
+  Lanes3 B2 = Lanes3::Zero(n, 3);
+  Lanes3 B3 = Lanes3::Zero(n, 3);
+  Lanes qop(n), h(n), h2(n), halfH(n), initialH(n), error(n);
+  std::array<std::size_t, batchSize> nStepTrials{};
+  std::array<bool, batchSize> active{};
+
+  for (std::size_t l = 0; l < nLanes; ++l) {
+    auto& cmpState = components[lanes[l]].state;
+    ThisSinglePropState singleState(cmpState, state.navigation, state.options,
+                                    state.geoContext);
+    pos.row(l) = cmpState.pars.template segment<3>(eFreePos0).transpose();
+    dir.row(l) = cmpState.pars.template segment<3>(eFreeDir0).transpose();
+    qop(l) = cmpState.pars[eFreeQOverP];
+    initialH(l) = cmpState.stepSize.value() * state.options.direction;
+    h(l) = initialH(l);
+
+    if (!cmpState.extension.validExtensionForStep(singleState, singleStepper,
+                                                  navigator)) {
+      results[lanes[l]] = Result<double>::success(0.);
+      continue;
+    }
+    active[l] = true;
+  }
+
+  // All lookups of a step go through the cache of the first component, so
+  // that components in the same field cell reuse the cell
+  auto& fieldCache = components[lanes[0]].state.fieldCache;
+
+  // Look up the field at the positions @p p for all active components. A
+  // component at the same position as an earlier one takes its value.
+  auto lookupField = [&](const Lanes3& p, Lanes3& field) {
+    for (std::size_t l = 0; l < nLanes; ++l) {
+      if (!active[l]) {
+        continue;
+      }
+      bool shared = false;
+      for (std::size_t m = 0; m < l; ++m) {
+        if (active[m] && (p.row(m) == p.row(l)).all()) {
+          field.row(l) = field.row(m);
+          shared = true;
+          break;
+        }
+      }
+      if (shared) {
+        continue;
+      }
+      const Vector3 position = p.row(l).transpose().matrix();
+      auto fieldRes = this->m_bField->getField(position, fieldCache);
+      if (!fieldRes.ok()) {
+        results[lanes[l]] = Result<double>::failure(fieldRes.error());
+        active[l] = false;
+        continue;
+      }
+      field.row(l) = fieldRes->transpose().array();
+    }
+  };
+
+  // knew = qop * (dir + s * kprev) x field, evaluated for all components
+  auto computeK = [&](Lanes3& knew, const Lanes3& field, const Lanes& s,
+                      const Lanes3& kprev) {
+    for (int c = 0; c < 3; ++c) {
+      tmp.col(c) = dir.col(c) + s * kprev.col(c);
+    }
+    knew.col(0) = qop * (tmp.col(1) * field.col(2) - tmp.col(2) * field.col(1));
+    knew.col(1) = qop * (tmp.col(2) * field.col(0) - tmp.col(0) * field.col(2));
+    knew.col(2) = qop * (tmp.col(0) * field.col(1) - tmp.col(1) * field.col(0));
+  };
+
+  // Write the accepted step of component @p l back to its state, as the
+  // end of EigenStepper::step does
+  auto finalizeLane = [&](std::size_t l) -> Result<double> {
+    auto& cmpState = components[lanes[l]].state;
+    auto& sd = cmpState.stepData;
+    sd.B_first = B1.row(l).transpose().matrix();
+    sd.B_middle = B2.row(l).transpose().matrix();
+    sd.B_last = B3.row(l).transpose().matrix();
+    sd.k1 = k1.row(l).transpose().matrix();
+    sd.k2 = k2.row(l).transpose().matrix();
+    sd.k3 = k3.row(l).transpose().matrix();
+    sd.k4 = k4.row(l).transpose().matrix();
+    sd.kQoP = {0., 0., 0., 0.};
+
+    const double hl = h(l);
+    const Vector3 dirl = dir.row(l).transpose().matrix();
+    ThisSinglePropState singleState(cmpState, state.navigation, state.options,
+                                    state.geoContext);
+
+    // When doing error propagation, update the associated Jacobian matrix
+    if (cmpState.covTransport) {
+      // The step transport matrix in global coordinates
+      FreeMatrix D;
+      if (!cmpState.extension.finalize(singleState, singleStepper, navigator,
+                                       hl, D)) {
+        return EigenStepperError::StepInvalid;
+      }
+
+      // for moment, only update the transport part
+      cmpState.jacTransport = D * cmpState.jacTransport;
+    } else {
+      if (!cmpState.extension.finalize(singleState, singleStepper, navigator,
+                                       hl)) {
+        return EigenStepperError::StepInvalid;
+      }
+    }
+
+    // Update the track parameters according to the equations of motion
+    cmpState.pars.template segment<3>(eFreePos0) +=
+        hl * dirl + h2(l) / 6. * (sd.k1 + sd.k2 + sd.k3);
+    cmpState.pars.template segment<3>(eFreeDir0) +=
+        hl / 6. * (sd.k1 + 2. * (sd.k2 + sd.k3) + sd.k4);
+    (cmpState.pars.template segment<3>(eFreeDir0)).normalize();
+
+    if (cmpState.covTransport) {
+      cmpState.derivative.template head<3>() =
+          cmpState.pars.template segment<3>(eFreeDir0);
+      cmpState.derivative.template segment<3>(4) = sd.k4;
+    }
+    cmpState.pathAccumulated += hl;
+    const double stepSizeScaling = std::min(
+        std::max(0.25f,
+                 std::sqrt(std::sqrt(static_cast<float>(
+                     state.options.stepTolerance / std::abs(error(l)))))),
+        4.0f);
+    const double nextAccuracy = std::abs(hl * stepSizeScaling);
+    const double previousAccuracy = std::abs(cmpState.stepSize.accuracy());
+    const double initialStepLength = std::abs(initialH(l));
+    if (nextAccuracy < initialStepLength || nextAccuracy > previousAccuracy) {
+      cmpState.stepSize.setAccuracy(nextAccuracy);
+    }
+    cmpState.stepSize.nStepTrials = nStepTrials[l];
+
+    return hl;
+  };
+
+  // First Runge-Kutta point (at current position)
+  lookupField(pos, B1);
+  for (int c = 0; c < 3; ++c) {
+    tmp.col(c) = dir.col(c);
+  }
+  k1.col(0) = qop * (tmp.col(1) * B1.col(2) - tmp.col(2) * B1.col(1));
+  k1.col(1) = qop * (tmp.col(2) * B1.col(0) - tmp.col(0) * B1.col(2));
+  k1.col(2) = qop * (tmp.col(0) * B1.col(1) - tmp.col(1) * B1.col(0));
+
+  // Select and adjust the appropriate Runge-Kutta step size per component as
+  // given ATL-SOFT-PUB-2009-001
+  while (std::any_of(active.begin(), active.begin() + nLanes,
+                     [](bool a) { return a; })) {
+    h2 = h * h;
+    halfH = h * 0.5;
+
+    // Second Runge-Kutta point
+    for (int c = 0; c < 3; ++c) {
+      tmp.col(c) = pos.col(c) + halfH * dir.col(c) + (h2 * 0.125) * k1.col(c);
+    }
+    lookupField(tmp, B2);
+    computeK(k2, B2, halfH, k1);
+
+    // Third Runge-Kutta point
+    computeK(k3, B2, halfH, k2);
+
+    // Last Runge-Kutta point
+    for (int c = 0; c < 3; ++c) {
+      tmp.col(c) = pos.col(c) + h * dir.col(c) + (h2 * 0.5) * k3.col(c);
+    }
+    lookupField(tmp, B3);
+    computeK(k4, B3, h, k3);
+
+    // Compute the local integration error estimates
+    error = h2 * ((k1.col(0) - k2.col(0) - k3.col(0) + k4.col(0)).abs() +
+                  (k1.col(1) - k2.col(1) - k3.col(1) + k4.col(1)).abs() +
+                  (k1.col(2) - k2.col(2) - k3.col(2) + k4.col(2)).abs() + 0.);
+    error = error.max(1e-20);
+
+    for (std::size_t l = 0; l < nLanes; ++l) {
+      if (!active[l]) {
+        continue;
+      }
+      if (error(l) <= state.options.stepTolerance) {
+        results[lanes[l]] = finalizeLane(l);
+        active[l] = false;
+        continue;
+      }
+
+      const double stepSizeScaling =
+          std::min(std::max(0.25f, std::sqrt(std::sqrt(static_cast<float>(
+                                       state.options.stepTolerance /
+                                       std::abs(2. * error(l)))))),
+                   4.0f);
+      h(l) *= stepSizeScaling;
+
+      // If step size becomes too small the particle remains at the initial
+      // place
+      if (std::abs(h(l)) < std::abs(state.options.stepSizeCutOff)) {
+        // Not moving due to too low momentum needs an aborter
+        results[lanes[l]] =
+            Result<double>::failure(EigenStepperError::StepSizeStalled);
+        active[l] = false;
+        continue;
+      }
+
+      // If the parameter is off track too much or given stepSize is not
+      // appropriate
+      if (nStepTrials[l] > state.options.maxRungeKuttaStepTrials) {
+        // Too many trials, have to abort
+        results[lanes[l]] = Result<double>::failure(
+            EigenStepperError::StepSizeAdjustmentFailed);
+        active[l] = false;
+        continue;
+      }
+      nStepTrials[l]++;
+    }
+  }
+}
+
 }  // namespace Acts
@@ -0,0 +1,78 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/MagneticFieldProvider.hpp"
+#include "Acts/Utilities/Result.hpp"
+
+#include <optional>
+
+namespace Acts {
+
+class Surface;
+
+namespace detail {
+
+/// Transport bound track parameters to a surface along an exact helix.
+///
+/// The magnetic field is assumed to be homogeneous along the whole path. No
+/// navigation, step size control or material interactions are performed,
+/// which makes this much cheaper than a full propagation for the short
+/// distances encountered e.g. in vertexing. The path length to the surface
+/// is found iteratively by intersecting the tangent of the helix with the
+/// surface. The covariance, if present, is transported with the analytic
+/// transport Jacobian of the helix.
+///
+/// @param gctx The geometry context
+/// @param params The start parameters
+/// @param surface The target surface
+/// @param bField The homogeneous magnetic field
+/// @param tolerance Distance along the tangent below which the surface is
+///        considered to be reached
+/// @param maxIterations Maximum number of tangent intersections
+///
+/// @return The parameters on the target surface or an error if the surface
+///         could not be reached within @p maxIterations
+Result<BoundTrackParameters> transportAlongHelix(
+    const GeometryContext& gctx, const BoundTrackParameters& params,
+    const Surface& surface, const Vector3& bField, double tolerance,
+    unsigned int maxIterations = 20);
+
+/// Transport bound track parameters along a helix if the magnetic field is
+/// homogeneous.
+///
+/// The field is evaluated at the start position. Unless the field provider
+/// is a `ConstantBField` or a `NullBField`, it is evaluated again at the end
+/// position and the result is discarded if the field differs by more than
+/// the relative @p fieldTolerance.
+///
+/// @param gctx The geometry context
+/// @param params The start parameters
+/// @param surface The target surface
+/// @param field The magnetic field provider
+/// @param fieldCache The magnetic field cache
+/// @param fieldTolerance Relative field variation below which the field is
+///        considered to be homogeneous
+/// @param tolerance Distance along the tangent below which the surface is
+///        considered to be reached
+///
+/// @return The parameters on the target surface or `std::nullopt` if the
+///         field is not homogeneous or the transport failed, in which case
+///         the caller should fall back to a full propagation
+std::optional<BoundTrackParameters> tryTransportAlongHelix(
+    const GeometryContext& gctx, const BoundTrackParameters& params,
+    const Surface& surface, const MagneticFieldProvider& field,
+    MagneticFieldProvider::Cache& fieldCache, double fieldTolerance,
+    double tolerance);
+
+}  // namespace detail
+}  // namespace Acts
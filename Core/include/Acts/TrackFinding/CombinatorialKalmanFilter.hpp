@@ -939,7 +939,8 @@ class CombinatorialKalmanFilter {
 
         ts.pathLength() = pathLength;
 
-        ts.setReferenceSurface(boundParams.referenceSurface().getSharedPtr());
+        // the surfaces of the tracking geometry outlive the track states
+        ts.setReferenceSurfaceUnowned(&boundParams.referenceSurface());
 
         // now calibrate the track state
         m_extensions.calibrator(gctx, calibrationContext, sourceLink, ts);
@@ -1097,9 +1098,10 @@ class CombinatorialKalmanFilter {
       }
       trackStateProxy.jacobian() = jacobian;
       trackStateProxy.pathLength() = pathLength;
-      // Set the surface
-      trackStateProxy.setReferenceSurface(
-          boundParams.referenceSurface().getSharedPtr());
+      // Set the surface, the surfaces of the tracking geometry outlive the
+      // track states
+      trackStateProxy.setReferenceSurfaceUnowned(
+          &boundParams.referenceSurface());
       // Set the filtered parameter index to be the same with predicted
       // parameter
 
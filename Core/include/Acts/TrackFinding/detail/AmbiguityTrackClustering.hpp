@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include "Acts/Utilities/ParallelFor.hpp"
+
 #include <map>
 #include <unordered_map>
 #include <utility>
@@ -23,5 +25,35 @@ namespace detail {
 std::unordered_map<int, std::vector<int>> clusterDuplicateTracks(
     const std::multimap<int, std::pair<int, std::vector<int>>>& trackMap);
 
+/// Clusterise tracks based on shared hits, processing independent groups of
+/// tracks concurrently
+///
+/// Tracks can only end up in the same cluster if they are connected through
+/// shared hits. The tracks are first split into these connected components,
+/// which are then clusterised concurrently. The clusters are the same as the
+/// ones of the sequential version.
+///
+/// @param trackMap : Multimap storing pair of track ID and vector of measurement ID. The keys are the number of measurement and are just there to facilitate the ordering.
+/// @param executor : Executor for the concurrent loops, the tracks are processed sequentially if it is empty
+/// @return an unordered map representing the clusters, the keys the ID of the primary track of each cluster and the store a vector of track IDs.
+std::unordered_map<int, std::vector<int>> clusterDuplicateTracks(
+    const std::multimap<int, std::pair<int, std::vector<int>>>& trackMap,
+    const ParallelForExecutor& executor);
+
+/// Group tracks into the connected components of the graph of tracks and
+/// measurements, i.e. two tracks are in the same component if they are
+/// connected through a chain of shared hits
+///
+/// A lock-free union-find is used, such that the tracks can be processed
+/// concurrently. Components do not share any hit, so the ambiguity
+/// resolution of different components is independent.
+///
+/// @param trackMap : Multimap storing pair of track ID and vector of measurement ID. The keys are the number of measurement and are just there to facilitate the ordering.
+/// @param executor : Executor for the concurrent loops, the tracks are processed sequentially if it is empty
+/// @return the track IDs of each component. The tracks of a component and the components themselves are ordered by decreasing key, as the tracks are processed by clusterDuplicateTracks.
+std::vector<std::vector<int>> connectedTrackComponents(
+    const std::multimap<int, std::pair<int, std::vector<int>>>& trackMap,
+    const ParallelForExecutor& executor = {});
+
 }  // namespace detail
 }  // namespace Acts
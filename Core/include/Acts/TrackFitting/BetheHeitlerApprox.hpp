@@ -22,6 +22,7 @@
 #include <stdexcept>
 #include <string>
 #include <tuple>
+#include <vector>
 
 #include <boost/container/static_vector.hpp>
 
@@ -61,6 +62,29 @@ inline auto inverseTransformComponent(double transformed_weight,
   return cmp;
 }
 
+/// Structure-of-arrays storage of the mixtures for a batch of x/x0 values.
+/// The components of mixture k are stored at the indices
+/// [k * maxComponents, k * maxComponents + sizes[k]).
+struct GaussianMixtureBatch {
+  std::size_t maxComponents = 0;
+  std::vector<std::size_t> sizes;
+  std::vector<ActsScalar> weights;
+  std::vector<ActsScalar> means;
+  std::vector<ActsScalar> vars;
+
+  /// Resize for @p nMixtures mixtures, keeps the allocated memory
+  void resize(std::size_t nMixtures, std::size_t nMaxComponents) {
+    maxComponents = nMaxComponents;
+    sizes.resize(nMixtures);
+    weights.resize(nMixtures * nMaxComponents);
+    means.resize(nMixtures * nMaxComponents);
+    vars.resize(nMixtures * nMaxComponents);
+  }
+
+  /// Number of mixtures in the batch
+  std::size_t size() const { return sizes.size(); }
+};
+
 }  // namespace detail
 
 /// This class approximates the Bethe-Heitler with only one component. This is
@@ -94,6 +118,39 @@ struct BetheHeitlerApproxSingleCmp {
   }
 };
 
+namespace detail {
+
+/// Below this x/x0 the momentum is not changed
+constexpr double kBetheHeitlerNoChangeLimit = 0.0001;
+/// Below this x/x0 a single gaussian is used instead of a mixture
+constexpr double kBetheHeitlerSingleGaussianLimit = 0.002;
+
+/// Mixture for material too thin for the multi-component
+/// parameterizations
+///
+/// @param x pathlength in terms of the radiation length
+/// @param cmp is set to the single component if the material is thin
+///
+/// @return false if the material is not thin
+inline bool thinMaterialMixture(ActsScalar x, GaussianComponent &cmp) {
+  if (x < kBetheHeitlerNoChangeLimit) {
+    cmp.weight = 1.0;
+    cmp.mean = 1.0;  // p_initial = p_final
+    cmp.var = 0.0;
+    return true;
+  }
+  if (x < kBetheHeitlerSingleGaussianLimit) {
+    cmp = BetheHeitlerApproxSingleCmp::mixture(x)[0];
+    return true;
+  }
+  return false;
+}
+
+}  // namespace detail
+
+template <int NComponents>
+class TabulatedBetheHeitlerApprox;
+
 /// This class approximates the Bethe-Heitler distribution as a gaussian
 /// mixture. To enable an approximation for continuous input variables, the
 /// weights, means and variances are internally parametrized as a Nth order
@@ -116,16 +173,92 @@ class AtlasBetheHeitlerApprox {
   using Data = std::array<PolyData, NComponents>;
 
  private:
+  /// The coefficients of all components ordered by degree, so that the
+  /// polynomials of all components are evaluated together
+  struct PolySoA {
+    static constexpr int Degree = PolyDegree;
+    using Coeffs = std::array<ActsScalar, NComponents>;
+    std::array<Coeffs, PolyDegree + 1> weightCoeffs{};
+    std::array<Coeffs, PolyDegree + 1> meanCoeffs{};
+    std::array<Coeffs, PolyDegree + 1> varCoeffs{};
+  };
+
   Data m_lowData;
   Data m_highData;
+  PolySoA m_lowPoly;
+  PolySoA m_highPoly;
   bool m_lowTransform;
   bool m_highTransform;
 
-  constexpr static double m_noChangeLimit = 0.0001;
-  constexpr static double m_singleGaussianLimit = 0.002;
   double m_lowLimit = 0.10;
   double m_highLimit = 0.20;
 
+  template <int>
+  friend class TabulatedBetheHeitlerApprox;
+
+  static constexpr PolySoA transpose(const Data &data) {
+    PolySoA poly;
+    for (int i = 0; i < NComponents; ++i) {
+      for (int d = 0; d <= PolyDegree; ++d) {
+        poly.weightCoeffs[d][i] = data[i].weightCoeffs[d];
+        poly.meanCoeffs[d][i] = data[i].meanCoeffs[d];
+        poly.varCoeffs[d][i] = data[i].varCoeffs[d];
+      }
+    }
+    return poly;
+  }
+
+  /// Evaluates the normalized mixture of one parameterization
+  static void evaluate(const PolySoA &poly, bool transform, ActsScalar x,
+                       ActsScalar *weights, ActsScalar *means,
+                       ActsScalar *vars) {
+    std::array<ActsScalar, NComponents> w{};
+    std::array<ActsScalar, NComponents> m{};
+    std::array<ActsScalar, NComponents> v{};
+    // Horner scheme for all components at once
+    for (int d = 0; d <= PolyDegree; ++d) {
+      for (int i = 0; i < NComponents; ++i) {
+        w[i] = x * w[i] + poly.weightCoeffs[d][i];
+        m[i] = x * m[i] + poly.meanCoeffs[d][i];
+        v[i] = x * v[i] + poly.varCoeffs[d][i];
+      }
+    }
+    // These transformations must be applied to the data according to ATHENA
+    // (TrkGaussianSumFilter/src/GsfCombinedMaterialEffects.cxx:79)
+    if (transform) {
+      for (int i = 0; i < NComponents; ++i) {
+        w[i] = 1. / (1 + std::exp(-w[i]));
+        m[i] = 1. / (1 + std::exp(-m[i]));
+        v[i] = std::exp(v[i]);
+      }
+    }
+    ActsScalar weightSum = 0;
+    for (int i = 0; i < NComponents; ++i) {
+      assert((std::isfinite(w[i]) && std::isfinite(m[i]) &&
+              std::isfinite(v[i]) && "polynom result not finite"));
+      weightSum += w[i];
+    }
+    for (int i = 0; i < NComponents; ++i) {
+      weights[i] = w[i] / weightSum;
+      means[i] = m[i];
+      vars[i] = v[i];
+    }
+  }
+
+  /// Evaluates the mixture for material which is not thin
+  void evaluate(ActsScalar x, ActsScalar *weights, ActsScalar *means,
+                ActsScalar *vars) const {
+    // Return a component representation for lower x0
+    if (x < m_lowLimit) {
+      evaluate(m_lowPoly, m_lowTransform, x, weights, means, vars);
+      return;
+    }
+    // Return a component representation for higher x0
+    // Cap the x because beyond the parameterization goes wild
+    evaluate(m_highPoly, m_highTransform, std::min(m_highLimit, x), weights,
+             means, vars);
+  }
+
  public:
   /// Construct the Bethe-Heitler approximation description with two
   /// parameterizations, one for lower ranges, one for higher ranges.
@@ -144,6 +277,8 @@ class AtlasBetheHeitlerApprox {
                                     double highLimit = 0.2)
       : m_lowData(lowData),
         m_highData(highData),
+        m_lowPoly(transpose(lowData)),
+        m_highPoly(transpose(highData)),
         m_lowTransform(lowTransform),
         m_highTransform(highTransform),
         m_lowLimit(lowLimit),
@@ -157,6 +292,12 @@ class AtlasBetheHeitlerApprox {
   /// @param x pathlength in terms of the radiation length
   constexpr bool validXOverX0(ActsScalar x) const { return x < m_highLimit; }
 
+  /// Upper x/x0 limit of the low x/x0 parameterization
+  constexpr double lowLimit() const { return m_lowLimit; }
+
+  /// Upper x/x0 limit of the high x/x0 parameterization
+  constexpr double highLimit() const { return m_highLimit; }
+
   /// Generates the mixture from the polynomials and reweights them, so
   /// that the sum of all weights is 1
   ///
@@ -164,69 +305,46 @@ class AtlasBetheHeitlerApprox {
   auto mixture(ActsScalar x) const {
     using Array =
         boost::container::static_vector<detail::GaussianComponent, NComponents>;
-    // Build a polynom
-    auto poly = [](ActsScalar xx,
-                   const std::array<ActsScalar, PolyDegree + 1> &coeffs) {
-      ActsScalar sum{0.};
-      for (const auto c : coeffs) {
-        sum = xx * sum + c;
-      }
-      assert((std::isfinite(sum) && "polynom result not finite"));
-      return sum;
-    };
-
-    // Lambda which builds the components
-    auto make_mixture = [&](const Data &data, double xx, bool transform) {
-      // Value initialization should garanuee that all is initialized to zero
-      Array ret(NComponents);
-      ActsScalar weight_sum = 0;
-      for (int i = 0; i < NComponents; ++i) {
-        // These transformations must be applied to the data according to ATHENA
-        // (TrkGaussianSumFilter/src/GsfCombinedMaterialEffects.cxx:79)
-        if (transform) {
-          ret[i] = detail::inverseTransformComponent(
-              poly(xx, data[i].weightCoeffs), poly(xx, data[i].meanCoeffs),
-              poly(xx, data[i].varCoeffs));
-        } else {
-          ret[i].weight = poly(xx, data[i].weightCoeffs);
-          ret[i].mean = poly(xx, data[i].meanCoeffs);
-          ret[i].var = poly(xx, data[i].varCoeffs);
-        }
-
-        weight_sum += ret[i].weight;
-      }
-
-      for (int i = 0; i < NComponents; ++i) {
-        ret[i].weight /= weight_sum;
-      }
-
-      return ret;
-    };
-
-    // Return no change
-    if (x < m_noChangeLimit) {
-      Array ret(1);
-
-      ret[0].weight = 1.0;
-      ret[0].mean = 1.0;  // p_initial = p_final
-      ret[0].var = 0.0;
 
+    Array ret;
+    detail::GaussianComponent thin;
+    if (detail::thinMaterialMixture(x, thin)) {
+      ret.push_back(thin);
       return ret;
     }
-    // Return single gaussian approximation
-    if (x < m_singleGaussianLimit) {
-      Array ret(1);
-      ret[0] = BetheHeitlerApproxSingleCmp::mixture(x)[0];
-      return ret;
+
+    std::array<ActsScalar, NComponents> weights{};
+    std::array<ActsScalar, NComponents> means{};
+    std::array<ActsScalar, NComponents> vars{};
+    evaluate(x, weights.data(), means.data(), vars.data());
+    for (int i = 0; i < NComponents; ++i) {
+      ret.push_back({weights[i], means[i], vars[i]});
     }
-    // Return a component representation for lower x0
-    if (x < m_lowLimit) {
-      return make_mixture(m_lowData, x, m_lowTransform);
+    return ret;
+  }
+
+  /// Generates the mixtures for a batch of x/x0 values
+  ///
+  /// @param xs pathlengths in terms of the radiation length
+  /// @param n number of pathlengths
+  /// @param batch is filled with the mixtures
+  void mixtures(const ActsScalar *xs, std::size_t n,
+                detail::GaussianMixtureBatch &batch) const {
+    batch.resize(n, NComponents);
+    for (std::size_t k = 0; k < n; ++k) {
+      const std::size_t offset = k * NComponents;
+      detail::GaussianComponent thin;
+      if (detail::thinMaterialMixture(xs[k], thin)) {
+        batch.sizes[k] = 1;
+        batch.weights[offset] = thin.weight;
+        batch.means[offset] = thin.mean;
+        batch.vars[offset] = thin.var;
+        continue;
+      }
+      batch.sizes[k] = NComponents;
+      evaluate(xs[k], &batch.weights[offset], &batch.means[offset],
+               &batch.vars[offset]);
     }
-    // Return a component representation for higher x0
-    // Cap the x because beyond the parameterization goes wild
-    const auto high_x = std::min(m_highLimit, x);
-    return make_mixture(m_highData, high_x, m_highTransform);
   }
 
   /// Loads a parameterization from a file according to the Atlas file
@@ -288,6 +406,189 @@ class AtlasBetheHeitlerApprox {
   }
 };
 
+/// This class tabulates the mixtures of an @ref AtlasBetheHeitlerApprox on
+/// uniform grids in x/x0 and interpolates linearly between the grid points,
+/// which avoids evaluating the polynomials and the transformations for every
+/// component. The low and the high x/x0 parameterizations have separate
+/// grids, so that no interpolation crosses the step between them.
+template <int NComponents>
+class TabulatedBetheHeitlerApprox {
+  static_assert(NComponents > 0);
+
+ public:
+  /// Construct the table from a polynomial parameterization
+  ///
+  /// @param approx is the tabulated parameterization
+  /// @param nBins number of interpolation intervals of each grid
+  template <int PolyDegree>
+  explicit TabulatedBetheHeitlerApprox(
+      const AtlasBetheHeitlerApprox<NComponents, PolyDegree> &approx,
+      std::size_t nBins = 256)
+      : m_lowLimit(approx.lowLimit()), m_highLimit(approx.highLimit()) {
+    if (nBins == 0) {
+      throw std::invalid_argument("Need at least one interpolation interval");
+    }
+    m_lowTable = makeTable(approx.m_lowPoly, approx.m_lowTransform,
+                           detail::kBetheHeitlerSingleGaussianLimit,
+                           m_lowLimit, nBins);
+    m_highTable = makeTable(approx.m_highPoly, approx.m_highTransform,
+                            m_lowLimit, m_highLimit, nBins);
+  }
+
+  /// Returns the number of components the returned mixture will have
+  constexpr auto numComponents() const { return NComponents; }
+
+  /// Checks if an input is valid for the parameterization
+  ///
+  /// @param x pathlength in terms of the radiation length
+  constexpr bool validXOverX0(ActsScalar x) const { return x < m_highLimit; }
+
+  /// Interpolates the mixture from the tables
+  ///
+  /// @param x pathlength in terms of the radiation length
+  auto mixture(ActsScalar x) const {
+    boost::container::static_vector<detail::GaussianComponent, NComponents>
+        ret;
+    detail::GaussianComponent thin;
+    if (detail::thinMaterialMixture(x, thin)) {
+      ret.push_back(thin);
+      return ret;
+    }
+
+    std::array<ActsScalar, NComponents> weights{};
+    std::array<ActsScalar, NComponents> means{};
+    std::array<ActsScalar, NComponents> vars{};
+    interpolate(x, weights.data(), means.data(), vars.data());
+    for (int i = 0; i < NComponents; ++i) {
+      ret.push_back({weights[i], means[i], vars[i]});
+    }
+    return ret;
+  }
+
+  /// Interpolates the mixtures for a batch of x/x0 values
+  ///
+  /// @param xs pathlengths in terms of the radiation length
+  /// @param n number of pathlengths
+  /// @param batch is filled with the mixtures
+  void mixtures(const ActsScalar *xs, std::size_t n,
+                detail::GaussianMixtureBatch &batch) const {
+    batch.resize(n, NComponents);
+    for (std::size_t k = 0; k < n; ++k) {
+      const std::size_t offset = k * NComponents;
+      detail::GaussianComponent thin;
+      if (detail::thinMaterialMixture(xs[k], thin)) {
+        batch.sizes[k] = 1;
+        batch.weights[offset] = thin.weight;
+        batch.means[offset] = thin.mean;
+        batch.vars[offset] = thin.var;
+        continue;
+      }
+      batch.sizes[k] = NComponents;
+      interpolate(xs[k], &batch.weights[offset], &batch.means[offset],
+                  &batch.vars[offset]);
+    }
+  }
+
+ private:
+  /// Mixtures at the grid points, the components of a grid point are
+  /// stored contiguously
+  struct Table {
+    ActsScalar xMin = 0;
+    ActsScalar invStep = 0;
+    std::size_t nBins = 0;
+    std::vector<ActsScalar> weights;
+    std::vector<ActsScalar> means;
+    std::vector<ActsScalar> vars;
+  };
+
+  Table m_lowTable;
+  Table m_highTable;
+  double m_lowLimit;
+  double m_highLimit;
+
+  template <typename poly_t>
+  static Table makeTable(const poly_t &poly, bool transform, ActsScalar xMin,
+                         ActsScalar xMax, std::size_t nBins) {
+    Table table;
+    table.xMin = xMin;
+    // The range of a parameterization can be empty, e.g. when the low
+    // parameterization covers everything up to the cap
+    table.invStep = xMax > xMin ? nBins / (xMax - xMin) : 0.;
+    table.nBins = nBins;
+    table.weights.resize((nBins + 1) * NComponents);
+    table.means.resize((nBins + 1) * NComponents);
+    table.vars.resize((nBins + 1) * NComponents);
+    for (std::size_t j = 0; j <= nBins; ++j) {
+      const ActsScalar x = xMin + j * (xMax - xMin) / nBins;
+      const std::size_t offset = j * NComponents;
+      AtlasBetheHeitlerApprox<NComponents, poly_t::Degree>::evaluate(
+          poly, transform, x, &table.weights[offset], &table.means[offset],
+          &table.vars[offset]);
+    }
+    return table;
+  }
+
+  void interpolate(ActsScalar x, ActsScalar *weights, ActsScalar *means,
+                   ActsScalar *vars) const {
+    const Table &table = x < m_lowLimit ? m_lowTable : m_highTable;
+    // Cap the x like the parameterization does
+    const ActsScalar u =
+        (std::min<ActsScalar>(x, m_highLimit) - table.xMin) * table.invStep;
+    const std::size_t bin =
+        std::min(static_cast<std::size_t>(std::max<ActsScalar>(u, 0.)),
+                 table.nBins - 1);
+    const ActsScalar t = u - bin;
+    const std::size_t offset = bin * NComponents;
+    // The interpolated weights stay normalized, since the weights at both
+    // grid points are
+    for (int i = 0; i < NComponents; ++i) {
+      const std::size_t lo = offset + i;
+      const std::size_t hi = lo + NComponents;
+      weights[i] =
+          table.weights[lo] + t * (table.weights[hi] - table.weights[lo]);
+      means[i] = table.means[lo] + t * (table.means[hi] - table.means[lo]);
+      vars[i] = table.vars[lo] + t * (table.vars[hi] - table.vars[lo]);
+    }
+  }
+};
+
+namespace detail {
+
+/// Evaluates the mixtures for a batch of x/x0 values with any
+/// approximation providing a mixture(x) member
+template <typename bethe_heitler_approx_t>
+void evaluateMixtures(const bethe_heitler_approx_t &approx,
+                      const ActsScalar *xs, std::size_t n,
+                      GaussianMixtureBatch &batch) {
+  batch.resize(n, approx.numComponents());
+  for (std::size_t k = 0; k < n; ++k) {
+    const auto mixture = approx.mixture(xs[k]);
+    const std::size_t offset = k * batch.maxComponents;
+    batch.sizes[k] = mixture.size();
+    for (std::size_t i = 0; i < mixture.size(); ++i) {
+      batch.weights[offset + i] = mixture[i].weight;
+      batch.means[offset + i] = mixture[i].mean;
+      batch.vars[offset + i] = mixture[i].var;
+    }
+  }
+}
+
+template <int NComponents, int PolyDegree>
+void evaluateMixtures(
+    const AtlasBetheHeitlerApprox<NComponents, PolyDegree> &approx,
+    const ActsScalar *xs, std::size_t n, GaussianMixtureBatch &batch) {
+  approx.mixtures(xs, n, batch);
+}
+
+template <int NComponents>
+void evaluateMixtures(const TabulatedBetheHeitlerApprox<NComponents> &approx,
+                      const ActsScalar *xs, std::size_t n,
+                      GaussianMixtureBatch &batch) {
+  approx.mixtures(xs, n, batch);
+}
+
+}  // namespace detail
+
 /// Creates a @ref AtlasBetheHeitlerApprox object based on an ATLAS
 /// configuration, that are stored as static data in the source code.
 /// This may not be an optimal configuration, but should allow to run
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "Acts/Definitions/TrackParametrization.hpp"
 #include "Acts/EventData/MultiTrajectory.hpp"
 #include "Acts/EventData/detail/covariance_helper.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
@@ -18,7 +19,10 @@
 
 #include <cassert>
 #include <cstddef>
+#include <numeric>
 #include <system_error>
+#include <utility>
+#include <vector>
 
 namespace Acts {
 
@@ -29,6 +33,40 @@ namespace Acts {
 /// linearization.
 class GainMatrixSmoother {
  public:
+  /// Contiguous smoothing steps for the batched smoothing. Each step smoothes
+  /// one state using the following state along the track, which has to be
+  /// smoothed already. The outputs are resized by @c smoothBatch.
+  struct Batch {
+    std::vector<BoundVector> filtered;
+    std::vector<BoundSquareMatrix> filteredCovariance;
+    /// Predicted parameters of the following state
+    std::vector<BoundVector> nextPredicted;
+    std::vector<BoundSquareMatrix> nextPredictedCovariance;
+    /// Smoothed parameters of the following state
+    std::vector<BoundVector> nextSmoothed;
+    std::vector<BoundSquareMatrix> nextSmoothedCovariance;
+    /// Jacobian from this state to the following state
+    std::vector<BoundMatrix> nextJacobian;
+
+    std::vector<BoundVector> smoothed;
+    std::vector<BoundSquareMatrix> smoothedCovariance;
+    /// Default-constructed error code for a successful step
+    std::vector<std::error_code> errors;
+
+    std::size_t size() const { return filtered.size(); }
+
+    /// Resize the inputs to @p n steps
+    void resize(std::size_t n) {
+      filtered.resize(n);
+      filteredCovariance.resize(n);
+      nextPredicted.resize(n);
+      nextPredictedCovariance.resize(n);
+      nextSmoothed.resize(n);
+      nextSmoothedCovariance.resize(n);
+      nextJacobian.resize(n);
+    }
+  };
+
   /// Run the Kalman smoothing for one trajectory.
   ///
   /// @param[in] gctx The geometry context for the smoothing
@@ -126,6 +164,117 @@ class GainMatrixSmoother {
     return error ? Result<void>::failure(error) : Result<void>::success();
   }
 
+  /// Run one smoothing step for a batch of states with the same fixed-size
+  /// kernel as the single trajectory smoothing.
+  ///
+  /// @param[in,out] batch The smoothing steps
+  /// @param[in] logger Where to write logging information to
+  void smoothBatch(Batch& batch, const Logger& logger = getDummyLogger()) const;
+
+  /// Run the Kalman smoothing for many trajectories in the same container.
+  ///
+  /// The trajectories are smoothed in lockstep, i.e. the n-th state before
+  /// each entry state is smoothed for all trajectories with one call of
+  /// @c smoothBatch. The smoothed parameters of the following states are
+  /// kept in the batch between the steps. Trajectories are dropped from the
+  /// batch once they are finished or failed.
+  ///
+  /// @param[in] gctx The geometry context for the smoothing
+  /// @param[in,out] trajectory The container of the trajectories
+  /// @param[in] entryIndices The indices of the states to start the smoothing
+  /// @param[in] logger Where to write logging information to
+  /// @return the result of the smoothing for each trajectory
+  template <typename traj_t>
+  std::vector<Result<void>> smoothTrajectories(
+      const GeometryContext& gctx, traj_t& trajectory,
+      const std::vector<std::size_t>& entryIndices,
+      const Logger& logger = getDummyLogger()) const {
+    (void)gctx;
+
+    const std::size_t nTrajectories = entryIndices.size();
+    std::vector<Result<void>> results(nTrajectories, Result<void>::success());
+    ACTS_VERBOSE("Invoked GainMatrixSmoother on " << nTrajectories
+                                                  << " trajectories");
+
+    // The indices of the states of each trajectory, from the entry backwards
+    std::vector<std::vector<std::size_t>> stateIndices(nTrajectories);
+    for (std::size_t t = 0; t < nTrajectories; ++t) {
+      trajectory.visitBackwards(entryIndices[t], [&](const auto& ts) {
+        stateIndices[t].push_back(ts.index());
+      });
+    }
+
+    // The trajectories which are still smoothed, in the order of the batch
+    std::vector<std::size_t> active(nTrajectories);
+    std::iota(active.begin(), active.end(), 0);
+
+    // For the entry states: smoothed is filtered
+    Batch batch;
+    batch.smoothed.resize(nTrajectories);
+    batch.smoothedCovariance.resize(nTrajectories);
+    for (std::size_t t = 0; t < nTrajectories; ++t) {
+      auto ts = trajectory.getTrackState(entryIndices[t]);
+      ts.smoothed() = ts.filtered();
+      ts.smoothedCovariance() = ts.filteredCovariance();
+      batch.smoothed[t] = ts.filtered();
+      batch.smoothedCovariance[t] = ts.filteredCovariance();
+    }
+
+    for (std::size_t step = 1;; ++step) {
+      // Drop the finished and the failed trajectories, the others keep the
+      // smoothed state of the last step
+      std::size_t nActive = 0;
+      for (std::size_t k = 0; k < active.size(); ++k) {
+        const std::size_t t = active[k];
+        if (stateIndices[t].size() <= step || !results[t].ok()) {
+          continue;
+        }
+        active[nActive] = t;
+        batch.smoothed[nActive] = batch.smoothed[k];
+        batch.smoothedCovariance[nActive] = batch.smoothedCovariance[k];
+        ++nActive;
+      }
+      active.resize(nActive);
+      if (nActive == 0) {
+        break;
+      }
+
+      // The smoothed states of the last step are the following states now
+      std::swap(batch.smoothed, batch.nextSmoothed);
+      std::swap(batch.smoothedCovariance, batch.nextSmoothedCovariance);
+      batch.resize(nActive);
+
+      for (std::size_t k = 0; k < nActive; ++k) {
+        const auto& indices = stateIndices[active[k]];
+        const auto ts = trajectory.getTrackState(indices[step]);
+        const auto next = trajectory.getTrackState(indices[step - 1]);
+        assert(ts.hasFiltered());
+        assert(next.hasPredicted());
+        assert(next.hasJacobian());
+        batch.filtered[k] = ts.filtered();
+        batch.filteredCovariance[k] = ts.filteredCovariance();
+        batch.nextPredicted[k] = next.predicted();
+        batch.nextPredictedCovariance[k] = next.predictedCovariance();
+        batch.nextJacobian[k] = next.jacobian();
+      }
+
+      smoothBatch(batch, logger);
+
+      for (std::size_t k = 0; k < nActive; ++k) {
+        const std::size_t t = active[k];
+        if (batch.errors[k]) {
+          results[t] = Result<void>::failure(batch.errors[k]);
+          continue;
+        }
+        auto ts = trajectory.getTrackState(stateIndices[t][step]);
+        ts.smoothed() = batch.smoothed[k];
+        ts.smoothedCovariance() = batch.smoothedCovariance[k];
+      }
+    }
+
+    return results;
+  }
+
   using GetParameters =
       Acts::Delegate<TrackStateTraits<MultiTrajectoryTraits::MeasurementSizeMax,
                                       false>::Parameters(void*)>;
@@ -8,7 +8,9 @@
 
 #pragma once
 
+#include "Acts/Definitions/Algebra.hpp"
 #include "Acts/Definitions/Direction.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
 #include "Acts/EventData/Measurement.hpp"
 #include "Acts/EventData/MeasurementHelpers.hpp"
 #include "Acts/EventData/MultiTrajectory.hpp"
@@ -18,8 +20,10 @@
 #include "Acts/Utilities/Result.hpp"
 
 #include <cassert>
+#include <cstddef>
 #include <system_error>
 #include <tuple>
+#include <vector>
 
 namespace Acts {
 
@@ -43,6 +47,36 @@ class GainMatrixUpdater {
   };
 
  public:
+  /// Contiguous track states with the same measurement dimension for the
+  /// batched update. The outputs are resized by @c updateBatch.
+  ///
+  /// @tparam kMeasurementSize Dimension of the measurements
+  template <std::size_t kMeasurementSize>
+  struct Batch {
+    std::vector<BoundVector> predicted;
+    std::vector<BoundSquareMatrix> predictedCovariance;
+    std::vector<ActsVector<kMeasurementSize>> calibrated;
+    std::vector<ActsSquareMatrix<kMeasurementSize>> calibratedCovariance;
+    std::vector<ActsMatrix<kMeasurementSize, eBoundSize>> projector;
+
+    std::vector<BoundVector> filtered;
+    std::vector<BoundSquareMatrix> filteredCovariance;
+    std::vector<double> chi2;
+    /// Default-constructed error code for a successful update
+    std::vector<std::error_code> errors;
+
+    std::size_t size() const { return predicted.size(); }
+
+    /// Resize the inputs to @p n states
+    void resize(std::size_t n) {
+      predicted.resize(n);
+      predictedCovariance.resize(n);
+      calibrated.resize(n);
+      calibratedCovariance.resize(n);
+      projector.resize(n);
+    }
+  };
+
   /// Run the Kalman update step for a single trajectory state.
   ///
   /// @tparam kMeasurementSizeMax
@@ -105,6 +139,92 @@ class GainMatrixUpdater {
     return error ? Result<void>::failure(error) : Result<void>::success();
   }
 
+  /// Run the Kalman update step for a batch of states with the same
+  /// measurement dimension. The same fixed-size kernel is applied to all
+  /// states without any dispatch on the dimension.
+  ///
+  /// @tparam kMeasurementSize Dimension of the measurements
+  /// @param[in,out] batch The states to update
+  /// @param[in] direction The navigation direction
+  /// @param[in] logger Where to write logging information to
+  template <std::size_t kMeasurementSize>
+  void updateBatch(Batch<kMeasurementSize>& batch,
+                   Direction direction = Direction::Forward,
+                   const Logger& logger = getDummyLogger()) const;
+
+  /// Run the Kalman update step for many trajectory states.
+  ///
+  /// The states are grouped by measurement dimension, copied into contiguous
+  /// batches and updated with @c updateBatch.
+  ///
+  /// @param[in] gctx The current geometry context object, e.g. alignment
+  /// @param[in] trackStates The track states to update
+  /// @param[in] direction The navigation direction
+  /// @param[in] logger Where to write logging information to
+  /// @return the result of the update for each track state
+  template <typename track_state_proxy_t>
+  std::vector<Result<void>> updateTrackStates(
+      const GeometryContext& gctx,
+      const std::vector<track_state_proxy_t>& trackStates,
+      Direction direction = Direction::Forward,
+      const Logger& logger = getDummyLogger()) const {
+    (void)gctx;
+    std::vector<Result<void>> results(trackStates.size(),
+                                      Result<void>::success());
+    std::vector<std::size_t> indices;
+
+    auto updateGroup = [&](auto N) {
+      constexpr std::size_t kMeasurementSize = decltype(N)::value;
+
+      indices.clear();
+      for (std::size_t i = 0; i < trackStates.size(); ++i) {
+        assert(trackStates[i].hasCalibrated());
+        assert(trackStates[i].hasPredicted());
+        assert(trackStates[i].hasFiltered());
+        if (trackStates[i].calibratedSize() == kMeasurementSize) {
+          indices.push_back(i);
+        }
+      }
+      if (indices.empty()) {
+        return;
+      }
+
+      Batch<kMeasurementSize> batch;
+      batch.resize(indices.size());
+      for (std::size_t k = 0; k < indices.size(); ++k) {
+        const auto& trackState = trackStates[indices[k]];
+        batch.predicted[k] = trackState.predicted();
+        batch.predictedCovariance[k] = trackState.predictedCovariance();
+        batch.calibrated[k] =
+            trackState.template calibrated<kMeasurementSize>();
+        batch.calibratedCovariance[k] =
+            trackState.template calibratedCovariance<kMeasurementSize>();
+        batch.projector[k] =
+            trackState.projector()
+                .template topLeftCorner<kMeasurementSize, eBoundSize>();
+      }
+
+      updateBatch(batch, direction, logger);
+
+      for (std::size_t k = 0; k < indices.size(); ++k) {
+        auto trackState = trackStates[indices[k]];
+        trackState.chi2() = batch.chi2[k];
+        if (batch.errors[k]) {
+          results[indices[k]] = Result<void>::failure(batch.errors[k]);
+          continue;
+        }
+        trackState.filtered() = batch.filtered[k];
+        trackState.filteredCovariance() = batch.filteredCovariance[k];
+      }
+    };
+
+    for (std::size_t size = 1; size <= eBoundSize; ++size) {
+      visit_measurement(size, updateGroup);
+    }
+
+    return results;
+  }
+
  private:
   std::tuple<double, std::error_code> visitMeasurement(
       InternalTrackState trackState, Direction direction,
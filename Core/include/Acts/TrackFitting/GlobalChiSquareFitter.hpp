@@ -33,6 +33,7 @@
 #include "Acts/Propagator/StraightLineStepper.hpp"
 #include "Acts/Propagator/detail/PointwiseMaterialInteraction.hpp"
 #include "Acts/TrackFitting/GlobalChiSquareFitterError.hpp"
+#include "Acts/TrackFitting/detail/Gx2fNormalEquations.hpp"
 #include "Acts/TrackFitting/detail/VoidFitterComponents.hpp"
 #include "Acts/Utilities/CalibrationContext.hpp"
 #include "Acts/Utilities/Delegate.hpp"
@@ -42,12 +43,17 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <optional>
+#include <string>
+#include <vector>
 
 namespace Acts {
 namespace Experimental {
 
 namespace Gx2fConstants {
 constexpr std::string_view gx2fnUpdateColumn = "Gx2fnUpdateColumn";
+constexpr std::string_view gx2fExtraParametersColumn =
+    "Gx2fExtraParametersColumn";
 }  // namespace Gx2fConstants
 
 /// Extension struct which holds delegates to customize the KF behavior
@@ -67,6 +73,10 @@ struct Gx2FitterExtensions {
 
   using OutlierFinder = Delegate<bool(ConstTrackStateProxy)>;
 
+  using ExtraParameterDerivatives =
+      Delegate<bool(const GeometryContext&, ConstTrackStateProxy,
+                    ActsDynamicMatrix&, ActsDynamicVector&)>;
+
   /// The Calibrator is a dedicated calibration algorithm that allows
   /// to calibrate measurements using track information, this could be
   /// e.g. sagging for wires, module deformations, etc.
@@ -82,6 +92,16 @@ struct Gx2FitterExtensions {
   /// Retrieves the associated surface from a source link
   SourceLinkSurfaceAccessor surfaceAccessor;
 
+  /// Optional: Provides additional parameters for the surface of a
+  /// measurement, e.g. alignment parameters, which are fitted together with
+  /// the track parameters. Fills the derivatives of the predicted measurement
+  /// w.r.t. the additional parameters (measurement dimension x number of
+  /// parameters) and the variances of their prior around zero. Returns false
+  /// if the surface has no additional parameters. A measurement only depends
+  /// on the additional parameters of its own surface, so the blocks of
+  /// different surfaces are only coupled through the track parameters.
+  ExtraParameterDerivatives extraParameterDerivatives;
+
   /// Default constructor which connects the default void components
   Gx2FitterExtensions() {
     calibrator.template connect<&detail::voidFitterCalibrator<traj_t>>();
@@ -222,6 +242,15 @@ struct Gx2FitterResult {
   std::vector<ActsScalar> collectorCovariances;
   std::vector<BoundVector> collectorProjectedJacobians;
 
+  // Additional parameters: for each collected measurement the index of the
+  // block of additional parameters it depends on and the derivatives
+  std::vector<std::size_t> collectorExtraBlocks;
+  std::vector<ActsDynamicVector> collectorExtraDerivatives;
+
+  // Surface and prior variances of each block of additional parameters
+  std::vector<GeometryIdentifier> extraBlockSurfaces;
+  std::vector<ActsDynamicVector> extraBlockPriorVariances;
+
   BoundMatrix jacobianFromStart = BoundMatrix::Identity();
 
   // Count how many surfaces have been hit
@@ -237,6 +266,8 @@ struct Gx2FitterResult {
 /// - Projected Jacobian: This implicitly contains the measurement type
 /// It also checks if the covariance is above a threshold, to detect and avoid
 /// too small covariances for a stable fit.
+/// If the surface has additional parameters, the index of their block and the
+/// derivatives w.r.t. them are collected as well.
 ///
 /// @tparam measDim Number of dimensions of the measurement
 /// @tparam traj_t The trajectory type
@@ -244,9 +275,14 @@ struct Gx2FitterResult {
 /// @param trackStateProxy is the current track state
 /// @param result is the mutable result/cache object
 /// @param logger a logger instance
+/// @param extraBlock index of the block of additional parameters
+/// @param extraDerivatives derivatives w.r.t. the additional parameters
 template <std::size_t measDim, typename traj_t>
-void collector(typename traj_t::TrackStateProxy& trackStateProxy,
-               Gx2FitterResult<traj_t>& result, const Logger& logger) {
+void collector(
+    typename traj_t::TrackStateProxy& trackStateProxy,
+    Gx2FitterResult<traj_t>& result, const Logger& logger,
+    std::size_t extraBlock = detail::Gx2fNormalEquations::kNoBlock,
+    const ActsDynamicMatrix& extraDerivatives = ActsDynamicMatrix()) {
   auto predicted = trackStateProxy.predicted();
   auto measurement = trackStateProxy.template calibrated<measDim>();
   auto covarianceMeasurement =
@@ -279,6 +315,13 @@ void collector(typename traj_t::TrackStateProxy& trackStateProxy,
     result.collectorResiduals.push_back(measurement[i] - projPredicted[i]);
     result.collectorCovariances.push_back(covarianceMeasurement(i, i));
     result.collectorProjectedJacobians.push_back(projJacobian.row(i));
+    result.collectorExtraBlocks.push_back(extraBlock);
+    if (extraBlock != detail::Gx2fNormalEquations::kNoBlock) {
+      result.collectorExtraDerivatives.push_back(
+          extraDerivatives.row(i).transpose());
+    } else {
+      result.collectorExtraDerivatives.emplace_back();
+    }
 
     ACTS_VERBOSE("    Splitting the measurement:"
                  << "\n        Residual:\t" << measurement[i] - projPredicted[i]
@@ -290,6 +333,67 @@ void collector(typename traj_t::TrackStateProxy& trackStateProxy,
 BoundVector calculateDeltaParams(bool zeroField, const BoundMatrix& aMatrix,
                                  const BoundVector& bVector);
 
+/// Solve the normal equations for the track parameters together with the
+/// blocks of additional parameters collected in @p result
+///
+/// @param zeroField Disables the QoP fit
+/// @param result The collected measurements and blocks
+/// @param extraValues Current values of the additional parameters per block
+/// @param chi2sum Output: chi2 including the priors of the blocks
+/// @param deltaParams Output: update of the track parameters
+/// @param covariance Output: covariance of the track parameters
+/// @param extraDeltaParams Output: update of the additional parameters
+/// @return false if the normal equations are not positive definite
+template <typename traj_t>
+bool calculateDeltaParamsWithExtraParameters(
+    bool zeroField, const Gx2FitterResult<traj_t>& result,
+    const std::vector<ActsDynamicVector>& extraValues, double& chi2sum,
+    BoundVector& deltaParams, BoundMatrix& covariance,
+    std::vector<ActsDynamicVector>& extraDeltaParams) {
+  constexpr auto kNoBlock = detail::Gx2fNormalEquations::kNoBlock;
+  const std::size_t nGlobal = zeroField ? 4 : 5;
+
+  // Each measurement depends on the block of its own surface only, so the
+  // matrix of the blocks is block diagonal, they only couple through the
+  // track parameters
+  detail::Gx2fNormalEquations equations(nGlobal, 0);
+  chi2sum = 0;
+  for (std::size_t k = 0; k < result.extraBlockSurfaces.size(); ++k) {
+    equations.addBlock(extraValues[k].size());
+    chi2sum += equations.addPrior(k, result.extraBlockPriorVariances[k],
+                                  extraValues[k]);
+  }
+
+  for (std::size_t iMeas = 0; iMeas < result.collectorResiduals.size();
+       iMeas++) {
+    const std::size_t block = result.collectorExtraBlocks[iMeas];
+    const auto& derivatives = result.collectorExtraDerivatives[iMeas];
+    // The prediction includes the current additional parameters
+    double ri = result.collectorResiduals[iMeas];
+    if (block != kNoBlock) {
+      ri -= derivatives.dot(extraValues[block]);
+    }
+    chi2sum += equations.addMeasurement(
+        ri, result.collectorCovariances[iMeas],
+        result.collectorProjectedJacobians[iMeas].head(nGlobal), block,
+        derivatives);
+  }
+
+  if (!equations.solve()) {
+    return false;
+  }
+
+  deltaParams = BoundVector::Zero();
+  deltaParams.head(nGlobal) = equations.globalDelta();
+  covariance = BoundMatrix::Identity();
+  covariance.topLeftCorner(nGlobal, nGlobal) = equations.globalCovariance();
+  extraDeltaParams.clear();
+  for (std::size_t k = 0; k < equations.nBlocks(); ++k) {
+    extraDeltaParams.push_back(equations.blockDelta(k));
+  }
+  return true;
+}
+
 /// Global Chi Square fitter (GX2F) implementation.
 ///
 /// @tparam propagator_t Type of the propagation class
@@ -445,7 +549,8 @@ class Gx2Fitter {
           // Set the trackStateProxy components with the state from the ongoing
           // propagation
           {
-            trackStateProxy.setReferenceSurface(surface->getSharedPtr());
+            // the surfaces of the tracking geometry outlive the track states
+            trackStateProxy.setReferenceSurfaceUnowned(surface);
             // Bind the transported state to the current surface
             auto res = stepper.boundState(state.stepping, *surface, false,
                                           freeToBoundCorrection);
@@ -481,14 +586,39 @@ class Gx2Fitter {
           result.jacobianFromStart =
               trackStateProxy.jacobian() * result.jacobianFromStart;
 
+          // Additional parameters of the surface
+          std::size_t extraBlock = detail::Gx2fNormalEquations::kNoBlock;
+          ActsDynamicMatrix extraDerivatives;
+          if (extensions.extraParameterDerivatives.connected()) {
+            ActsDynamicVector priorVariances;
+            if (extensions.extraParameterDerivatives(
+                    state.geoContext, trackStateProxy, extraDerivatives,
+                    priorVariances)) {
+              if (extraDerivatives.rows() !=
+                      static_cast<Eigen::Index>(
+                          trackStateProxy.calibratedSize()) ||
+                  extraDerivatives.cols() != priorVariances.size()) {
+                ACTS_WARNING("Inconsistent additional parameters for surface "
+                             << surface->geometryId() << ", ignore them.");
+              } else {
+                extraBlock = result.extraBlockSurfaces.size();
+                result.extraBlockSurfaces.push_back(surface->geometryId());
+                result.extraBlockPriorVariances.push_back(
+                    std::move(priorVariances));
+              }
+            }
+          }
+
           // Collect:
           // - Residuals
           // - Covariances
           // - ProjectedJacobians
           if (trackStateProxy.calibratedSize() == 1) {
-            collector<1>(trackStateProxy, result, *actorLogger);
+            collector<1>(trackStateProxy, result, *actorLogger, extraBlock,
+                         extraDerivatives);
           } else if (trackStateProxy.calibratedSize() == 2) {
-            collector<2>(trackStateProxy, result, *actorLogger);
+            collector<2>(trackStateProxy, result, *actorLogger, extraBlock,
+                         extraDerivatives);
           } else {
             ACTS_WARNING(
                 "Only measurements of 1 and 2 dimensions are implemented yet.");
@@ -609,6 +739,22 @@ class Gx2Fitter {
     BoundMatrix aMatrix = BoundMatrix::Zero();
     BoundVector bVector = BoundVector::Zero();
 
+    // Additional parameters per surface and their update from the last
+    // iteration. With additional parameters, the covariance of the track
+    // parameters comes from the solution of the full normal equations.
+    const bool fitExtraParameters =
+        gx2fOptions.extensions.extraParameterDerivatives.connected();
+    std::map<GeometryIdentifier, ActsDynamicVector> extraParameters;
+    std::map<GeometryIdentifier, ActsDynamicVector> extraDeltaParams;
+    std::optional<BoundMatrix> extraFitCovariance;
+    if (fitExtraParameters &&
+        !trackContainer.trackStateContainer().hasColumn(
+            hashString(Gx2fConstants::gx2fExtraParametersColumn))) {
+      trackContainer.trackStateContainer()
+          .template addColumn<ActsDynamicVector>(
+              std::string(Gx2fConstants::gx2fExtraParametersColumn));
+    }
+
     // Create an index of the 'tip' of the track stored in multitrajectory. It
     // is needed outside the update loop. It will be updated with each iteration
     // and used for the final track
@@ -630,6 +776,13 @@ class Gx2Fitter {
       // update params
       params.parameters() += deltaParams;
       ACTS_VERBOSE("updated params:\n" << params);
+      for (auto& [geoId, delta] : extraDeltaParams) {
+        auto [values, inserted] = extraParameters.try_emplace(geoId, delta);
+        if (!inserted) {
+          values->second += delta;
+        }
+      }
+      extraDeltaParams.clear();
 
       // set up propagator and co
       Acts::GeometryContext geoCtx = gx2fOptions.geoContext;
@@ -673,27 +826,59 @@ class Gx2Fitter {
       aMatrix = BoundMatrix::Zero();
       bVector = BoundVector::Zero();
 
-      // TODO generalize for non-2D measurements
-      for (std::size_t iMeas = 0; iMeas < gx2fResult.collectorResiduals.size();
-           iMeas++) {
-        const auto ri = gx2fResult.collectorResiduals[iMeas];
-        const auto covi = gx2fResult.collectorCovariances[iMeas];
-        const auto projectedJacobian =
-            gx2fResult.collectorProjectedJacobians[iMeas];
-
-        const double chi2meas = ri / covi * ri;
-        const BoundMatrix aMatrixMeas =
-            projectedJacobian * projectedJacobian.transpose() / covi;
-        const BoundVector bVectorMeas = projectedJacobian / covi * ri;
-
-        chi2sum += chi2meas;
-        aMatrix += aMatrixMeas;
-        bVector += bVectorMeas;
-      }
+      if (gx2fResult.extraBlockSurfaces.empty()) {
+        // TODO generalize for non-2D measurements
+        for (std::size_t iMeas = 0;
+             iMeas < gx2fResult.collectorResiduals.size(); iMeas++) {
+          const auto ri = gx2fResult.collectorResiduals[iMeas];
+          const auto covi = gx2fResult.collectorCovariances[iMeas];
+          const auto projectedJacobian =
+              gx2fResult.collectorProjectedJacobians[iMeas];
+
+          const double chi2meas = ri / covi * ri;
+          const BoundMatrix aMatrixMeas =
+              projectedJacobian * projectedJacobian.transpose() / covi;
+          const BoundVector bVectorMeas = projectedJacobian / covi * ri;
+
+          chi2sum += chi2meas;
+          aMatrix += aMatrixMeas;
+          bVector += bVectorMeas;
+        }
 
-      // calculate delta params [a] * delta = b
-      deltaParams =
-          calculateDeltaParams(gx2fOptions.zeroField, aMatrix, bVector);
+        // calculate delta params [a] * delta = b
+        deltaParams =
+            calculateDeltaParams(gx2fOptions.zeroField, aMatrix, bVector);
+        extraFitCovariance.reset();
+      } else {
+        // Solve for the track and the additional parameters together
+        std::vector<ActsDynamicVector> extraValues;
+        for (std::size_t k = 0; k < gx2fResult.extraBlockSurfaces.size();
+             ++k) {
+          auto values =
+              extraParameters.find(gx2fResult.extraBlockSurfaces[k]);
+          extraValues.push_back(
+              values != extraParameters.end()
+                  ? values->second
+                  : ActsDynamicVector::Zero(
+                        gx2fResult.extraBlockPriorVariances[k].size()));
+        }
+
+        BoundMatrix covariance;
+        std::vector<ActsDynamicVector> extraDeltas;
+        if (!calculateDeltaParamsWithExtraParameters(
+                gx2fOptions.zeroField, gx2fResult, extraValues, chi2sum,
+                deltaParams, covariance, extraDeltas)) {
+          ACTS_ERROR("Normal equations are not positive definite.");
+          return Experimental::GlobalChiSquareFitterError::AIsNotInvertible;
+        }
+        extraFitCovariance = covariance;
+        for (std::size_t k = 0; k < extraDeltas.size(); ++k) {
+          extraDeltaParams[gx2fResult.extraBlockSurfaces[k]] =
+              std::move(extraDeltas[k]);
+        }
+        ACTS_VERBOSE("Solved for " << extraDeltas.size()
+                                   << " blocks of additional parameters");
+      }
 
       ACTS_VERBOSE("aMatrix:\n"
                    << aMatrix << "\n"
@@ -729,7 +914,10 @@ class Gx2Fitter {
     // Calculate covariance of the fitted parameters with inverse of [a]
     BoundMatrix fullCovariancePredicted = BoundMatrix::Identity();
     bool aMatrixIsInvertible = false;
-    if (gx2fOptions.zeroField) {
+    if (extraFitCovariance) {
+      aMatrixIsInvertible = true;
+      fullCovariancePredicted = *extraFitCovariance;
+    } else if (gx2fOptions.zeroField) {
       constexpr std::size_t reducedMatrixSize = 4;
 
       auto safeReducedCovariance = safeInverse(
@@ -778,6 +966,18 @@ class Gx2Fitter {
       track.template component<std::size_t>("Gx2fnUpdateColumn") = nUpdate;
     }
 
+    // Store the fitted additional parameters on the track states
+    if (fitExtraParameters) {
+      for (auto trackState : track.trackStatesReversed()) {
+        auto values =
+            extraParameters.find(trackState.referenceSurface().geometryId());
+        if (values != extraParameters.end()) {
+          trackState.template component<ActsDynamicVector>(hashString(
+              Gx2fConstants::gx2fExtraParametersColumn)) = values->second;
+        }
+      }
+    }
+
     // TODO write test for calculateTrackQuantities
     calculateTrackQuantities(track);
 
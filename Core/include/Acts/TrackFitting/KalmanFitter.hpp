@@ -20,6 +20,7 @@
 #include "Acts/EventData/TrackHelpers.hpp"
 #include "Acts/EventData/TrackParameters.hpp"
 #include "Acts/EventData/VectorMultiTrajectory.hpp"
+#include "Acts/EventData/detail/TransformationBoundToFree.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
 #include "Acts/Material/MaterialSlab.hpp"
@@ -27,6 +28,7 @@
 #include "Acts/Propagator/ActionList.hpp"
 #include "Acts/Propagator/ConstrainedStep.hpp"
 #include "Acts/Propagator/DirectNavigator.hpp"
+#include "Acts/Propagator/MaterialInteractor.hpp"
 #include "Acts/Propagator/Navigator.hpp"
 #include "Acts/Propagator/Propagator.hpp"
 #include "Acts/Propagator/StandardAborters.hpp"
@@ -38,11 +40,16 @@
 #include "Acts/Utilities/Delegate.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Utilities/Result.hpp"
+#include "Acts/Utilities/detail/periodic.hpp"
 
+#include <algorithm>
 #include <functional>
 #include <limits>
 #include <map>
 #include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
 
 namespace Acts {
 
@@ -56,6 +63,17 @@ enum class KalmanFitterTargetSurfaceStrategy {
   firstOrLast,
 };
 
+enum class KalmanFitterOutputPolicy {
+  /// Smooth all track states and express the fitted parameters with the
+  /// smoothed parameters
+  smoothed,
+  /// Only store the filtered track states, the smoothed component is not
+  /// allocated. The fitted parameters are the same as for @c smoothed, the
+  /// configured smoother is run on a temporary copy of the states to obtain
+  /// them. The track can be smoothed later, see @c Acts::smoothTrack.
+  filtered,
+};
+
 /// Extension struct which holds delegates to customise the KF behavior
 template <typename traj_t>
 struct KalmanFitterExtensions {
@@ -172,6 +190,9 @@ struct KalmanFitterOptions {
   KalmanFitterTargetSurfaceStrategy referenceSurfaceStrategy =
       KalmanFitterTargetSurfaceStrategy::firstOrLast;
 
+  /// Which parameters are computed and stored for the output track
+  KalmanFitterOutputPolicy outputPolicy = KalmanFitterOutputPolicy::smoothed;
+
   /// Whether to consider multiple scattering
   bool multipleScattering = true;
 
@@ -179,7 +200,7 @@ struct KalmanFitterOptions {
   bool energyLoss = true;
 
   /// Whether to run filtering in reversed direction overwrite the
-  /// ReverseFilteringLogic
+  /// ReverseFilteringLogic. Ignored for the filtered output policy.
   bool reversedFiltering = false;
 
   /// Factor by which the covariance of the input of the reversed filtering is
@@ -191,6 +212,11 @@ struct KalmanFitterOptions {
   /// Whether to include non-linear correction during global to local
   /// transformation
   FreeToBoundCorrection freeToBoundCorrection;
+
+  /// Maximum change of the filtered parameters in a refit, as chi2 w.r.t. the
+  /// filtered covariance of the previous fit, up to which the transport of
+  /// the previous fit is reused. Above, the track is propagated again.
+  double refitMaxParameterChange = 1.0;
 };
 
 template <typename traj_t>
@@ -228,6 +254,9 @@ struct KalmanFitterResult {
   // Indicator if smoothing has been done.
   bool smoothed = false;
 
+  // Indicator if the filtered states have been finalized without smoothing
+  bool filteredOnly = false;
+
   // Indicator if navigation direction has been reversed
   bool reversed = false;
 
@@ -312,6 +341,9 @@ class KalmanFitter {
     KalmanFitterTargetSurfaceStrategy targetSurfaceStrategy =
         KalmanFitterTargetSurfaceStrategy::firstOrLast;
 
+    /// Which parameters are computed and stored for the output track
+    KalmanFitterOutputPolicy outputPolicy = KalmanFitterOutputPolicy::smoothed;
+
     /// Allows retrieving measurements for a surface
     const std::map<GeometryIdentifier, SourceLink>* inputMeasurements = nullptr;
 
@@ -396,7 +428,7 @@ class KalmanFitter {
         // -> Perform the kalman update
         // -> Fill track state information & update stepper information
 
-        if (!result.smoothed && !result.reversed) {
+        if (!result.smoothed && !result.filteredOnly && !result.reversed) {
           ACTS_VERBOSE("Perform " << direction << " filter step");
           auto res = filter(surface, state, stepper, navigator, result);
           if (!res.ok()) {
@@ -418,7 +450,7 @@ class KalmanFitter {
       // when all track states have been handled or the navigation is breaked,
       // reset navigation&stepping before run reversed filtering or
       // proceed to run smoothing
-      if (!result.smoothed && !result.reversed) {
+      if (!result.smoothed && !result.filteredOnly && !result.reversed) {
         if (result.measurementStates == inputMeasurements->size() ||
             (result.measurementStates > 0 &&
              navigator.navigationBreak(state.navigation))) {
@@ -427,8 +459,9 @@ class KalmanFitter {
           // now get track state proxy for the smoothing logic
           auto trackStateProxy =
               result.fittedStates->getTrackState(result.lastMeasurementIndex);
-          if (reversedFiltering ||
-              extensions.reverseFilteringLogic(trackStateProxy)) {
+          if (outputPolicy == KalmanFitterOutputPolicy::smoothed &&
+              (reversedFiltering ||
+               extensions.reverseFilteringLogic(trackStateProxy))) {
             // Start to run reversed filtering:
             // Reverse navigation direction and reset navigation and stepping
             // state to last measurement
@@ -456,10 +489,10 @@ class KalmanFitter {
       // Post-finalization:
       // - Progress to target/reference surface and built the final track
       // parameters
-      if (result.smoothed || result.reversed) {
-        if (result.smoothed) {
+      if (result.smoothed || result.filteredOnly || result.reversed) {
+        if (!result.reversed) {
           // Update state and stepper with material effects
-          // Only for smoothed as reverse filtering will handle this separately
+          // Not for reversed as reverse filtering will handle this separately
           materialInteractor(navigator.currentSurface(state.navigation), state,
                              stepper, navigator,
                              MaterialUpdateStage::FullUpdate);
@@ -582,6 +615,63 @@ class KalmanFitter {
       return Result<void>::success();
     }
 
+    /// Remove the components not needed by the output policy from @p mask
+    TrackStatePropMask stateMask(TrackStatePropMask mask) const {
+      if (outputPolicy == KalmanFitterOutputPolicy::filtered) {
+        mask &= ~TrackStatePropMask::Smoothed;
+      }
+      return mask;
+    }
+
+    /// Smoothed parameters at the state @p firstIndex, obtained by running
+    /// the configured smoother on a scratch copy of the states from
+    /// @p firstIndex to the last measurement state. No smoothed components
+    /// are stored in the fitted trajectory.
+    ///
+    /// @param geoContext The geometry context
+    /// @param result The result with the filtered states
+    /// @param firstIndex The index of the state to smooth
+    /// @param[out] smoothed The smoothed parameters
+    /// @param[out] smoothedCovariance The smoothed covariance
+    Result<void> smoothFirstState(const GeometryContext& geoContext,
+                                  const result_type& result,
+                                  std::size_t firstIndex,
+                                  BoundVector& smoothed,
+                                  BoundSquareMatrix& smoothedCovariance) const {
+      const auto& trajectory = *result.fittedStates;
+      std::vector<std::size_t> indices;
+      trajectory.visitBackwards(result.lastMeasurementIndex, [&](auto ts) {
+        indices.push_back(ts.index());
+        return ts.index() != firstIndex;
+      });
+
+      const TrackStatePropMask copyMask = TrackStatePropMask::Predicted |
+                                          TrackStatePropMask::Filtered |
+                                          TrackStatePropMask::Jacobian;
+      traj_t scratch;
+      std::size_t scratchFirst = kTrackIndexInvalid;
+      std::size_t scratchLast = kTrackIndexInvalid;
+      for (auto it = indices.rbegin(); it != indices.rend(); ++it) {
+        auto ts = trajectory.getTrackState(*it);
+        scratchLast = scratch.addTrackState(
+            copyMask | TrackStatePropMask::Smoothed, scratchLast);
+        scratch.getTrackState(scratchLast).copyFrom(ts, copyMask);
+        if (scratchFirst == kTrackIndexInvalid) {
+          scratchFirst = scratchLast;
+        }
+      }
+
+      auto smoothRes =
+          extensions.smoother(geoContext, scratch, scratchLast, logger());
+      if (!smoothRes.ok()) {
+        return smoothRes.error();
+      }
+      auto first = scratch.getTrackState(scratchFirst);
+      smoothed = first.smoothed();
+      smoothedCovariance = first.smoothedCovariance();
+      return Result<void>::success();
+    }
+
     /// @brief Kalman actor operation: update
     ///
     /// @tparam propagator_state_t is the type of Propagator state
@@ -617,7 +707,8 @@ class KalmanFitter {
         auto trackStateProxyRes = detail::kalmanHandleMeasurement(
             *calibrationContext, state, stepper, extensions, *surface,
             sourcelink_it->second, *result.fittedStates, result.lastTrackIndex,
-            false, logger());
+            false, logger(), freeToBoundCorrection,
+            stateMask(TrackStatePropMask::All));
 
         if (!trackStateProxyRes.ok()) {
           return trackStateProxyRes.error();
@@ -663,7 +754,9 @@ class KalmanFitter {
             surface->surfaceMaterial() != nullptr) {
           auto trackStateProxyRes = detail::kalmanHandleNoMeasurement(
               state, stepper, *surface, *result.fittedStates,
-              result.lastTrackIndex, true, logger(), freeToBoundCorrection);
+              result.lastTrackIndex, true, logger(), freeToBoundCorrection,
+              stateMask(~(TrackStatePropMask::Calibrated |
+                          TrackStatePropMask::Filtered)));
 
           if (!trackStateProxyRes.ok()) {
             return trackStateProxyRes.error();
@@ -746,7 +839,8 @@ class KalmanFitter {
         // Set the trackStateProxy components with the state from the ongoing
         // propagation
         {
-          trackStateProxy.setReferenceSurface(surface->getSharedPtr());
+          // the surfaces of the tracking geometry outlive the track states
+          trackStateProxy.setReferenceSurfaceUnowned(surface);
           // Bind the transported state to the current surface
           auto res = stepper.boundState(state.stepping, *surface, false,
                                         freeToBoundCorrection);
@@ -919,8 +1013,10 @@ class KalmanFitter {
     Result<void> finalize(propagator_state_t& state, const stepper_t& stepper,
                           const navigator_t& navigator,
                           result_type& result) const {
+      const bool smooth = outputPolicy == KalmanFitterOutputPolicy::smoothed;
       // Remember you smoothed the track states
-      result.smoothed = true;
+      result.smoothed = smooth;
+      result.filteredOnly = !smooth;
 
       // Get the indices of the first states (can be either a measurement or
       // material);
@@ -946,17 +1042,20 @@ class KalmanFitter {
         ACTS_ERROR("Smoothing for a track without measurements.");
         return KalmanFitterError::SmoothFailed;
       }
-      // Screen output for debugging
-      ACTS_VERBOSE("Apply smoothing on " << nStates
-                                         << " filtered track states.");
 
-      // Smooth the track states
-      auto smoothRes =
-          extensions.smoother(state.geoContext, *result.fittedStates,
-                              result.lastMeasurementIndex, logger());
-      if (!smoothRes.ok()) {
-        ACTS_ERROR("Smoothing step failed: " << smoothRes.error());
-        return smoothRes.error();
+      if (smooth) {
+        // Screen output for debugging
+        ACTS_VERBOSE("Apply smoothing on " << nStates
+                                           << " filtered track states.");
+
+        // Smooth the track states
+        auto smoothRes =
+            extensions.smoother(state.geoContext, *result.fittedStates,
+                                result.lastMeasurementIndex, logger());
+        if (!smoothRes.ok()) {
+          ACTS_ERROR("Smoothing step failed: " << smoothRes.error());
+          return smoothRes.error();
+        }
       }
 
       // Return in case no target surface
@@ -964,12 +1063,6 @@ class KalmanFitter {
         return Result<void>::success();
       }
 
-      // Obtain the smoothed parameters at first/last measurement state
-      auto firstCreatedState =
-          result.fittedStates->getTrackState(firstStateIndex);
-      auto lastCreatedMeasurement =
-          result.fittedStates->getTrackState(result.lastMeasurementIndex);
-
       // Lambda to get the intersection of the free params on the target surface
       auto target = [&](const FreeVector& freeVector) -> SurfaceIntersection {
         return targetReached.surface
@@ -980,12 +1073,46 @@ class KalmanFitter {
             .closest();
       };
 
-      // The smoothed free params at the first/last measurement state.
+      auto lastCreatedMeasurement =
+          result.fittedStates->getTrackState(result.lastMeasurementIndex);
+      // Obtain the smoothed parameters at the first measurement state
+      auto firstCreatedState =
+          result.fittedStates->getTrackState(firstStateIndex);
+
+      // The smoothed parameters at the first/last measurement state.
       // (the first state can also be a material state)
-      auto firstParams = MultiTrajectoryHelpers::freeSmoothed(
-          state.options.geoContext, firstCreatedState);
-      auto lastParams = MultiTrajectoryHelpers::freeSmoothed(
-          state.options.geoContext, lastCreatedMeasurement);
+      BoundVector firstSmoothed = BoundVector::Zero();
+      BoundSquareMatrix firstSmoothedCovariance = BoundSquareMatrix::Zero();
+      BoundVector lastSmoothed = BoundVector::Zero();
+      BoundSquareMatrix lastSmoothedCovariance = BoundSquareMatrix::Zero();
+      if (smooth) {
+        firstSmoothed = firstCreatedState.smoothed();
+        firstSmoothedCovariance = firstCreatedState.smoothedCovariance();
+        lastSmoothed = lastCreatedMeasurement.smoothed();
+        lastSmoothedCovariance = lastCreatedMeasurement.smoothedCovariance();
+      } else {
+        // The smoothed parameters at the last measurement are the filtered
+        // ones, the ones at the first state are obtained without storing the
+        // smoothed parameters of the states in between
+        lastSmoothed = lastCreatedMeasurement.filtered();
+        lastSmoothedCovariance = lastCreatedMeasurement.filteredCovariance();
+        auto smoothRes =
+            smoothFirstState(state.geoContext, result, firstStateIndex,
+                             firstSmoothed, firstSmoothedCovariance);
+        if (!smoothRes.ok()) {
+          ACTS_ERROR("Smoothing of the first state failed: "
+                     << smoothRes.error());
+          return smoothRes.error();
+        }
+      }
+
+      // The smoothed free params at the first/last measurement state.
+      auto firstParams = detail::transformBoundToFreeParameters(
+          firstCreatedState.referenceSurface(), state.options.geoContext,
+          firstSmoothed);
+      auto lastParams = detail::transformBoundToFreeParameters(
+          lastCreatedMeasurement.referenceSurface(), state.options.geoContext,
+          lastSmoothed);
       // Get the intersections of the smoothed free parameters with the target
       // surface
       const auto firstIntersection = target(firstParams);
@@ -1017,14 +1144,14 @@ class KalmanFitter {
       }
       bool reverseDirection = false;
       if (useFirstTrackState) {
-        stepper.resetState(state.stepping, firstCreatedState.smoothed(),
-                           firstCreatedState.smoothedCovariance(),
+        stepper.resetState(state.stepping, firstSmoothed,
+                           firstSmoothedCovariance,
                            firstCreatedState.referenceSurface(),
                            state.options.maxStepSize);
         reverseDirection = firstIntersection.pathLength() < 0;
       } else {
-        stepper.resetState(state.stepping, lastCreatedMeasurement.smoothed(),
-                           lastCreatedMeasurement.smoothedCovariance(),
+        stepper.resetState(state.stepping, lastSmoothed,
+                           lastSmoothedCovariance,
                            lastCreatedMeasurement.referenceSurface(),
                            state.options.maxStepSize);
         reverseDirection = lastIntersection.pathLength() < 0;
@@ -1140,6 +1267,7 @@ class KalmanFitter {
     kalmanActor.inputMeasurements = &inputMeasurements;
     kalmanActor.targetReached.surface = kfOptions.referenceSurface;
     kalmanActor.targetSurfaceStrategy = kfOptions.referenceSurfaceStrategy;
+    kalmanActor.outputPolicy = kfOptions.outputPolicy;
     kalmanActor.multipleScattering = kfOptions.multipleScattering;
     kalmanActor.energyLoss = kfOptions.energyLoss;
     kalmanActor.reversedFiltering = kfOptions.reversedFiltering;
@@ -1221,6 +1349,7 @@ class KalmanFitter {
     kalmanActor.inputMeasurements = &inputMeasurements;
     kalmanActor.targetReached.surface = kfOptions.referenceSurface;
     kalmanActor.targetSurfaceStrategy = kfOptions.referenceSurfaceStrategy;
+    kalmanActor.outputPolicy = kfOptions.outputPolicy;
     kalmanActor.multipleScattering = kfOptions.multipleScattering;
     kalmanActor.energyLoss = kfOptions.energyLoss;
     kalmanActor.reversedFiltering = kfOptions.reversedFiltering;
@@ -1239,7 +1368,345 @@ class KalmanFitter {
                                                  trackContainer);
   }
 
+  /// Refit a track reusing the transport of a previous fit
+  ///
+  /// The measurements of @p track are calibrated again and the filter and the
+  /// smoother are run without propagation. The predicted parameters are
+  /// linearized around the previous fit with the stored Jacobians
+  ///
+  ///     x_k = x'_k + J_k (x_k-1 - x'_k-1)
+  ///     C_k = C'_k + J_k (C_k-1 - C'_k-1) J_k^T
+  ///
+  /// where the primed predicted and filtered parameters are the ones of the
+  /// previous fit, so that its material effects are kept. Only the transport
+  /// to the reference surface is propagated. If the filtered parameters
+  /// change by more than @c KalmanFitterOptions::refitMaxParameterChange, or
+  /// if the reversed filtering is requested, the track is fitted again with
+  /// full propagation starting from @p sParameters.
+  ///
+  /// @tparam track_proxy_t Type of the track of the previous fit
+  /// @tparam start_parameters_t Type of the initial parameters
+  /// @tparam track_container_t Type of the track container backend
+  /// @tparam holder_t Type defining track container backend ownership
+  ///
+  /// @param track The track of the previous fit
+  /// @param sParameters The initial track parameters for a full refit
+  /// @param kfOptions KalmanOptions steering the fit
+  /// @param trackContainer Input track container storage to append into
+  /// @note The previous fit must have stored the uncalibrated source links
+  /// on its track states.
+  ///
+  /// @return the output as an output track
+  template <typename track_proxy_t, typename start_parameters_t,
+            typename track_container_t, template <typename> class holder_t>
+  auto refit(
+      const track_proxy_t& track, const start_parameters_t& sParameters,
+      const KalmanFitterOptions<traj_t>& kfOptions,
+      TrackContainer<track_container_t, traj_t, holder_t>& trackContainer) const
+      -> Result<typename TrackContainer<track_container_t, traj_t,
+                                        holder_t>::TrackProxy> {
+    // The states of the previous fit in the order of the propagation
+    std::vector<typename track_proxy_t::ConstTrackStateProxy> previousStates;
+    for (const auto trackState : track.trackStatesReversed()) {
+      previousStates.push_back(trackState);
+    }
+    std::reverse(previousStates.begin(), previousStates.end());
+
+    auto isMeasurement = [](const auto& trackState) {
+      return trackState.typeFlags().test(TrackStateFlag::MeasurementFlag) ||
+             trackState.typeFlags().test(TrackStateFlag::OutlierFlag);
+    };
+
+    auto fullRefit = [&]() {
+      std::vector<SourceLink> sourceLinks;
+      std::vector<const Surface*> surfaces;
+      for (const auto& trackState : previousStates) {
+        surfaces.push_back(&trackState.referenceSurface());
+        if (isMeasurement(trackState)) {
+          sourceLinks.push_back(trackState.getUncalibratedSourceLink());
+        }
+      }
+      if constexpr (isDirectNavigator) {
+        return fit(sourceLinks.begin(), sourceLinks.end(), sParameters,
+                   kfOptions, surfaces, trackContainer);
+      } else {
+        return fit(sourceLinks.begin(), sourceLinks.end(), sParameters,
+                   kfOptions, trackContainer);
+      }
+    };
+
+    if (kfOptions.reversedFiltering) {
+      ACTS_VERBOSE("Reversed filtering requested, refit with propagation");
+      return fullRefit();
+    }
+    if (kfOptions.outputPolicy != KalmanFitterOutputPolicy::smoothed) {
+      ACTS_VERBOSE("Filtered output requested, refit with propagation");
+      return fullRefit();
+    }
+    for (const auto& trackState : previousStates) {
+      if (!trackState.hasPredicted() || !trackState.hasFiltered() ||
+          !trackState.hasJacobian() ||
+          (isMeasurement(trackState) &&
+           !trackState.hasUncalibratedSourceLink())) {
+        ACTS_VERBOSE("Previous fit incomplete, refit with propagation");
+        return fullRefit();
+      }
+    }
+
+    const auto& extensions = kfOptions.extensions;
+    const Direction direction = kfOptions.propagatorPlainOptions.direction;
+    // The refit is built in a scratch trajectory and only copied to the
+    // output container on success, so that a fallback to the full refit or
+    // an error does not leave orphaned track states behind
+    traj_t fittedStates;
+
+    std::size_t lastTrackIndex = SIZE_MAX;
+    std::size_t lastMeasurementIndex = SIZE_MAX;
+    std::size_t firstMeasurementIndex = SIZE_MAX;
+    std::size_t measurementStates = 0;
+    // Change of the filtered parameters w.r.t. the previous fit
+    BoundVector deltaParams = BoundVector::Zero();
+    BoundSquareMatrix deltaCovariance = BoundSquareMatrix::Zero();
+
+    for (const auto& previous : previousStates) {
+      const bool hasMeasurement = isMeasurement(previous);
+      TrackStatePropMask mask = TrackStatePropMask::All;
+      if (!hasMeasurement) {
+        mask = ~(TrackStatePropMask::Calibrated | TrackStatePropMask::Filtered);
+      }
+      auto trackState = fittedStates.getTrackState(
+          fittedStates.addTrackState(mask, lastTrackIndex));
+      lastTrackIndex = trackState.index();
+
+      // Linearized prediction around the previous fit
+      const BoundMatrix& jacobian = previous.jacobian();
+      if (previous.ownsReferenceSurface()) {
+        trackState.setReferenceSurface(
+            previous.referenceSurface().getSharedPtr());
+      } else {
+        trackState.setReferenceSurfaceUnowned(&previous.referenceSurface());
+      }
+      trackState.predicted() = previous.predicted() + jacobian * deltaParams;
+      trackState.predictedCovariance() =
+          previous.predictedCovariance() +
+          jacobian * deltaCovariance * jacobian.transpose();
+      trackState.jacobian() = jacobian;
+      trackState.pathLength() = previous.pathLength();
+
+      auto typeFlags = trackState.typeFlags();
+      typeFlags.set(TrackStateFlag::ParameterFlag);
+      if (previous.typeFlags().test(TrackStateFlag::MaterialFlag)) {
+        typeFlags.set(TrackStateFlag::MaterialFlag);
+      }
+
+      if (hasMeasurement) {
+        extensions.calibrator(kfOptions.geoContext,
+                              kfOptions.calibrationContext,
+                              previous.getUncalibratedSourceLink(), trackState);
+        if (!extensions.outlierFinder(trackState)) {
+          auto updateRes = extensions.updater(kfOptions.geoContext, trackState,
+                                              direction, logger());
+          if (!updateRes.ok()) {
+            ACTS_ERROR("Update step failed: " << updateRes.error());
+            return updateRes.error();
+          }
+          typeFlags.set(TrackStateFlag::MeasurementFlag);
+          if (measurementStates == 0) {
+            firstMeasurementIndex = lastTrackIndex;
+          }
+          ++measurementStates;
+        } else {
+          typeFlags.set(TrackStateFlag::OutlierFlag);
+          trackState.shareFrom(trackState, TrackStatePropMask::Predicted,
+                               TrackStatePropMask::Filtered);
+        }
+        lastMeasurementIndex = lastTrackIndex;
+      } else {
+        if (previous.typeFlags().test(TrackStateFlag::HoleFlag)) {
+          typeFlags.set(TrackStateFlag::HoleFlag);
+        }
+        trackState.shareFrom(trackState, TrackStatePropMask::Predicted,
+                             TrackStatePropMask::Filtered);
+      }
+
+      deltaParams = trackState.filtered() - previous.filtered();
+      deltaParams[eBoundPhi] = detail::difference_periodic(
+          trackState.filtered()[eBoundPhi], previous.filtered()[eBoundPhi],
+          2 * M_PI);
+      deltaCovariance =
+          trackState.filteredCovariance() - previous.filteredCovariance();
+
+      const double change = deltaParams.transpose() *
+                            previous.filteredCovariance().inverse() *
+                            deltaParams;
+      if (change > kfOptions.refitMaxParameterChange) {
+        ACTS_VERBOSE("Filtered parameters changed by chi2 "
+                     << change << " on surface "
+                     << previous.referenceSurface().geometryId()
+                     << ", refit with propagation");
+        return fullRefit();
+      }
+    }
+
+    if (measurementStates == 0) {
+      ACTS_ERROR("KalmanFilter failed: no measurement states in the refit");
+      return KalmanFitterError::NoMeasurementFound;
+    }
+
+    if (extensions.reverseFilteringLogic(
+            fittedStates.getTrackState(lastMeasurementIndex))) {
+      ACTS_VERBOSE("Reversed filtering requested, refit with propagation");
+      return fullRefit();
+    }
+
+    auto smoothRes = extensions.smoother(kfOptions.geoContext, fittedStates,
+                                         lastMeasurementIndex, logger());
+    if (!smoothRes.ok()) {
+      ACTS_ERROR("Smoothing step failed: " << smoothRes.error());
+      return smoothRes.error();
+    }
+
+    std::optional<BoundTrackParameters> fittedParameters;
+    if (kfOptions.referenceSurface != nullptr) {
+      auto transportRes = transportToReferenceSurface(
+          fittedStates.getTrackState(firstMeasurementIndex),
+          fittedStates.getTrackState(lastMeasurementIndex),
+          sParameters.particleHypothesis(), kfOptions);
+      if (!transportRes.ok()) {
+        return transportRes.error();
+      }
+      fittedParameters = std::move(*transportRes);
+    }
+
+    // Copy the refitted states to the output container, the filtered
+    // parameters of states without measurement share the predicted ones
+    auto& outputStates = trackContainer.trackStateContainer();
+    std::size_t outputIndex = SIZE_MAX;
+    std::size_t tipIndex = SIZE_MAX;
+    for (std::size_t i = 0; i < fittedStates.size(); ++i) {
+      const auto src = fittedStates.getTrackState(i);
+      const bool sharedFiltered =
+          !src.typeFlags().test(TrackStateFlag::MeasurementFlag);
+      TrackStatePropMask mask = src.getMask();
+      if (sharedFiltered) {
+        mask &= ~TrackStatePropMask::Filtered;
+      }
+      auto dst = outputStates.getTrackState(
+          outputStates.addTrackState(mask, outputIndex));
+      dst.copyFrom(src, mask);
+      if (sharedFiltered) {
+        dst.shareFrom(TrackStatePropMask::Predicted,
+                      TrackStatePropMask::Filtered);
+      }
+      outputIndex = dst.index();
+      if (i == lastMeasurementIndex) {
+        tipIndex = outputIndex;
+      }
+    }
+
+    auto newTrack = trackContainer.getTrack(trackContainer.addTrack());
+    newTrack.tipIndex() = tipIndex;
+
+    if (fittedParameters) {
+      newTrack.parameters() = fittedParameters->parameters();
+      newTrack.covariance() = fittedParameters->covariance().value();
+      newTrack.setReferenceSurface(
+          fittedParameters->referenceSurface().getSharedPtr());
+    }
+
+    calculateTrackQuantities(newTrack);
+
+    if (trackContainer.hasColumn(hashString("smoothed"))) {
+      newTrack.template component<bool, hashString("smoothed")>() = true;
+    }
+
+    if (trackContainer.hasColumn(hashString("reversed"))) {
+      newTrack.template component<bool, hashString("reversed")>() = false;
+    }
+
+    return newTrack;
+  }
+
  private:
+  /// Transport the smoothed parameters of a refit to the reference surface
+  ///
+  /// Chooses the first or the last measurement state like the actor does
+  /// after the smoothing and propagates with the material effects.
+  ///
+  /// @param firstState The first measurement state
+  /// @param lastState The last measurement state
+  /// @param particleHypothesis The particle hypothesis of the track
+  /// @param kfOptions KalmanOptions steering the fit
+  ///
+  /// @return the fitted parameters at the reference surface
+  template <typename track_state_proxy_t>
+  Result<BoundTrackParameters> transportToReferenceSurface(
+      const track_state_proxy_t& firstState,
+      const track_state_proxy_t& lastState,
+      const ParticleHypothesis& particleHypothesis,
+      const KalmanFitterOptions<traj_t>& kfOptions) const {
+    const auto& geoContext = kfOptions.geoContext.get();
+    const auto& plainOptions = kfOptions.propagatorPlainOptions;
+
+    auto target = [&](const auto& trackState) -> SurfaceIntersection {
+      FreeVector freeVector =
+          MultiTrajectoryHelpers::freeSmoothed(geoContext, trackState);
+      return kfOptions.referenceSurface
+          ->intersect(geoContext, freeVector.segment<3>(eFreePos0),
+                      plainOptions.direction * freeVector.segment<3>(eFreeDir0),
+                      BoundaryCheck(true), plainOptions.surfaceTolerance)
+          .closest();
+    };
+    const auto firstIntersection = target(firstState);
+    const auto lastIntersection = target(lastState);
+
+    bool useFirstTrackState = true;
+    switch (kfOptions.referenceSurfaceStrategy) {
+      case KalmanFitterTargetSurfaceStrategy::first:
+        useFirstTrackState = true;
+        break;
+      case KalmanFitterTargetSurfaceStrategy::last:
+        useFirstTrackState = false;
+        break;
+      case KalmanFitterTargetSurfaceStrategy::firstOrLast:
+        useFirstTrackState = std::abs(firstIntersection.pathLength()) <=
+                             std::abs(lastIntersection.pathLength());
+        break;
+      default:
+        ACTS_ERROR("Unknown target surface strategy");
+        return KalmanFitterError::SmoothFailed;
+    }
+    const auto& trackState = useFirstTrackState ? firstState : lastState;
+    const auto& intersection =
+        useFirstTrackState ? firstIntersection : lastIntersection;
+
+    using Actors = ActionList<MaterialInteractor>;
+    PropagatorOptions<Actors, AbortList<>> options(geoContext,
+                                                   kfOptions.magFieldContext);
+    options.setPlainOptions(plainOptions);
+    if (intersection.pathLength() < 0) {
+      options.direction = options.direction.invert();
+    }
+    auto& interactor = options.actionList.template get<MaterialInteractor>();
+    interactor.multipleScattering = kfOptions.multipleScattering;
+    interactor.energyLoss = kfOptions.energyLoss;
+
+    const BoundTrackParameters start(
+        trackState.referenceSurface().getSharedPtr(), trackState.smoothed(),
+        trackState.smoothedCovariance(), particleHypothesis);
+    auto result =
+        m_propagator.propagate(start, *kfOptions.referenceSurface, options);
+    if (!result.ok()) {
+      ACTS_ERROR("Propagation to the reference surface failed: "
+                 << result.error());
+      return result.error();
+    }
+    if (!result->endParameters.has_value()) {
+      return KalmanFitterError::OutputConversionFailed;
+    }
+    return *result->endParameters;
+  }
+
   /// Common fit implementation
   ///
   /// @tparam start_parameters_t Type of the initial parameters
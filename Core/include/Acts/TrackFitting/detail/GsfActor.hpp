@@ -66,6 +66,12 @@ struct GsfResult {
 
   // Internal: component cache to avoid reallocation
   std::vector<GsfComponent> componentCache;
+
+  // Internal: caches for the component convolution to avoid reallocation
+  std::vector<BoundTrackParameters> parentCache;
+  std::vector<double> pathXOverX0Cache;
+  GaussianMixtureBatch mixtureCache;
+  std::vector<double> convolutionCache;
 };
 
 /// The actor carrying out the GSF algorithm
@@ -341,34 +347,107 @@ struct GsfActor {
                            const TemporaryStates& tmpStates,
                            std::vector<ComponentCache>& componentCache,
                            result_type& result) const {
+    auto& parents = result.parentCache;
+    auto& xs = result.pathXOverX0Cache;
+    parents.clear();
+    xs.clear();
+
     auto cmps = stepper.componentIterable(state.stepping);
     double pathXOverX0 = 0.0;
     for (auto [idx, cmp] : zip(tmpStates.tips, cmps)) {
       auto proxy = tmpStates.traj.getTrackState(idx);
 
-      BoundTrackParameters bound(proxy.referenceSurface().getSharedPtr(),
-                                 proxy.filtered(), proxy.filteredCovariance(),
-                                 stepper.particleHypothesis(state.stepping));
+      parents.emplace_back(proxy.referenceSurface().getSharedPtr(),
+                           proxy.filtered(), proxy.filteredCovariance(),
+                           stepper.particleHypothesis(state.stepping));
 
-      pathXOverX0 +=
-          applyBetheHeitler(state, navigator, bound, tmpStates.weights.at(idx),
-                            componentCache, result);
+      xs.push_back(materialPathXOverX0(state, navigator, parents.back(),
+                                       result));
+      pathXOverX0 += xs.back();
     }
 
     // Store average material seen by the components
     // Should not be too broadly distributed
     result.sumPathXOverX0.tmp() += pathXOverX0 / tmpStates.tips.size();
+
+    // Get the mixtures of all components in one go
+    auto& mixtures = result.mixtureCache;
+    detail::evaluateMixtures(*m_cfg.bethe_heitler_approx, xs.data(), xs.size(),
+                             mixtures);
+
+    // Compute the weight, q/p and q/p variance of all combinations of a
+    // component with a mixture component as one batch
+    const std::size_t stride = mixtures.maxComponents;
+    auto& convolution = result.convolutionCache;
+    convolution.resize(3 * parents.size() * stride);
+    double* newWeights = convolution.data();
+    double* newQOverPs = newWeights + parents.size() * stride;
+    double* newVarQOverPs = newQOverPs + parents.size() * stride;
+    const bool forward = state.options.direction == Direction::Forward;
+
+    for (std::size_t k = 0; k < parents.size(); ++k) {
+      const double old_weight = tmpStates.weights.at(tmpStates.tips[k]);
+      const double p_prev = parents[k].absoluteMomentum();
+      const double charge = parents[k].charge();
+      const std::size_t offset = k * stride;
+      for (std::size_t i = offset; i < offset + mixtures.sizes[k]; ++i) {
+        // Here we combine the new child weight with the parent weight.
+        // However, this must be later re-adjusted
+        newWeights[i] = mixtures.weights[i] * old_weight;
+
+        // Components with a vanishing mean are skipped below
+        const double mean = std::max(mixtures.means[i], 1.e-8);
+
+        // compute delta p from mixture and update parameters
+        const double delta_p =
+            forward ? p_prev * (mean - 1.) : p_prev * (1. / mean - 1.);
+        assert(p_prev + delta_p > 0. && "new momentum must be > 0");
+        newQOverPs[i] = charge / (p_prev + delta_p);
+
+        // compute inverse variance of p from mixture
+        const double f = 1. / (p_prev * mean);
+        newVarQOverPs[i] = forward ? f * f * mixtures.vars[i]
+                                   : mixtures.vars[i] / (p_prev * p_prev);
+      }
+    }
+
+    // Create all possible new components
+    for (std::size_t k = 0; k < parents.size(); ++k) {
+      const std::size_t offset = k * stride;
+      for (std::size_t i = offset; i < offset + mixtures.sizes[k]; ++i) {
+        if (newWeights[i] < m_cfg.weightCutoff) {
+          ACTS_VERBOSE("Skip component with weight " << newWeights[i]);
+          continue;
+        }
+
+        if (mixtures.means[i] < 1.e-8) {
+          ACTS_WARNING("Skip component with gaussian "
+                       << mixtures.means[i] << " +- " << mixtures.vars[i]);
+          continue;
+        }
+
+        auto new_pars = parents[k].parameters();
+        new_pars[eBoundQOverP] = newQOverPs[i];
+
+        auto new_cov = parents[k].covariance().value();
+        new_cov(eBoundQOverP, eBoundQOverP) += newVarQOverPs[i];
+        assert(std::isfinite(new_cov(eBoundQOverP, eBoundQOverP)) &&
+               "new cov not finite");
+
+        // Set the remaining things and push to vector
+        componentCache.push_back({newWeights[i], new_pars, new_cov});
+      }
+    }
   }
 
+  /// Path length in the material of the current surface in terms of the
+  /// radiation length
   template <typename propagator_state_t, typename navigator_t>
-  double applyBetheHeitler(const propagator_state_t& state,
-                           const navigator_t& navigator,
-                           const BoundTrackParameters& old_bound,
-                           const double old_weight,
-                           std::vector<ComponentCache>& componentCaches,
-                           result_type& result) const {
+  double materialPathXOverX0(const propagator_state_t& state,
+                             const navigator_t& navigator,
+                             const BoundTrackParameters& old_bound,
+                             result_type& result) const {
     const auto& surface = *navigator.currentSurface(state.navigation);
-    const auto p_prev = old_bound.absoluteMomentum();
 
     // Evaluate material slab
     auto slab = surface.surfaceMaterial()->materialSlab(
@@ -392,60 +471,6 @@ struct GsfActor {
           << pathXOverX0 << " at surface " << surface.geometryId());
     }
 
-    // Get the mixture
-    const auto mixture = m_cfg.bethe_heitler_approx->mixture(pathXOverX0);
-
-    // Create all possible new components
-    for (const auto& gaussian : mixture) {
-      // Here we combine the new child weight with the parent weight.
-      // However, this must be later re-adjusted
-      const auto new_weight = gaussian.weight * old_weight;
-
-      if (new_weight < m_cfg.weightCutoff) {
-        ACTS_VERBOSE("Skip component with weight " << new_weight);
-        continue;
-      }
-
-      if (gaussian.mean < 1.e-8) {
-        ACTS_WARNING("Skip component with gaussian " << gaussian.mean << " +- "
-                                                     << gaussian.var);
-        continue;
-      }
-
-      // compute delta p from mixture and update parameters
-      auto new_pars = old_bound.parameters();
-
-      const auto delta_p = [&]() {
-        if (state.options.direction == Direction::Forward) {
-          return p_prev * (gaussian.mean - 1.);
-        } else {
-          return p_prev * (1. / gaussian.mean - 1.);
-        }
-      }();
-
-      assert(p_prev + delta_p > 0. && "new momentum must be > 0");
-      new_pars[eBoundQOverP] = old_bound.charge() / (p_prev + delta_p);
-
-      // compute inverse variance of p from mixture and update covariance
-      auto new_cov = old_bound.covariance().value();
-
-      const auto varInvP = [&]() {
-        if (state.options.direction == Direction::Forward) {
-          const auto f = 1. / (p_prev * gaussian.mean);
-          return f * f * gaussian.var;
-        } else {
-          return gaussian.var / (p_prev * p_prev);
-        }
-      }();
-
-      new_cov(eBoundQOverP, eBoundQOverP) += varInvP;
-      assert(std::isfinite(new_cov(eBoundQOverP, eBoundQOverP)) &&
-             "new cov not finite");
-
-      // Set the remaining things and push to vector
-      componentCaches.push_back({new_weight, new_pars, new_cov});
-    }
-
     return pathXOverX0;
   }
 
@@ -736,7 +761,8 @@ struct GsfActor {
           result.fittedStates->addTrackState(mask, result.currentTip);
       auto proxy = result.fittedStates->getTrackState(result.currentTip);
 
-      proxy.setReferenceSurface(surface.getSharedPtr());
+      // the surfaces of the tracking geometry outlive the track states
+      proxy.setReferenceSurfaceUnowned(&surface);
       proxy.copyFrom(firstCmpProxy, mask);
 
       auto [prtMean, prtCov] =
@@ -0,0 +1,131 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace Acts::detail {
+
+/// Normal equations of the GX2F with additional parameters
+///
+/// The parameters are split into the global track parameters and blocks of
+/// additional parameters, e.g. the alignment parameters of a surface. A block
+/// couples to the global parameters and to the blocks which are at most
+/// `bandwidth` blocks before or after it, i.e. the matrix
+///
+///     [ G  C^T ]
+///     [ C  L   ]
+///
+/// has a dense border G, C and a block-banded L. Only the non-zero blocks
+/// are stored. The system is solved with a block Cholesky decomposition of L
+/// and the Schur complement S = G - C^T L^-1 C, which scales linearly with
+/// the number of blocks.
+class Gx2fNormalEquations {
+ public:
+  static constexpr std::size_t kNoBlock =
+      std::numeric_limits<std::size_t>::max();
+
+  /// @param nGlobal Number of global parameters
+  /// @param bandwidth Number of neighbouring blocks a block couples to
+  explicit Gx2fNormalEquations(std::size_t nGlobal, std::size_t bandwidth = 0);
+
+  /// Add a block of additional parameters
+  ///
+  /// @param size Number of parameters of the block
+  /// @return the index of the block
+  std::size_t addBlock(std::size_t size);
+
+  std::size_t nGlobal() const { return m_globalVector.size(); }
+  std::size_t bandwidth() const { return m_bandwidth; }
+  std::size_t nBlocks() const { return m_blocks.size(); }
+  std::size_t blockSize(std::size_t k) const {
+    return m_blocks[k].vector.size();
+  }
+
+  /// Add a one-dimensional measurement
+  ///
+  /// @param residual Residual of the measurement
+  /// @param variance Variance of the measurement
+  /// @param globalDerivatives Derivatives w.r.t. the global parameters
+  /// @param block Index of the block the measurement depends on, or kNoBlock
+  /// @param blockDerivatives Derivatives w.r.t. the parameters of the block
+  /// @return the chi2 contribution of the measurement
+  double addMeasurement(double residual, double variance,
+                        const ActsDynamicVector& globalDerivatives,
+                        std::size_t block = kNoBlock,
+                        const ActsDynamicVector& blockDerivatives = {});
+
+  /// Add a Gaussian prior with mean zero on the parameters of a block
+  ///
+  /// @param block Index of the block
+  /// @param variances Prior variances of the parameters
+  /// @param values Current values of the parameters
+  /// @return the chi2 contribution of the prior
+  double addPrior(std::size_t block, const ActsDynamicVector& variances,
+                  const ActsDynamicVector& values);
+
+  /// @name Access to the stored parts of the normal equations
+  /// @{
+  ActsDynamicMatrix& globalMatrix() { return m_globalMatrix; }
+  ActsDynamicVector& globalVector() { return m_globalVector; }
+  /// Coupling of block @p k to the global parameters (C_k)
+  ActsDynamicMatrix& couplingMatrix(std::size_t k) {
+    return m_blocks[k].coupling;
+  }
+  /// Block L_kj with j <= k <= j + bandwidth
+  ActsDynamicMatrix& blockMatrix(std::size_t k, std::size_t j) {
+    return m_blocks[k].band[k - j];
+  }
+  ActsDynamicVector& blockVector(std::size_t k) { return m_blocks[k].vector; }
+  /// @}
+
+  /// Solve the normal equations
+  ///
+  /// @note The stored blocks of L are overwritten by the Cholesky factor
+  ///
+  /// @return false if the system is not positive definite
+  bool solve();
+
+  /// @name Results of the last successful solve()
+  /// @{
+  const ActsDynamicVector& globalDelta() const { return m_globalDelta; }
+  const ActsDynamicVector& blockDelta(std::size_t k) const {
+    return m_blocks[k].delta;
+  }
+  /// Covariance of the global parameters, marginalised over the blocks
+  const ActsDynamicMatrix& globalCovariance() const {
+    return m_globalCovariance;
+  }
+  /// @}
+
+ private:
+  struct Block {
+    ActsDynamicMatrix coupling;
+    ActsDynamicVector vector;
+    /// band[d] holds L_{k,k-d}, the Cholesky factor F after solve()
+    std::vector<ActsDynamicMatrix> band;
+    /// F^-1 [C, b] after the forward substitution
+    ActsDynamicMatrix forward;
+    ActsDynamicVector delta;
+  };
+
+  std::size_t m_bandwidth;
+  ActsDynamicMatrix m_globalMatrix;
+  ActsDynamicVector m_globalVector;
+  std::vector<Block> m_blocks;
+
+  ActsDynamicVector m_globalDelta;
+  ActsDynamicMatrix m_globalCovariance;
+};
+
+}  // namespace Acts::detail
@@ -33,6 +33,7 @@ namespace detail {
 /// @param doCovTransport Whether to perform a covariance transport when
 /// computing the bound state or not
 /// @param freeToBoundCorrection Correction for non-linearity effect during transform from free to bound (only corrected when performing CovTransport)
+/// @param mask The components to allocate for the new state
 template <typename propagator_state_t, typename stepper_t,
           typename extensions_t, typename traj_t>
 auto kalmanHandleMeasurement(
@@ -41,10 +42,11 @@ auto kalmanHandleMeasurement(
     const Surface &surface, const SourceLink &source_link, traj_t &fittedStates,
     const std::size_t lastTrackIndex, bool doCovTransport, const Logger &logger,
     const FreeToBoundCorrection &freeToBoundCorrection = FreeToBoundCorrection(
-        false)) -> Result<typename traj_t::TrackStateProxy> {
+        false),
+    TrackStatePropMask mask = TrackStatePropMask::All)
+    -> Result<typename traj_t::TrackStateProxy> {
   // Add a <mask> TrackState entry multi trajectory. This allocates storage for
-  // all components, which we will set later.
-  TrackStatePropMask mask = TrackStatePropMask::All;
+  // the requested components, which we will set later.
   const std::size_t currentTrackIndex =
       fittedStates.addTrackState(mask, lastTrackIndex);
 
@@ -55,7 +57,8 @@ auto kalmanHandleMeasurement(
   // Set the trackStateProxy components with the state from the ongoing
   // propagation
   {
-    trackStateProxy.setReferenceSurface(surface.getSharedPtr());
+    // the surfaces of the tracking geometry outlive the track states
+    trackStateProxy.setReferenceSurfaceUnowned(&surface);
     // Bind the transported state to the current surface
     auto res = stepper.boundState(state.stepping, surface, doCovTransport,
                                   freeToBoundCorrection);
@@ -135,17 +138,19 @@ auto kalmanHandleMeasurement(
 /// @param doCovTransport Whether to perform a covariance transport when
 /// computing the bound state or not
 /// @param freeToBoundCorrection Correction for non-linearity effect during transform from free to bound (only corrected when performing CovTransport)
+/// @param mask The components to allocate for the new state
 template <typename propagator_state_t, typename stepper_t, typename traj_t>
 auto kalmanHandleNoMeasurement(
     propagator_state_t &state, const stepper_t &stepper, const Surface &surface,
     traj_t &fittedStates, const std::size_t lastTrackIndex, bool doCovTransport,
     const Logger &logger,
     const FreeToBoundCorrection &freeToBoundCorrection = FreeToBoundCorrection(
-        false)) -> Result<typename traj_t::TrackStateProxy> {
+        false),
+    TrackStatePropMask mask =
+        ~(TrackStatePropMask::Calibrated | TrackStatePropMask::Filtered))
+    -> Result<typename traj_t::TrackStateProxy> {
   // Add a <mask> TrackState entry multi trajectory. This allocates storage for
-  // all components, which we will set later.
-  TrackStatePropMask mask =
-      ~(TrackStatePropMask::Calibrated | TrackStatePropMask::Filtered);
+  // the requested components, which we will set later.
   const std::size_t currentTrackIndex =
       fittedStates.addTrackState(mask, lastTrackIndex);
 
@@ -156,7 +161,8 @@ auto kalmanHandleNoMeasurement(
   // Set the trackStateProxy components with the state from the ongoing
   // propagation
   {
-    trackStateProxy.setReferenceSurface(surface.getSharedPtr());
+    // the surfaces of the tracking geometry outlive the track states
+    trackStateProxy.setReferenceSurfaceUnowned(&surface);
     // Bind the transported state to the current surface
     auto res = stepper.boundState(state.stepping, surface, doCovTransport,
                                   freeToBoundCorrection);
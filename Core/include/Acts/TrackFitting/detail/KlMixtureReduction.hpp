@@ -0,0 +1,176 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/TrackFitting/GsfOptions.hpp"
+#include "Acts/TrackFitting/detail/SymmetricKlDistanceMatrix.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace Acts::detail {
+
+/// @brief Greedy KL-distance mixture reduction with a heap of candidate pairs
+///
+/// Merges the pairs in the same order as the reduction with the
+/// @ref SymmetricKLDistanceMatrix, i.e. always the pair with the smallest
+/// symmetric KL-distance in q/p, ties resolved by the lower pair index.
+/// Instead of scanning all pairs after each merge, the candidate pairs are
+/// kept in a min-heap. Pairs involving a merged or removed component are
+/// not erased but skipped once they are popped. The buffers are kept
+/// between calls, so one instance should be reused.
+class KLDistanceMixtureReducer {
+ public:
+  /// Reduce the mixture to @p maxCmpsAfterMerge components
+  ///
+  /// @param cmps the components, modified in place
+  /// @param maxCmpsAfterMerge the number of components we want to reach
+  /// @param desc the angle description of the surface
+  template <typename angle_desc_t>
+  void reduce(std::vector<GsfComponent> &cmps, std::size_t maxCmpsAfterMerge,
+              const angle_desc_t &desc) {
+    const std::size_t n = cmps.size();
+    if (n <= maxCmpsAfterMerge) {
+      return;
+    }
+    const auto proj = [](auto &a) -> decltype(auto) { return a; };
+
+    m_qOverP.resize(n);
+    m_var.resize(n);
+    m_invVar.resize(n);
+    m_lastModified.assign(n, 0);
+    for (std::size_t i = 0; i < n; ++i) {
+      project(cmps[i], i);
+    }
+
+    // All pairs (i, j) with j < i, in the order of the distance matrix
+    m_heap.clear();
+    m_heap.reserve(n * (n - 1) / 2);
+    m_row.resize(n);
+    for (std::size_t i = 1; i < n; ++i) {
+      computeRow(i, i);
+      for (std::size_t j = 0; j < i; ++j) {
+        m_heap.push_back({m_row[j], pairIndex(i, j), i, j, 0});
+      }
+    }
+    std::make_heap(m_heap.begin(), m_heap.end(), std::greater<>{});
+
+    std::size_t remaining = n;
+    std::size_t nMerges = 0;
+    while (remaining > maxCmpsAfterMerge) {
+      assert(!m_heap.empty() && "ran out of candidate pairs");
+      std::pop_heap(m_heap.begin(), m_heap.end(), std::greater<>{});
+      const Candidate best = m_heap.back();
+      m_heap.pop_back();
+      if (!isValid(cmps, best)) {
+        continue;
+      }
+
+      // Merge into the component with the larger index like the distance
+      // matrix reduction, and label the other one for removal
+      const std::size_t i = best.i;
+      const std::size_t j = best.j;
+      cmps[i] = mergeComponents(cmps[i], cmps[j], proj, desc);
+      cmps[j].weight = -1.0;
+      ++nMerges;
+      --remaining;
+      m_lastModified[i] = nMerges;
+      project(cmps[i], i);
+
+      if (remaining <= maxCmpsAfterMerge) {
+        break;
+      }
+
+      // New candidates for the merged component
+      computeRow(i, n);
+      for (std::size_t k = 0; k < n; ++k) {
+        if (k == i || cmps[k].weight == -1.0) {
+          continue;
+        }
+        const std::size_t hi = std::max(i, k);
+        const std::size_t lo = std::min(i, k);
+        m_heap.push_back({m_row[k], pairIndex(hi, lo), hi, lo, nMerges});
+        std::push_heap(m_heap.begin(), m_heap.end(), std::greater<>{});
+      }
+    }
+
+    // Remove all components which are labeled with weight -1
+    std::sort(cmps.begin(), cmps.end(), [&](const auto &a, const auto &b) {
+      return a.weight < b.weight;
+    });
+    cmps.erase(std::remove_if(cmps.begin(), cmps.end(),
+                              [&](const auto &a) { return a.weight == -1.0; }),
+               cmps.end());
+
+    assert(cmps.size() == maxCmpsAfterMerge && "size mismatch");
+  }
+
+ private:
+  struct Candidate {
+    ActsScalar distance;
+    std::size_t index;
+    std::size_t i;
+    std::size_t j;
+    // Number of merges done when the distance was computed
+    std::size_t stamp;
+
+    bool operator>(const Candidate &other) const {
+      return distance > other.distance ||
+             (distance == other.distance && index > other.index);
+    }
+  };
+
+  static std::size_t pairIndex(std::size_t i, std::size_t j) {
+    return i * (i - 1) / 2 + j;
+  }
+
+  void project(const GsfComponent &cmp, std::size_t i) {
+    m_qOverP[i] = cmp.boundPars[eBoundQOverP];
+    m_var[i] = cmp.boundCov(eBoundQOverP, eBoundQOverP);
+    assert(m_var[i] != 0.0 && std::isfinite(m_var[i]));
+    m_invVar[i] = 1 / m_var[i];
+  }
+
+  /// Distances of component @p i to the components [0, @p end), written
+  /// to the row buffer. Same expression as computeSymmetricKlDivergence.
+  void computeRow(std::size_t i, std::size_t end) {
+    const ActsScalar qi = m_qOverP[i];
+    const ActsScalar vi = m_var[i];
+    const ActsScalar ivi = m_invVar[i];
+    const ActsScalar *qOverP = m_qOverP.data();
+    const ActsScalar *var = m_var.data();
+    const ActsScalar *invVar = m_invVar.data();
+    ActsScalar *row = m_row.data();
+    for (std::size_t j = 0; j < end; ++j) {
+      const ActsScalar d = qi - qOverP[j];
+      row[j] = vi * invVar[j] + var[j] * ivi + d * (ivi + invVar[j]) * d;
+    }
+  }
+
+  bool isValid(const std::vector<GsfComponent> &cmps,
+               const Candidate &c) const {
+    return cmps[c.i].weight != -1.0 && cmps[c.j].weight != -1.0 &&
+           c.stamp >= m_lastModified[c.i] && c.stamp >= m_lastModified[c.j];
+  }
+
+  std::vector<ActsScalar> m_qOverP;
+  std::vector<ActsScalar> m_var;
+  std::vector<ActsScalar> m_invVar;
+  std::vector<ActsScalar> m_row;
+  std::vector<std::size_t> m_lastModified;
+  std::vector<Candidate> m_heap;
+};
+
+}  // namespace Acts::detail
@@ -0,0 +1,118 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+namespace Acts {
+
+/// Number of heap allocations and allocated bytes.
+///
+/// The counters are only filled if the global `operator new` is replaced by
+/// the counting version in
+/// `Acts/Utilities/detail/CountingAllocationOperators.hpp`. This is the case
+/// if the library was built with `ACTS_ENABLE_ALLOCATION_COUNTING`, or if the
+/// executable includes that header itself. Otherwise all counts stay zero.
+struct AllocationCount {
+  std::uint64_t allocations = 0;
+  std::uint64_t deallocations = 0;
+  std::uint64_t bytes = 0;
+
+  AllocationCount& operator+=(const AllocationCount& other) {
+    allocations += other.allocations;
+    deallocations += other.deallocations;
+    bytes += other.bytes;
+    return *this;
+  }
+
+  AllocationCount& operator-=(const AllocationCount& other) {
+    allocations -= other.allocations;
+    deallocations -= other.deallocations;
+    bytes -= other.bytes;
+    return *this;
+  }
+
+  friend AllocationCount operator+(AllocationCount lhs,
+                                   const AllocationCount& rhs) {
+    lhs += rhs;
+    return lhs;
+  }
+
+  friend AllocationCount operator-(AllocationCount lhs,
+                                   const AllocationCount& rhs) {
+    lhs -= rhs;
+    return lhs;
+  }
+
+  friend std::ostream& operator<<(std::ostream& os,
+                                  const AllocationCount& count) {
+    os << count.allocations << " allocations, " << count.deallocations
+       << " deallocations, " << count.bytes << " bytes";
+    return os;
+  }
+};
+
+/// Whether a counting operator new is installed in this program.
+bool allocationCountingEnabled();
+
+/// Allocations performed by the calling thread since it was started.
+AllocationCount threadAllocationCount();
+
+/// Allocations performed by all threads since program start.
+AllocationCount globalAllocationCount();
+
+namespace detail {
+/// Record an allocation of @p size bytes, called by the counting operator new
+void countAllocation(std::size_t size) noexcept;
+/// Record a deallocation, called by the counting operator delete
+void countDeallocation() noexcept;
+}  // namespace detail
+
+/// Count the allocations of the calling thread within a scope.
+///
+/// Only allocations on the thread that created the counter are considered,
+/// so multiple counters can be used concurrently on different threads, e.g.
+/// to measure per-algorithm and per-event allocations in a parallel event
+/// loop. Work that is dispatched to other threads within the scope is not
+/// accounted for.
+///
+/// @code
+/// ScopedAllocationCounter counter;
+/// doWork();
+/// std::cout << counter.count() << std::endl;
+/// @endcode
+class ScopedAllocationCounter {
+ public:
+  /// Start counting.
+  ///
+  /// @param sink Optional destination to which the allocations within the
+  ///        scope are added on destruction
+  explicit ScopedAllocationCounter(AllocationCount* sink = nullptr)
+      : m_start(threadAllocationCount()), m_sink(sink) {}
+
+  ScopedAllocationCounter(const ScopedAllocationCounter&) = delete;
+  ScopedAllocationCounter& operator=(const ScopedAllocationCounter&) = delete;
+
+  ~ScopedAllocationCounter() {
+    if (m_sink != nullptr) {
+      *m_sink += count();
+    }
+  }
+
+  /// Allocations performed since the counter was created.
+  AllocationCount count() const { return threadAllocationCount() - m_start; }
+
+ private:
+  AllocationCount m_start;
+  AllocationCount* m_sink;
+};
+
+}  // namespace Acts
@@ -0,0 +1,50 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace Acts {
+
+/// Function processing the items in the range [begin, end).
+using ParallelForBody = std::function<void(std::size_t, std::size_t)>;
+
+/// Executor for a loop over independent items.
+///
+/// Acts does not depend on a threading library. Algorithms that can process
+/// independent items concurrently accept an executor instead, which is called
+/// with the total number of items and the loop body. The executor may split
+/// the items into any number of contiguous ranges and call the body for
+/// these ranges concurrently, e.g. using `tbb::parallel_for` with a
+/// `tbb::blocked_range`. It must only return once all items were processed.
+using ParallelForExecutor =
+    std::function<void(std::size_t, const ParallelForBody&)>;
+
+/// Process the items [0, size) with an executor.
+///
+/// The items are processed sequentially in a single range if no executor is
+/// set or if there is at most one item.
+///
+/// @param executor The executor, can be empty
+/// @param size Number of items
+/// @param body Function processing a range of items
+inline void parallelFor(const ParallelForExecutor& executor, std::size_t size,
+                        const ParallelForBody& body) {
+  if (size == 0) {
+    return;
+  }
+  if (!executor || size == 1) {
+    body(0, size);
+    return;
+  }
+  executor(size, body);
+}
+
+}  // namespace Acts
@@ -0,0 +1,99 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+// Replacement global allocation functions which feed the counters of
+// `Acts/Utilities/AllocationCounter.hpp`.
+//
+// This header defines non-inline functions and must be included in exactly
+// one translation unit of a program. ActsCore does this itself if it is built
+// with `ACTS_ENABLE_ALLOCATION_COUNTING`, an executable can do it to count its
+// allocations independently of the library configuration. The array forms
+// forward to the scalar forms by default and do not need to be replaced.
+
+#include "Acts/Utilities/AllocationCounter.hpp"
+
+#include <cstdlib>
+#include <new>
+
+namespace Acts::detail {
+
+inline void* countedAllocate(std::size_t size) noexcept {
+  countAllocation(size);
+  return std::malloc(size == 0 ? 1 : size);
+}
+
+inline void* countedAllocate(std::size_t size, std::align_val_t al) noexcept {
+  countAllocation(size);
+  const auto alignment = static_cast<std::size_t>(al);
+  // aligned_alloc requires the size to be a multiple of the alignment
+  const std::size_t padded = ((size + alignment - 1) / alignment) * alignment;
+  return std::aligned_alloc(alignment, padded == 0 ? alignment : padded);
+}
+
+inline void countedDeallocate(void* ptr) noexcept {
+  if (ptr == nullptr) {
+    return;
+  }
+  countDeallocation();
+  std::free(ptr);
+}
+
+}  // namespace Acts::detail
+
+void* operator new(std::size_t size) {
+  void* ptr = Acts::detail::countedAllocate(size);
+  if (ptr == nullptr) {
+    throw std::bad_alloc{};
+  }
+  return ptr;
+}
+
+void* operator new(std::size_t size, const std::nothrow_t& /*tag*/) noexcept {
+  return Acts::detail::countedAllocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t al) {
+  void* ptr = Acts::detail::countedAllocate(size, al);
+  if (ptr == nullptr) {
+    throw std::bad_alloc{};
+  }
+  return ptr;
+}
+
+void* operator new(std::size_t size, std::align_val_t al,
+                   const std::nothrow_t& /*tag*/) noexcept {
+  return Acts::detail::countedAllocate(size, al);
+}
+
+void operator delete(void* ptr) noexcept {
+  Acts::detail::countedDeallocate(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept {
+  Acts::detail::countedDeallocate(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t& /*tag*/) noexcept {
+  Acts::detail::countedDeallocate(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t /*al*/) noexcept {
+  Acts::detail::countedDeallocate(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/,
+                     std::align_val_t /*al*/) noexcept {
+  Acts::detail::countedDeallocate(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t /*al*/,
+                     const std::nothrow_t& /*tag*/) noexcept {
+  Acts::detail::countedDeallocate(ptr);
+}
@@ -12,7 +12,8 @@
 #include "Acts/EventData/TrackParameters.hpp"
 #include "Acts/Vertexing/Vertex.hpp"
 
-#include <map>
+#include <cstddef>
+#include <vector>
 
 namespace Acts {
 
@@ -48,7 +49,9 @@ struct VertexInfo {
   // Vector of all tracks that are currently assigned to vertex
   std::vector<const input_track_t*> trackLinks;
 
-  std::map<const input_track_t*, const BoundTrackParameters> impactParams3D;
+  // Indices of the track-vertex links in the fitter state, parallel to
+  // trackLinks
+  std::vector<std::size_t> links;
 };
 
 }  // namespace Acts
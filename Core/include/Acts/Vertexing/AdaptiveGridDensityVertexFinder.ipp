@@ -24,7 +24,7 @@ auto Acts::AdaptiveGridDensityVertexFinder<
         continue;
       }
       couldRemoveTracks = true;
-      auto trackDensityMap = state.trackDensities.at(trk);
+      const auto& trackDensityMap = state.trackDensities.at(trk);
       m_cfg.gridDensity.subtractTrack(trackDensityMap, state.mainDensityMap);
     }
     if (!couldRemoveTracks) {
@@ -50,7 +50,7 @@ auto Acts::AdaptiveGridDensityVertexFinder<
           m_cfg.gridDensity.addTrack(trkParams, state.mainDensityMap);
       // Cache track density contribution to main grid if enabled
       if (m_cfg.cacheGridStateForTrackRemoval) {
-        state.trackDensities[trk] = trackDensityMap;
+        state.trackDensities[trk] = std::move(trackDensityMap);
         state.trackSelectionMap[trk] = true;
       }
     }
@@ -10,8 +10,11 @@
 #include "Acts/Definitions/Algebra.hpp"
 #include "Acts/EventData/TrackParameters.hpp"
 #include "Acts/Utilities/Result.hpp"
+#include "Acts/Vertexing/SparseDensityMap.hpp"
 
+#include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 #include <boost/functional/hash.hpp>
 
@@ -28,12 +31,17 @@ namespace Acts {
 /// Single tracks can be cached and removed from the overall density.
 /// Unlike in the GaussianGridTrackDensity, the overall density map
 /// grows adaptively when tracks densities are added to the grid.
+/// By default, the density map is stored in a flat sorted array that keeps
+/// track of its maximum, see SparseDensityMap.
 ///
 /// @tparam spatialTrkGridSize Number of bins per track in z direction
 /// @tparam temporalTrkGridSize Number of bins per track in t direction
+/// @tparam density_map_t Storage of the density map, either the flat
+/// SparseDensityMap or a std::unordered_map between bins and densities
 /// @note In total, a track is represented by a grid of size
 /// spatialTrkGridSize * temporalTrkGridSize
-template <int spatialTrkGridSize = 15, int temporalTrkGridSize = 1>
+template <int spatialTrkGridSize = 15, int temporalTrkGridSize = 1,
+          typename density_map_t = SparseDensityMap>
 class AdaptiveGridTrackDensity {
   // Assert odd spatial and temporal track grid size
   static_assert(spatialTrkGridSize % 2);
@@ -43,7 +51,7 @@ class AdaptiveGridTrackDensity {
   // The first (second) integer indicates the bin's z (t) position
   using Bin = std::pair<int, int>;
   // Mapping between bins and track densities
-  using DensityMap = std::unordered_map<Bin, float, boost::hash<Bin>>;
+  using DensityMap = density_map_t;
   // Coordinates in the z-t plane; the t value will be set to 0 if time
   // vertex seeding is disabled
   using ZTPosition = std::pair<float, float>;
@@ -114,7 +122,7 @@ class AdaptiveGridTrackDensity {
   /// @param densityMap Map between bins and corresponding density
   /// values
   /// @return Iterator of the map entry with the highest density
-  DensityMap::const_iterator highestDensityEntry(
+  typename DensityMap::const_iterator highestDensityEntry(
       const DensityMap& densityMap) const;
 
   /// @brief Returns the z and t coordinate of maximum (surrounding)
@@ -182,19 +190,15 @@ class AdaptiveGridTrackDensity {
   Result<float> estimateSeedWidth(const DensityMap& densityMap,
                                   const ZTPosition& maxZT) const;
 
-  /// @brief Helper to retrieve values of an nDim-dimensional normal
-  /// distribution
-  /// @note The constant prefactor (2 * pi)^(- nDim / 2) is discarded
+  /// @brief Finds the maximum density of a DensityMap, ignoring some bins
   ///
-  /// @param args Coordinates where the Gaussian should be evaluated
-  /// @note args must be in a coordinate system with origin at the mean
-  /// values of the Gaussian
-  /// @param cov Covariance matrix
+  /// @param densityMap Map between bins and corresponding density values
+  /// @param excluded Bins that are ignored
   ///
-  /// @return Multivariate Gaussian evaluated at args
-  template <unsigned int nDim>
-  static float multivariateGaussian(const Acts::ActsVector<nDim>& args,
-                                    const Acts::ActsSquareMatrix<nDim>& cov);
+  /// @return Iterator of the map entry with the highest density among the
+  /// remaining bins or end() if there are none
+  static typename DensityMap::const_iterator highestDensityEntryExcluding(
+      const DensityMap& densityMap, const std::vector<Bin>& excluded);
 
   /// @brief Checks (up to) first three density maxima that have a
   /// maximum relative deviation of 'relativeDensityDev' from the
@@ -204,16 +208,21 @@ class AdaptiveGridTrackDensity {
   /// @param densityMap Map between bins and corresponding density values
   ///
   /// @return The bin corresponding to the highest surrounding density
-  Bin highestDensitySumBin(DensityMap& densityMap) const;
+  Bin highestDensitySumBin(const DensityMap& densityMap) const;
 
   /// @brief Calculates the density sum of a bin and its two neighboring bins
   /// in z direction
   ///
   /// @param densityMap Map between bins and corresponding density values
   /// @param bin Bin whose neighbors in z we want to sum up
+  /// @param excluded Neighboring bins that are treated as empty
   ///
   /// @return The density sum
-  float getDensitySum(const DensityMap& densityMap, const Bin& bin) const;
+  float getDensitySum(const DensityMap& densityMap, const Bin& bin,
+                      const std::vector<Bin>& excluded = {}) const;
+
+  static constexpr bool s_sparseDensityMap =
+      std::is_same_v<DensityMap, SparseDensityMap>;
 
   Config m_cfg;
 };
@@ -10,37 +10,48 @@
 
 #include <algorithm>
 
-template <int spatialTrkGridSize, int temporalTrkGridSize>
+template <int spatialTrkGridSize, int temporalTrkGridSize,
+          typename density_map_t>
 float Acts::AdaptiveGridTrackDensity<
-    spatialTrkGridSize, temporalTrkGridSize>::getBinCenter(int bin,
-                                                           float binExtent) {
+    spatialTrkGridSize, temporalTrkGridSize,
+    density_map_t>::getBinCenter(int bin, float binExtent) {
   return bin * binExtent;
 }
 
-template <int spatialTrkGridSize, int temporalTrkGridSize>
+template <int spatialTrkGridSize, int temporalTrkGridSize,
+          typename density_map_t>
 int Acts::AdaptiveGridTrackDensity<
-    spatialTrkGridSize, temporalTrkGridSize>::getBin(float value,
-                                                     float binExtent) {
+    spatialTrkGridSize, temporalTrkGridSize,
+    density_map_t>::getBin(float value, float binExtent) {
   return static_cast<int>(std::floor(value / binExtent - 0.5) + 1);
 }
 
-template <int spatialTrkGridSize, int temporalTrkGridSize>
+template <int spatialTrkGridSize, int temporalTrkGridSize,
+          typename density_map_t>
 typename Acts::AdaptiveGridTrackDensity<
-    spatialTrkGridSize, temporalTrkGridSize>::DensityMap::const_iterator
-Acts::AdaptiveGridTrackDensity<spatialTrkGridSize, temporalTrkGridSize>::
+    spatialTrkGridSize, temporalTrkGridSize,
+    density_map_t>::DensityMap::const_iterator
+Acts::AdaptiveGridTrackDensity<spatialTrkGridSize, temporalTrkGridSize,
+                               density_map_t>::
     highestDensityEntry(const DensityMap& densityMap) const {
-  auto maxEntry = std::max_element(
-      std::begin(densityMap), std::end(densityMap),
-      [](const auto& densityEntry1, const auto& densityEntry2) {
-        return densityEntry1.second < densityEntry2.second;
-      });
-  return maxEntry;
+  if constexpr (s_sparseDensityMap) {
+    return densityMap.maxEntry();
+  } else {
+    auto maxEntry = std::max_element(
+        std::begin(densityMap), std::end(densityMap),
+        [](const auto& densityEntry1, const auto& densityEntry2) {
+          return densityEntry1.second < densityEntry2.second;
+        });
+    return maxEntry;
+  }
 }
 
-template <int spatialTrkGridSize, int temporalTrkGridSize>
+template <int spatialTrkGridSize, int temporalTrkGridSize,
+          typename density_map_t>
 Acts::Result<typename Acts::AdaptiveGridTrackDensity<
-    spatialTrkGridSize, temporalTrkGridSize>::ZTPosition>
-Acts::AdaptiveGridTrackDensity<spatialTrkGridSize, temporalTrkGridSize>::
+    spatialTrkGridSize, temporalTrkGridSize, density_map_t>::ZTPosition>
+Acts::AdaptiveGridTrackDensity<spatialTrkGridSize, temporalTrkGridSize,
+                               density_map_t>::
     getMaxZTPosition(DensityMap& densityMap) const {
   if (densityMap.empty()) {
     return VertexingError::EmptyInput;
@@ -69,10 +80,12 @@ Acts::AdaptiveGridTrackDensity<spatialTrkGridSize, temporalTrkGridSize>::
   return maxValues;
 }
 
-template <int spatialTrkGridSize, int temporalTrkGridSize>
+template <int spatialTrkGridSize, int temporalTrkGridSize,
+          typename density_map_t>
 Acts::Result<typename Acts::AdaptiveGridTrackDensity<
-    spatialTrkGridSize, temporalTrkGridSize>::ZTPositionAndWidth>
-Acts::AdaptiveGridTrackDensity<spatialTrkGridSize, temporalTrkGridSize>::
+    spatialTrkGridSize, temporalTrkGridSize, density_map_t>::ZTPositionAndWidth>
+Acts::AdaptiveGridTrackDensity<spatialTrkGridSize, temporalTrkGridSize,
+                               density_map_t>::
     getMaxZTPositionAndWidth(DensityMap& densityMap) const {
   // Get z value where the density is the highest
   auto maxZTRes = getMaxZTPosition(densityMap);
@@ -91,10 +104,12 @@ Acts::AdaptiveGridTrackDensity<spatialTrkGridSize, temporalTrkGridSize>::
   return maxZTAndWidth;
 }
 
-template <int spatialTrkGridSize, int temporalTrkGridSize>
-typename Acts::AdaptiveGridTrackDensity<spatialTrkGridSize,
-                                        temporalTrkGridSize>::DensityMap
-Acts::AdaptiveGridTrackDensity<spatialTrkGridSize, temporalTrkGridSize>::
+template <int spatialTrkGridSize, int temporalTrkGridSize,
+          typename density_map_t>
+typename Acts::AdaptiveGridTrackDensity<spatialTrkGridSize, temporalTrkGridSize,
+                                        density_map_t>::DensityMap
+Acts::AdaptiveGridTrackDensity<spatialTrkGridSize, temporalTrkGridSize,
+                               density_map_t>::
     addTrack(const Acts::BoundTrackParameters& trk,
              DensityMap& mainDensityMap) const {
   ActsVector<3> impactParams = trk.impactParameters();
@@ -121,36 +136,47 @@ Acts::AdaptiveGridTrackDensity<spatialTrkGridSize, temporalTrkGridSize>::
 
   DensityMap trackDensityMap = createTrackGrid(impactParams, centralBin, cov);
 
-  for (const auto& densityEntry : trackDensityMap) {
-    Bin bin = densityEntry.first;
-    float trackDensity = densityEntry.second;
-    // Check if z bin is already part of the main grid
-    if (mainDensityMap.count(bin) == 1) {
-      mainDensityMap.at(bin) += trackDensity;
-    } else {
-      mainDensityMap[bin] = trackDensity;
+  if constexpr (s_sparseDensityMap) {
+    // Merge the sorted track densities in a single pass
+    mainDensityMap.accumulate(trackDensityMap);
+  } else {
+    for (const auto& densityEntry : trackDensityMap) {
+      // Bins that are not part of the main grid yet are default initialized
+      mainDensityMap[densityEntry.first] += densityEntry.second;
     }
   }
 
   return trackDensityMap;
 }
 
-template <int spatialTrkGridSize, int temporalTrkGridSize>
-void Acts::AdaptiveGridTrackDensity<spatialTrkGridSize, temporalTrkGridSize>::
+template <int spatialTrkGridSize, int temporalTrkGridSize,
+          typename density_map_t>
+void Acts::AdaptiveGridTrackDensity<spatialTrkGridSize, temporalTrkGridSize,
+                                    density_map_t>::
     subtractTrack(const DensityMap& trackDensityMap,
                   DensityMap& mainDensityMap) const {
-  for (auto it = trackDensityMap.begin(); it != trackDensityMap.end(); it++) {
-    mainDensityMap.at(it->first) -= it->second;
+  if constexpr (s_sparseDensityMap) {
+    mainDensityMap.accumulate(trackDensityMap, -1.f);
+  } else {
+    for (auto it = trackDensityMap.begin(); it != trackDensityMap.end();
+         it++) {
+      mainDensityMap.at(it->first) -= it->second;
+    }
   }
 }
 
-template <int spatialTrkGridSize, int temporalTrkGridSize>
-typename Acts::AdaptiveGridTrackDensity<spatialTrkGridSize,
-                                        temporalTrkGridSize>::DensityMap
-Acts::AdaptiveGridTrackDensity<spatialTrkGridSize, temporalTrkGridSize>::
+template <int spatialTrkGridSize, int temporalTrkGridSize,
+          typename density_map_t>
+typename Acts::AdaptiveGridTrackDensity<spatialTrkGridSize, temporalTrkGridSize,
+                                        density_map_t>::DensityMap
+Acts::AdaptiveGridTrackDensity<spatialTrkGridSize, temporalTrkGridSize,
+                               density_map_t>::
     createTrackGrid(const Acts::Vector3& impactParams, const Bin& centralBin,
                     const Acts::SquareMatrix3& cov) const {
   DensityMap trackDensityMap;
+  if constexpr (s_sparseDensityMap) {
+    trackDensityMap.reserve(spatialTrkGridSize * temporalTrkGridSize);
+  }
 
   int halfSpatialTrkGridSize = (spatialTrkGridSize - 1) / 2;
   int firstZBin = centralBin.first - halfSpatialTrkGridSize;
@@ -159,39 +185,59 @@ Acts::AdaptiveGridTrackDensity<spatialTrkGridSize, temporalTrkGridSize>::
   int halfTemporalTrkGridSize = (temporalTrkGridSize - 1) / 2;
   int firstTBin = centralBin.second - halfTemporalTrkGridSize;
 
+  // The track is modelled by a 2D (d-z) or 3D (d-z-t) Gaussian whose
+  // inverse covariance and normalization are the same for all bins. The
+  // time components are set to 0 if we don't do vertex time seeding.
+  Acts::SquareMatrix3 invCov = Acts::SquareMatrix3::Zero();
+  double norm = 0.;
+  if constexpr (temporalTrkGridSize == 1) {
+    invCov.topLeftCorner<2, 2>() = cov.topLeftCorner<2, 2>().inverse();
+    norm = 1. / std::sqrt(cov.topLeftCorner<2, 2>().determinant());
+  } else {
+    invCov = cov.inverse();
+    norm = 1. / std::sqrt(cov.determinant());
+  }
+
+  // The Gaussian is evaluated at d = 0 for a full row of z bins at once
+  using ZRow = Eigen::Array<double, spatialTrkGridSize, 1>;
+  ZRow dz;
+  for (int j = 0; j < spatialTrkGridSize; j++) {
+    dz[j] = getBinCenter(firstZBin + j, m_cfg.spatialBinExtent);
+  }
+  dz -= impactParams(1);
+  const double dd = -impactParams(0);
+  constexpr double minExponent = -ExpSafeLimit<double>::value;
+
   // Loop over bins
   for (int i = 0; i < temporalTrkGridSize; i++) {
     int tBin = firstTBin + i;
-    // If we don't do vertex time seeding, we set the time to 0 since it will be
-    // discarded in the for loop below anyways
-    float t = 0;
+    double dt = 0.;
     if constexpr (temporalTrkGridSize > 1) {
-      t = getBinCenter(tBin, m_cfg.temporalBinExtent);
+      dt = getBinCenter(tBin, m_cfg.temporalBinExtent) - impactParams(2);
     }
+    // Exponent as a quadratic polynomial in dz
+    const double c0 = invCov(0, 0) * dd * dd +
+                      2. * invCov(0, 2) * dd * dt + invCov(2, 2) * dt * dt;
+    const double c1 = 2. * (invCov(0, 1) * dd + invCov(1, 2) * dt);
+    const ZRow expo = -0.5 * ((invCov(1, 1) * dz + c1) * dz + c0);
+    // Underflowing values are set to 0, see safeExp
+    const ZRow density =
+        norm * (expo < minExponent).select(ZRow::Zero(), expo.exp());
+
     for (int j = 0; j < spatialTrkGridSize; j++) {
-      int zBin = firstZBin + j;
-      float z = getBinCenter(zBin, m_cfg.spatialBinExtent);
-      // Bin coordinates in the d-z-t plane
-      Acts::Vector3 binCoords(0., z, t);
-      // Transformation to coordinate system with origin at the track center
-      binCoords -= impactParams;
-      Bin bin = std::make_pair(zBin, tBin);
-      if constexpr (temporalTrkGridSize == 1) {
-        trackDensityMap[bin] = multivariateGaussian<2>(
-            binCoords.head<2>(), cov.topLeftCorner<2, 2>());
-      } else {
-        trackDensityMap[bin] = multivariateGaussian<3>(binCoords, cov);
-      }
+      Bin bin = std::make_pair(firstZBin + j, tBin);
+      trackDensityMap[bin] = static_cast<float>(density[j]);
     }
   }
   return trackDensityMap;
 }
 
-template <int spatialTrkGridSize, int temporalTrkGridSize>
+template <int spatialTrkGridSize, int temporalTrkGridSize,
+          typename density_map_t>
 Acts::Result<float> Acts::AdaptiveGridTrackDensity<
-    spatialTrkGridSize,
-    temporalTrkGridSize>::estimateSeedWidth(const DensityMap& densityMap,
-                                            const ZTPosition& maxZT) const {
+    spatialTrkGridSize, temporalTrkGridSize,
+    density_map_t>::estimateSeedWidth(const DensityMap& densityMap,
+                                      const ZTPosition& maxZT) const {
   if (densityMap.empty()) {
     return VertexingError::EmptyInput;
   }
@@ -260,21 +306,35 @@ Acts::Result<float> Acts::AdaptiveGridTrackDensity<
   return std::isnormal(width) ? width : 0.0f;
 }
 
-template <int spatialTrkGridSize, int temporalTrkGridSize>
-template <unsigned int nDim>
-float Acts::AdaptiveGridTrackDensity<spatialTrkGridSize, temporalTrkGridSize>::
-    multivariateGaussian(const Acts::ActsVector<nDim>& args,
-                         const Acts::ActsSquareMatrix<nDim>& cov) {
-  float expo = -0.5 * args.transpose().dot(cov.inverse() * args);
-  float gaussianDensity = safeExp(expo) / std::sqrt(cov.determinant());
-  return gaussianDensity;
+template <int spatialTrkGridSize, int temporalTrkGridSize,
+          typename density_map_t>
+typename Acts::AdaptiveGridTrackDensity<
+    spatialTrkGridSize, temporalTrkGridSize,
+    density_map_t>::DensityMap::const_iterator
+Acts::AdaptiveGridTrackDensity<spatialTrkGridSize, temporalTrkGridSize,
+                               density_map_t>::
+    highestDensityEntryExcluding(const DensityMap& densityMap,
+                                 const std::vector<Bin>& excluded) {
+  auto maxEntry = std::end(densityMap);
+  for (auto it = std::begin(densityMap); it != std::end(densityMap); ++it) {
+    if (std::find(excluded.begin(), excluded.end(), it->first) !=
+        excluded.end()) {
+      continue;
+    }
+    if (maxEntry == std::end(densityMap) || maxEntry->second < it->second) {
+      maxEntry = it;
+    }
+  }
+  return maxEntry;
 }
 
-template <int spatialTrkGridSize, int temporalTrkGridSize>
-typename Acts::AdaptiveGridTrackDensity<spatialTrkGridSize,
-                                        temporalTrkGridSize>::Bin
-Acts::AdaptiveGridTrackDensity<spatialTrkGridSize, temporalTrkGridSize>::
-    highestDensitySumBin(DensityMap& densityMap) const {
+template <int spatialTrkGridSize, int temporalTrkGridSize,
+          typename density_map_t>
+typename Acts::AdaptiveGridTrackDensity<spatialTrkGridSize, temporalTrkGridSize,
+                                        density_map_t>::Bin
+Acts::AdaptiveGridTrackDensity<spatialTrkGridSize, temporalTrkGridSize,
+                               density_map_t>::
+    highestDensitySumBin(const DensityMap& densityMap) const {
   // The global maximum
   auto firstMax = highestDensityEntry(densityMap);
   Bin binFirstMax = firstMax->first;
@@ -284,35 +344,30 @@ Acts::AdaptiveGridTrackDensity<spatialTrkGridSize, temporalTrkGridSize>::
   // valueFirstMax - densityDeviation
   float densityDeviation = valueFirstMax * m_cfg.maxRelativeDensityDev;
 
-  // Get the second highest maximum
-  densityMap.at(binFirstMax) = 0;
-  auto secondMax = highestDensityEntry(densityMap);
-  Bin binSecondMax = secondMax->first;
-  float valueSecondMax = secondMax->second;
-  float secondSum = 0;
-  if (valueFirstMax - valueSecondMax < densityDeviation) {
-    secondSum = getDensitySum(densityMap, binSecondMax);
-  } else {
-    // If the second maximum is not sufficiently large the third maximum won't
-    // be either
-    densityMap.at(binFirstMax) = valueFirstMax;
+  // Get the second highest maximum, the density map is not modified such
+  // that a tracked maximum stays valid
+  std::vector<Bin> excluded = {binFirstMax};
+  auto secondMax = highestDensityEntryExcluding(densityMap, excluded);
+  // If the second maximum is not sufficiently large the third maximum won't
+  // be either
+  if (secondMax == std::end(densityMap) ||
+      valueFirstMax - secondMax->second >= densityDeviation) {
     return binFirstMax;
   }
+  Bin binSecondMax = secondMax->first;
+  float secondSum = getDensitySum(densityMap, binSecondMax, excluded);
 
   // Get the third highest maximum
-  densityMap.at(binSecondMax) = 0;
-  auto thirdMax = highestDensityEntry(densityMap);
-  Bin binThirdMax = thirdMax->first;
-  float valueThirdMax = thirdMax->second;
+  excluded.push_back(binSecondMax);
+  auto thirdMax = highestDensityEntryExcluding(densityMap, excluded);
+  Bin binThirdMax = binFirstMax;
   float thirdSum = 0;
-  if (valueFirstMax - valueThirdMax < densityDeviation) {
-    thirdSum = getDensitySum(densityMap, binThirdMax);
+  if (thirdMax != std::end(densityMap) &&
+      valueFirstMax - thirdMax->second < densityDeviation) {
+    binThirdMax = thirdMax->first;
+    thirdSum = getDensitySum(densityMap, binThirdMax, excluded);
   }
 
-  // Revert back to original values
-  densityMap.at(binFirstMax) = valueFirstMax;
-  densityMap.at(binSecondMax) = valueSecondMax;
-
   // Return the z bin position of the highest density sum
   if (secondSum > firstSum && secondSum > thirdSum) {
     return binSecondMax;
@@ -323,26 +378,31 @@ Acts::AdaptiveGridTrackDensity<spatialTrkGridSize, temporalTrkGridSize>::
   return binFirstMax;
 }
 
-template <int spatialTrkGridSize, int temporalTrkGridSize>
-float Acts::AdaptiveGridTrackDensity<spatialTrkGridSize, temporalTrkGridSize>::
-    getDensitySum(const DensityMap& densityMap, const Bin& bin) const {
+template <int spatialTrkGridSize, int temporalTrkGridSize,
+          typename density_map_t>
+float Acts::AdaptiveGridTrackDensity<spatialTrkGridSize, temporalTrkGridSize,
+                                     density_map_t>::
+    getDensitySum(const DensityMap& densityMap, const Bin& bin,
+                  const std::vector<Bin>& excluded) const {
   // Add density from the bin.
   float sum = densityMap.at(bin);
   // Check if neighboring bins are part of the densityMap and add them (if they
-  // are not part of the map, we assume them to be 0).
-  // Note that each key in a map is unique; the .count() function therefore
-  // returns either 0 or 1.
+  // are not part of the map or excluded, we assume them to be 0).
+  auto neighborDensity = [&](const Bin& neighbor) -> float {
+    if (std::find(excluded.begin(), excluded.end(), neighbor) !=
+        excluded.end()) {
+      return 0.f;
+    }
+    auto it = densityMap.find(neighbor);
+    return it != densityMap.end() ? it->second : 0.f;
+  };
   Bin binShifted = bin;
   // Add density from the neighboring bin in -z direction.
   binShifted.first -= 1;
-  if (densityMap.count(binShifted) == 1) {
-    sum += densityMap.at(binShifted);
-  }
+  sum += neighborDensity(binShifted);
 
   // Add density from the neighboring bin in +z direction.
   binShifted.first += 2;
-  if (densityMap.count(binShifted) == 1) {
-    sum += densityMap.at(binShifted);
-  }
+  sum += neighborDensity(binShifted);
   return sum;
 }
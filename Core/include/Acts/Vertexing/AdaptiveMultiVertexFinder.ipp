@@ -86,7 +86,7 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::find(
       break;
     }
     // Update fitter state with all vertices
-    fitterState.addVertexToMultiMap(vtxCandidate);
+    fitterState.addVertexToAdjacency(vtxCandidate);
 
     // Perform the fit
     auto fitResult = m_cfg.vertexFitter.addVtxToFit(
@@ -135,6 +135,12 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::find(
     iteration++;
   }  // end while loop
 
+  auto cacheStatistics = fitterState.linearizationCache.statistics();
+  if (cacheStatistics.hits + cacheStatistics.misses > 0) {
+    ACTS_DEBUG("Linearization cache: " << cacheStatistics.hits << " hits, "
+                                       << cacheStatistics.misses << " misses");
+  }
+
   return getVertexOutputList(allVerticesPtr, fitterState);
 }
 
@@ -254,11 +260,8 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::
     double ipSig = *sigRes;
     if (ipSig < m_cfg.tracksMaxSignificance) {
       // Create TrackAtVertex objects, unique for each (track, vertex) pair
-      fitterState.tracksAtVerticesMap.emplace(std::make_pair(trk, &vtx),
-                                              TrackAtVertex(params, trk));
-
-      // Add the original track parameters to the list for vtx
-      fitterState.vtxInfoMap[&vtx].trackLinks.push_back(trk);
+      // and add the original track parameters to the list for vtx
+      fitterState.addTrackToVertex(vtx, trk, TrackAtVertex(params, trk));
     }
   }
   return {};
@@ -278,7 +281,7 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::
   // candidate were found
   // TODO: This is for now how it's done in athena... this look a bit
   // nasty to me
-  if (fitterState.vtxInfoMap[&vtx].trackLinks.empty()) {
+  if (fitterState.vertexInfo(vtx).trackLinks.empty()) {
     // Find nearest track to vertex candidate
     double smallestDeltaZ = std::numeric_limits<double>::max();
     double newZ = 0;
@@ -297,7 +300,7 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::
       vtx.setFullPosition(Vector4(0., 0., newZ, 0.));
 
       // Update vertex info for current vertex
-      fitterState.vtxInfoMap[&vtx] =
+      fitterState.vertexInfo(vtx) =
           VertexInfo<InputTrack_t>(currentConstraint, vtx.fullPosition());
 
       // Try to add compatible track with adapted vertex position
@@ -307,7 +310,7 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::
         return Result<bool>::failure(res.error());
       }
 
-      if (fitterState.vtxInfoMap[&vtx].trackLinks.empty()) {
+      if (fitterState.vertexInfo(vtx).trackLinks.empty()) {
         ACTS_DEBUG(
             "No tracks near seed were found, while at least one was "
             "expected. Break.");
@@ -334,8 +337,8 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::
         const VertexingOptions<InputTrack_t>& vertexingOptions) const
     -> Result<bool> {
   // Add vertex info to fitter state
-  fitterState.vtxInfoMap[&vtx] =
-      VertexInfo<InputTrack_t>(currentConstraint, vtx.fullPosition());
+  fitterState.addVertex(
+      vtx, VertexInfo<InputTrack_t>(currentConstraint, vtx.fullPosition()));
 
   // Add all compatible tracks to vertex
   auto resComp = addCompatibleTracksToVertex(allTracks, vtx, fitterState,
@@ -364,9 +367,10 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::
     -> std::pair<int, bool> {
   bool isGoodVertex = false;
   int nCompatibleTracks = 0;
-  for (const auto& trk : fitterState.vtxInfoMap[&vtx].trackLinks) {
-    const auto& trkAtVtx =
-        fitterState.tracksAtVerticesMap.at(std::make_pair(trk, &vtx));
+  const auto& vtxInfo = fitterState.vertexInfo(vtx);
+  for (std::size_t i = 0; i < vtxInfo.links.size(); ++i) {
+    const auto& trk = vtxInfo.trackLinks[i];
+    const auto& trkAtVtx = fitterState.tracksAtVertices[vtxInfo.links[i]];
     if ((trkAtVtx.vertexCompatibility < m_cfg.maxVertexChi2 &&
          m_cfg.useFastCompatibility) ||
         (trkAtVtx.trackWeight > m_cfg.minWeight &&
@@ -402,9 +406,10 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::
         Vertex<InputTrack_t>& vtx, std::vector<const InputTrack_t*>& seedTracks,
         FitterState_t& fitterState,
         std::vector<const InputTrack_t*>& removedSeedTracks) const -> void {
-  for (const auto& trk : fitterState.vtxInfoMap[&vtx].trackLinks) {
-    const auto& trkAtVtx =
-        fitterState.tracksAtVerticesMap.at(std::make_pair(trk, &vtx));
+  const auto& vtxInfo = fitterState.vertexInfo(vtx);
+  for (std::size_t i = 0; i < vtxInfo.links.size(); ++i) {
+    const auto& trk = vtxInfo.trackLinks[i];
+    const auto& trkAtVtx = fitterState.tracksAtVertices[vtxInfo.links[i]];
     if ((trkAtVtx.vertexCompatibility < m_cfg.maxVertexChi2 &&
          m_cfg.useFastCompatibility) ||
         (trkAtVtx.trackWeight > m_cfg.minWeight &&
@@ -434,9 +439,10 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::
 
   auto maxCompSeedIt = seedTracks.end();
   const InputTrack_t* removedTrack = nullptr;
-  for (const auto& trk : fitterState.vtxInfoMap[&vtx].trackLinks) {
-    const auto& trkAtVtx =
-        fitterState.tracksAtVerticesMap.at(std::make_pair(trk, &vtx));
+  const auto& vtxInfo = fitterState.vertexInfo(vtx);
+  for (std::size_t i = 0; i < vtxInfo.links.size(); ++i) {
+    const auto& trk = vtxInfo.trackLinks[i];
+    const auto& trkAtVtx = fitterState.tracksAtVertices[vtxInfo.links[i]];
     double compatibility = trkAtVtx.vertexCompatibility;
     if (compatibility > maxCompatibility) {
       // Try to find track in seed tracks
@@ -488,9 +494,8 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::keepNewVertex(
   double contamination = 0.;
   double contaminationNum = 0;
   double contaminationDeNom = 0;
-  for (const auto& trk : fitterState.vtxInfoMap[&vtx].trackLinks) {
-    const auto& trkAtVtx =
-        fitterState.tracksAtVerticesMap.at(std::make_pair(trk, &vtx));
+  for (std::size_t link : fitterState.vertexInfo(vtx).links) {
+    const auto& trkAtVtx = fitterState.tracksAtVertices[link];
     double trackWeight = trkAtVtx.trackWeight;
     contaminationNum += trackWeight * (1. - trackWeight);
     contaminationDeNom += trackWeight * trackWeight;
@@ -576,7 +581,7 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::deleteLastVertex(
   allVerticesPtr.pop_back();
 
   // Update fitter state with removed vertex candidate
-  fitterState.removeVertexFromMultiMap(vtx);
+  fitterState.removeVertexFromAdjacency(vtx);
   // fitterState.vertexCollection contains all vertices that will be fit. When
   // we called addVtxToFit, vtx and all vertices that share tracks with vtx were
   // added to vertexCollection. Now, we want to refit the same set of vertices
@@ -586,11 +591,9 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::deleteLastVertex(
     return removeResult.error();
   }
 
-  for (auto& entry : fitterState.tracksAtVerticesMap) {
-    // Delete all linearized tracks for current (bad) vertex
-    if (entry.first.second == &vtx) {
-      entry.second.isLinearized = false;
-    }
+  // Delete all linearized tracks for current (bad) vertex
+  for (std::size_t link : fitterState.vertexInfo(vtx).links) {
+    fitterState.tracksAtVertices[link].isLinearized = false;
   }
 
   // If no vertices share tracks with vtx we don't need to refit
@@ -617,9 +620,8 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::getVertexOutputList(
   for (auto vtx : allVerticesPtr) {
     auto& outVtx = *vtx;
     std::vector<TrackAtVertex<InputTrack_t>> tracksAtVtx;
-    for (const auto& trk : fitterState.vtxInfoMap[vtx].trackLinks) {
-      tracksAtVtx.push_back(
-          fitterState.tracksAtVerticesMap.at(std::make_pair(trk, vtx)));
+    for (std::size_t link : fitterState.vertexInfo(*vtx).links) {
+      tracksAtVtx.push_back(fitterState.tracksAtVertices[link]);
     }
     outVtx.setTracksAtVertex(tracksAtVtx);
     outputVec.push_back(outVtx);
@@ -12,16 +12,24 @@
 #include "Acts/EventData/TrackParameters.hpp"
 #include "Acts/Utilities/AnnealingUtility.hpp"
 #include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
 #include "Acts/Utilities/Result.hpp"
 #include "Acts/Vertexing/AMVFInfo.hpp"
 #include "Acts/Vertexing/ImpactPointEstimator.hpp"
+#include "Acts/Vertexing/LinearizedTrackCache.hpp"
 #include "Acts/Vertexing/LinearizerConcept.hpp"
 #include "Acts/Vertexing/TrackAtVertex.hpp"
 #include "Acts/Vertexing/Vertex.hpp"
 #include "Acts/Vertexing/VertexingError.hpp"
 #include "Acts/Vertexing/VertexingOptions.hpp"
 
+#include <algorithm>
+#include <cstddef>
 #include <functional>
+#include <optional>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
 
 namespace Acts {
 
@@ -51,11 +59,20 @@ class AdaptiveMultiVertexFitter {
 
  public:
   /// @brief The fitter state
+  ///
+  /// Vertices, tracks and track-vertex links are addressed by dense indices
+  /// into contiguous arrays. Every (track, vertex) pair owns exactly one link
+  /// holding its TrackAtVertex and 3D impact parameters. The pointers of
+  /// vertices and tracks are only resolved to indices when they enter the
+  /// state, such that the fit itself does not traverse any associative
+  /// containers.
   struct State {
     State(const MagneticFieldProvider& field,
           const Acts::MagneticFieldContext& magContext)
         : ipState(field.makeCache(magContext)),
-          linearizerState(field.makeCache(magContext)) {}
+          linearizerState(field.makeCache(magContext)),
+          fieldProvider(&field),
+          magFieldContext(magContext) {}
     // Vertex collection to be fitted
     std::vector<Vertex<InputTrack_t>*> vertexCollection;
 
@@ -68,36 +85,174 @@ class AdaptiveMultiVertexFitter {
     // Linearizer state
     typename Linearizer_t::State linearizerState;
 
-    // Map to store vertices information
-    std::map<Vertex<InputTrack_t>*, VertexInfo<InputTrack_t>> vtxInfoMap;
-
-    std::multimap<const InputTrack_t*, Vertex<InputTrack_t>*>
-        trackToVerticesMultiMap;
-
-    std::map<std::pair<const InputTrack_t*, Vertex<InputTrack_t>*>,
-             TrackAtVertex<InputTrack_t>>
-        tracksAtVerticesMap;
+    // Magnetic field to create additional states for concurrent vertex fits
+    const MagneticFieldProvider* fieldProvider = nullptr;
+    MagneticFieldContext magFieldContext;
+
+    // All vertices known to the state and their information, indexed by
+    // vertex index
+    std::vector<Vertex<InputTrack_t>*> vertices;
+    std::vector<VertexInfo<InputTrack_t>> vertexInfos;
+
+    // All tracks known to the state, indexed by track index
+    std::vector<const InputTrack_t*> tracks;
+    // Links of each track to all vertices it was ever assigned to
+    std::vector<std::vector<std::size_t>> trackLinks;
+    // Links of each track to the vertices that currently take part in the
+    // multi-vertex fit, in the order in which the vertices were added
+    std::vector<std::vector<std::size_t>> trackAdjacency;
+
+    // Track-vertex links, indexed by link index
+    std::vector<TrackAtVertex<InputTrack_t>> tracksAtVertices;
+    std::vector<std::size_t> linkTrack;
+    std::vector<std::size_t> linkVertex;
+    std::vector<std::optional<BoundTrackParameters>> impactParams3D;
+
+    // Linearizations of the tracks, reused in later fit iterations by all
+    // vertices if the linearization point moved by less than
+    // Config::linearizationCacheTolerance
+    LinearizedTrackCache linearizationCache;
 
     /// @brief Default State constructor
     State() = default;
 
-    // Adds a vertex to trackToVerticesMultiMap
-    void addVertexToMultiMap(Vertex<InputTrack_t>& vtx) {
-      for (auto trk : vtxInfoMap[&vtx].trackLinks) {
-        trackToVerticesMultiMap.emplace(trk, &vtx);
+    /// Register a new vertex with the state.
+    ///
+    /// A vertex object that was registered before, e.g. a deleted vertex
+    /// whose memory got reused, is assigned a new index without any links.
+    ///
+    /// @param vtx The vertex
+    /// @param vtxInfo Initial vertex information, its track links are
+    ///        discarded in favour of addTrackToVertex
+    ///
+    /// @return Index of the vertex
+    std::size_t addVertex(Vertex<InputTrack_t>& vtx,
+                          VertexInfo<InputTrack_t> vtxInfo = {}) {
+      vtxInfo.trackLinks.clear();
+      vtxInfo.links.clear();
+      std::size_t vtxIndex = vertices.size();
+      vertices.push_back(&vtx);
+      vertexInfos.push_back(std::move(vtxInfo));
+      m_vertexIndices.insert_or_assign(&vtx, vtxIndex);
+      return vtxIndex;
+    }
+
+    /// Check if a vertex is known to the state.
+    bool hasVertex(const Vertex<InputTrack_t>& vtx) const {
+      return m_vertexIndices.find(&vtx) != m_vertexIndices.end();
+    }
+
+    /// Index of a registered vertex, throws if the vertex is unknown.
+    std::size_t vertexIndex(const Vertex<InputTrack_t>& vtx) const {
+      return m_vertexIndices.at(&vtx);
+    }
+
+    /// Information of a registered vertex, throws if the vertex is unknown.
+    VertexInfo<InputTrack_t>& vertexInfo(const Vertex<InputTrack_t>& vtx) {
+      return vertexInfos[vertexIndex(vtx)];
+    }
+
+    /// Information of a registered vertex, throws if the vertex is unknown.
+    const VertexInfo<InputTrack_t>& vertexInfo(
+        const Vertex<InputTrack_t>& vtx) const {
+      return vertexInfos[vertexIndex(vtx)];
+    }
+
+    /// Index of a track, the track is registered if it is unknown.
+    std::size_t trackIndex(const InputTrack_t* trk) {
+      auto [it, inserted] = m_trackIndices.try_emplace(trk, tracks.size());
+      if (inserted) {
+        tracks.push_back(trk);
+        trackLinks.emplace_back();
+        trackAdjacency.emplace_back();
       }
+      return it->second;
+    }
+
+    /// Assign a track to a registered vertex.
+    ///
+    /// If the track was assigned to the vertex before, the existing link
+    /// and its TrackAtVertex are reused.
+    ///
+    /// @param vtx The vertex
+    /// @param trk The track
+    /// @param trkAtVtx The track at the vertex
+    ///
+    /// @return Index of the link
+    std::size_t addTrackToVertex(Vertex<InputTrack_t>& vtx,
+                                 const InputTrack_t* trk,
+                                 TrackAtVertex<InputTrack_t> trkAtVtx) {
+      std::size_t vtxIndex = vertexIndex(vtx);
+      std::size_t trkIndex = trackIndex(trk);
+      std::optional<std::size_t> link = findLink(trkIndex, vtxIndex);
+      if (!link) {
+        link = tracksAtVertices.size();
+        tracksAtVertices.push_back(std::move(trkAtVtx));
+        linkTrack.push_back(trkIndex);
+        linkVertex.push_back(vtxIndex);
+        impactParams3D.emplace_back();
+        trackLinks[trkIndex].push_back(*link);
+      }
+      VertexInfo<InputTrack_t>& vtxInfo = vertexInfos[vtxIndex];
+      vtxInfo.trackLinks.push_back(trk);
+      vtxInfo.links.push_back(*link);
+      return *link;
+    }
+
+    /// Find the link between a track and a vertex.
+    std::optional<std::size_t> findLink(std::size_t trkIndex,
+                                        std::size_t vtxIndex) const {
+      for (std::size_t link : trackLinks[trkIndex]) {
+        if (linkVertex[link] == vtxIndex) {
+          return link;
+        }
+      }
+      return std::nullopt;
+    }
+
+    /// The track at a vertex, throws if the track is not assigned to it.
+    TrackAtVertex<InputTrack_t>& trackAtVertex(
+        const InputTrack_t* trk, const Vertex<InputTrack_t>& vtx) {
+      return tracksAtVertices[linkIndex(trk, vtx)];
+    }
+
+    /// The track at a vertex, throws if the track is not assigned to it.
+    const TrackAtVertex<InputTrack_t>& trackAtVertex(
+        const InputTrack_t* trk, const Vertex<InputTrack_t>& vtx) const {
+      return tracksAtVertices[linkIndex(trk, vtx)];
     }
 
-    // Removes a vertex from trackToVerticesMultiMap
-    void removeVertexFromMultiMap(Vertex<InputTrack_t>& vtx) {
-      for (auto iter = trackToVerticesMultiMap.begin();
-           iter != trackToVerticesMultiMap.end();) {
-        if (iter->second == &vtx) {
-          iter = trackToVerticesMultiMap.erase(iter);
-        } else {
-          ++iter;
+    /// Vertices that a track is currently associated with in the fit.
+    std::vector<Vertex<InputTrack_t>*> verticesOfTrack(
+        const InputTrack_t* trk) const {
+      std::vector<Vertex<InputTrack_t>*> result;
+      auto it = m_trackIndices.find(trk);
+      if (it != m_trackIndices.end()) {
+        for (std::size_t link : trackAdjacency[it->second]) {
+          result.push_back(vertices[linkVertex[link]]);
         }
       }
+      return result;
+    }
+
+    // Adds a vertex to the adjacency lists of its tracks
+    void addVertexToAdjacency(Vertex<InputTrack_t>& vtx) {
+      for (std::size_t link : vertexInfo(vtx).links) {
+        trackAdjacency[linkTrack[link]].push_back(link);
+      }
+    }
+
+    // Removes a vertex from the adjacency lists of its tracks
+    void removeVertexFromAdjacency(Vertex<InputTrack_t>& vtx) {
+      std::size_t vtxIndex = vertexIndex(vtx);
+      for (std::size_t link : vertexInfos[vtxIndex].links) {
+        auto& adjacency = trackAdjacency[linkTrack[link]];
+        adjacency.erase(std::remove_if(adjacency.begin(), adjacency.end(),
+                                       [&](std::size_t other) {
+                                         return linkVertex[other] == vtxIndex;
+                                       }),
+                        adjacency.end());
+      }
     }
 
     Result<void> removeVertexFromCollection(Vertex<InputTrack_t>& vtxToRemove,
@@ -113,6 +268,21 @@ class AdaptiveMultiVertexFitter {
       vertexCollection.erase(it);
       return {};
     }
+
+   private:
+    std::size_t linkIndex(const InputTrack_t* trk,
+                          const Vertex<InputTrack_t>& vtx) const {
+      std::optional<std::size_t> link =
+          findLink(m_trackIndices.at(trk), vertexIndex(vtx));
+      if (!link) {
+        throw std::out_of_range("Track is not assigned to vertex");
+      }
+      return *link;
+    }
+
+    std::unordered_map<const Vertex<InputTrack_t>*, std::size_t>
+        m_vertexIndices;
+    std::unordered_map<const InputTrack_t*, std::size_t> m_trackIndices;
   };
 
   struct Config {
@@ -153,6 +323,21 @@ class AdaptiveMultiVertexFitter {
 
     // Use time information when calculating the vertex compatibility
     bool useTime{false};
+
+    /// Optional executor to process the vertices of one fit iteration
+    /// concurrently. Given the track weights of the previous iteration, the
+    /// vertices are updated independently of each other, so the results are
+    /// identical to the sequential fit. States that were created without a
+    /// magnetic field are always fitted sequentially.
+    ParallelForExecutor vertexExecutor;
+
+    /// Tolerance for reusing cached track linearizations. A track is not
+    /// linearized again if a linearization exists whose linearization point
+    /// differs by less than this value in each coordinate (the time is
+    /// compared in native units). The cache is disabled if set to zero.
+    /// Linearizations are only shared between fit iterations, so the
+    /// results do not depend on the vertex executor.
+    double linearizationCacheTolerance{0.};
   };
 
   /// @brief Constructor used if InputTrack_t type == BoundTrackParameters
@@ -232,57 +417,80 @@ class AdaptiveMultiVertexFitter {
   /// Private access to logging instance
   const Logger& logger() const { return *m_logger; }
 
-  /// @brief Tests if vertex is already in list of vertices or not
-  ///
-  /// @param vtx Vertex to test
-  /// @param verticesVec Vector of vertices to search
-  ///
-  /// @return True if vtx is already in verticesVec
-  bool isAlreadyInList(
-      Vertex<InputTrack_t>* vtx,
-      const std::vector<Vertex<InputTrack_t>*>& verticesVec) const;
-
   /// @brief 1) Calls ImpactPointEstimator::estimate3DImpactParameters
   /// for all tracks that are associated with vtx (i.e., all elements
   /// of the trackLinks vector in the VertexInfo of vtx).
   /// 2) Saves the 3D impact parameters in the VertexInfo of vtx.
   ///
   /// @param state Vertex fitter state
-  /// @param vtx Vertex object
+  /// @param vtxIndex Index of the vertex in the state
+  /// @param ipState IPEstimator state
   /// @param vertexingOptions Vertexing options
   Result<void> prepareVertexForFit(
-      State& state, Vertex<InputTrack_t>* vtx,
+      State& state, std::size_t vtxIndex, typename IPEstimator::State& ipState,
       const VertexingOptions<InputTrack_t>& vertexingOptions) const;
 
+  /// @brief Applies a function to all vertices in state.vertexCollection,
+  /// concurrently if m_cfg.vertexExecutor is set and the state knows the
+  /// magnetic field. Concurrent tasks use their own IPEstimator and
+  /// linearizer states.
+  ///
+  /// @param state Fitter state
+  /// @param func Function called with the vertex index and the
+  ///        IPEstimator and linearizer states to use
+  ///
+  /// @return The error of the first vertex in state.vertexCollection for
+  ///         which the function failed
+  template <typename vertex_function_t>
+  Result<void> forEachVertex(State& state, vertex_function_t&& func) const;
+
+  /// @brief Starts a new fit iteration for a vertex: relinearizes if the
+  /// vertex moved too far from its linearization point, applies the vertex
+  /// constraint and sets the track compatibilities
+  ///
+  /// @param state Fitter state
+  /// @param vtxIndex Index of the vertex in the state
+  /// @param ipState IPEstimator state
+  /// @param vertexingOptions Vertexing options
+  Result<void> prepareVertexIteration(
+      State& state, std::size_t vtxIndex, typename IPEstimator::State& ipState,
+      const VertexingOptions<input_track_t>& vertexingOptions) const;
+
   /// @brief Sets the vertexCompatibility for all TrackAtVertex objects
   /// at the current vertex
   ///
   /// @param state Fitter state
-  /// @param currentVtx Current vertex
+  /// @param vtxIndex Index of the current vertex in the state
+  /// @param ipState IPEstimator state
   /// @param vertexingOptions Vertexing options
   Result<void> setAllVertexCompatibilities(
-      State& state, Vertex<InputTrack_t>* currentVtx,
+      State& state, std::size_t vtxIndex, typename IPEstimator::State& ipState,
       const VertexingOptions<input_track_t>& vertexingOptions) const;
 
-  /// @brief Sets weights to the track according to Eq.(5.46) in Ref.(1)
-  ///  and updates the vertices by calling the VertexUpdater
+  /// @brief Sets weights to the tracks of a vertex according to Eq.(5.46)
+  ///  in Ref.(1) and updates the vertex by calling the VertexUpdater
   ///
   /// @param state Fitter state
+  /// @param vtxIndex Index of the vertex in the state
   /// @param linearizer The track linearizer
+  /// @param linearizerState Linearizer state
+  /// @param cacheInsertions Insertions into the linearization cache
   /// @param vertexingOptions Vertexing options
   Result<void> setWeightsAndUpdate(
-      State& state, const Linearizer_t& linearizer,
+      State& state, std::size_t vtxIndex, const Linearizer_t& linearizer,
+      typename Linearizer_t::State& linearizerState,
+      LinearizedTrackCache::Insertions& cacheInsertions,
       const VertexingOptions<input_track_t>& vertexingOptions) const;
 
-  /// @brief Collects the compatibility values of the track `trk`
+  /// @brief Collects the compatibility values of a track
   /// wrt to all of its associated vertices
   ///
   /// @param state Fitter state
-  /// @param trk Track
-  ///
-  /// @return Vector of compatibility values
-  std::vector<double> collectTrackToVertexCompatibilities(
-      State& state, const InputTrack_t* trk) const;
+  /// @param trkIndex Index of the track in the state
+  /// @param[out] compatibilities Compatibility values, overwritten
+  void collectTrackToVertexCompatibilities(
+      const State& state, std::size_t trkIndex,
+      std::vector<double>& compatibilities) const;
 
   /// @brief Determines if any vertex position has shifted more than
   /// m_cfg.maxRelativeShift in the last iteration
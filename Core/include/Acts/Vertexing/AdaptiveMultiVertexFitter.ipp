@@ -28,68 +28,38 @@ Acts::AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::fit(
   // Number of iterations counter
   unsigned int nIter = 0;
 
+  // New linearizations of each vertex, committed to the cache after every
+  // iteration in the order of state.vertexCollection
+  std::vector<LinearizedTrackCache::Insertions> cacheInsertions(
+      state.vertices.size());
+
   // Start iterating
   while (nIter < m_cfg.maxIterations &&
          (!state.annealingState.equilibriumReached || !isSmallShift)) {
     // Initial loop over all vertices in state.vertexCollection
-    for (auto vtx : state.vertexCollection) {
-      VertexInfo<input_track_t>& vtxInfo = state.vtxInfoMap[vtx];
-      vtxInfo.relinearize = false;
-      // Store old position of vertex, i.e. seed position
-      // in case of first iteration or position determined
-      // in previous iteration afterwards
-      vtxInfo.oldPosition = vtx->fullPosition();
-
-      // Calculate the x-y-distance between the current vertex position
-      // and the linearization point of the tracks. If it is too large,
-      // we relinearize the tracks and recalculate their 3D impact
-      // parameters.
-      ActsVector<2> xyDiff = vtxInfo.oldPosition.template head<2>() -
-                             vtxInfo.linPoint.template head<2>();
-      if (xyDiff.norm() > m_cfg.maxDistToLinPoint) {
-        // Set flag for relinearization
-        vtxInfo.relinearize = true;
-        // Recalculate the track impact parameters at the current vertex
-        // position
-        auto prepareVertexResult =
-            prepareVertexForFit(state, vtx, vertexingOptions);
-        if (!prepareVertexResult.ok()) {
-          // Print vertices and associated tracks if logger is in debug mode
-          if (logger().doPrint(Logging::DEBUG)) {
-            logDebugData(state, vertexingOptions.geoContext);
-          }
-          return prepareVertexResult.error();
-        }
-      }
-
-      // Check if we use the constraint during the vertex fit
-      if (state.vtxInfoMap[vtx].constraint.fullCovariance() !=
-          SquareMatrix4::Zero()) {
-        const Acts::Vertex<input_track_t>& constraint =
-            state.vtxInfoMap[vtx].constraint;
-        vtx->setFullPosition(constraint.fullPosition());
-        vtx->setFitQuality(constraint.fitQuality());
-        vtx->setFullCovariance(constraint.fullCovariance());
-      } else if (vtx->fullCovariance() == SquareMatrix4::Zero()) {
-        return VertexingError::NoCovariance;
-      }
-
-      // Set vertexCompatibility for all TrackAtVertex objects
-      // at the current vertex
-      auto setCompatibilitiesResult =
-          setAllVertexCompatibilities(state, vtx, vertexingOptions);
-      if (!setCompatibilitiesResult.ok()) {
-        // Print vertices and associated tracks if logger is in debug mode
-        if (logger().doPrint(Logging::DEBUG)) {
-          logDebugData(state, vertexingOptions.geoContext);
-        }
-        return setCompatibilitiesResult.error();
+    auto prepareResult = forEachVertex(
+        state, [&](std::size_t vtxIndex, typename IPEstimator::State& ipState,
+                   typename Linearizer_t::State&) {
+          return prepareVertexIteration(state, vtxIndex, ipState,
+                                        vertexingOptions);
+        });
+    if (!prepareResult.ok()) {
+      // Print vertices and associated tracks if logger is in debug mode
+      if (logger().doPrint(Logging::DEBUG)) {
+        logDebugData(state, vertexingOptions.geoContext);
       }
-    }  // End loop over vertex collection
+      return prepareResult.error();
+    }
 
     // Recalculate all track weights and update vertices
-    auto setWeightsResult =
-        setWeightsAndUpdate(state, linearizer, vertexingOptions);
+    auto setWeightsResult = forEachVertex(
+        state, [&](std::size_t vtxIndex, typename IPEstimator::State&,
+                   typename Linearizer_t::State& linearizerState) {
+          return setWeightsAndUpdate(state, vtxIndex, linearizer,
+                                     linearizerState,
+                                     cacheInsertions[vtxIndex],
+                                     vertexingOptions);
+        });
     if (!setWeightsResult.ok()) {
       // Print vertices and associated tracks if logger is in debug mode
       if (logger().doPrint(Logging::DEBUG)) {
@@ -97,6 +67,11 @@ Acts::AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::fit(
       }
       return setWeightsResult.error();
     }
+    // Make the new linearizations available to the next iteration
+    for (auto vtx : state.vertexCollection) {
+      state.linearizationCache.commit(
+          cacheInsertions[state.vertexIndex(*vtx)]);
+    }
 
     // Cool the system down, i.e., reduce the temperature parameter. At lower
     // temperatures, outlying tracks are downweighted more.
@@ -117,52 +92,144 @@ Acts::AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::fit(
   return {};
 }
 
+template <typename input_track_t, typename linearizer_t>
+template <typename vertex_function_t>
+Acts::Result<void>
+Acts::AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::forEachVertex(
+    State& state, vertex_function_t&& func) const {
+  // Concurrent tasks need the magnetic field to create their own states,
+  // which is unknown for default-constructed states
+  if (!m_cfg.vertexExecutor || state.fieldProvider == nullptr ||
+      state.vertexCollection.size() < 2) {
+    for (auto vtx : state.vertexCollection) {
+      auto res = func(state.vertexIndex(*vtx), state.ipState,
+                      state.linearizerState);
+      if (!res.ok()) {
+        return res.error();
+      }
+    }
+    return {};
+  }
+
+  // Resolve the vertex indices upfront, the lookup is not thread-safe
+  std::vector<std::size_t> vtxIndices;
+  vtxIndices.reserve(state.vertexCollection.size());
+  for (auto vtx : state.vertexCollection) {
+    vtxIndices.push_back(state.vertexIndex(*vtx));
+  }
+
+  std::vector<Result<void>> results(vtxIndices.size());
+  parallelFor(m_cfg.vertexExecutor, vtxIndices.size(),
+              [&](std::size_t begin, std::size_t end) {
+                // The states only hold magnetic field caches, which do not
+                // influence the results
+                typename IPEstimator::State ipState(
+                    state.fieldProvider->makeCache(state.magFieldContext));
+                typename Linearizer_t::State linearizerState(
+                    state.fieldProvider->makeCache(state.magFieldContext));
+                for (std::size_t i = begin; i < end; ++i) {
+                  results[i] = func(vtxIndices[i], ipState, linearizerState);
+                }
+              });
+
+  for (auto& res : results) {
+    if (!res.ok()) {
+      return res.error();
+    }
+  }
+  return {};
+}
+
+template <typename input_track_t, typename linearizer_t>
+Acts::Result<void> Acts::AdaptiveMultiVertexFitter<input_track_t,
+                                                   linearizer_t>::
+    prepareVertexIteration(
+        State& state, std::size_t vtxIndex,
+        typename IPEstimator::State& ipState,
+        const VertexingOptions<input_track_t>& vertexingOptions) const {
+  Vertex<input_track_t>* vtx = state.vertices[vtxIndex];
+  VertexInfo<input_track_t>& vtxInfo = state.vertexInfos[vtxIndex];
+  vtxInfo.relinearize = false;
+  // Store old position of vertex, i.e. seed position
+  // in case of first iteration or position determined
+  // in previous iteration afterwards
+  vtxInfo.oldPosition = vtx->fullPosition();
+
+  // Calculate the x-y-distance between the current vertex position
+  // and the linearization point of the tracks. If it is too large,
+  // we relinearize the tracks and recalculate their 3D impact
+  // parameters.
+  ActsVector<2> xyDiff = vtxInfo.oldPosition.template head<2>() -
+                         vtxInfo.linPoint.template head<2>();
+  if (xyDiff.norm() > m_cfg.maxDistToLinPoint) {
+    // Set flag for relinearization
+    vtxInfo.relinearize = true;
+    // Recalculate the track impact parameters at the current vertex
+    // position
+    auto prepareVertexResult =
+        prepareVertexForFit(state, vtxIndex, ipState, vertexingOptions);
+    if (!prepareVertexResult.ok()) {
+      return prepareVertexResult.error();
+    }
+  }
+
+  // Check if we use the constraint during the vertex fit
+  if (vtxInfo.constraint.fullCovariance() != SquareMatrix4::Zero()) {
+    const Acts::Vertex<input_track_t>& constraint = vtxInfo.constraint;
+    vtx->setFullPosition(constraint.fullPosition());
+    vtx->setFitQuality(constraint.fitQuality());
+    vtx->setFullCovariance(constraint.fullCovariance());
+  } else if (vtx->fullCovariance() == SquareMatrix4::Zero()) {
+    return VertexingError::NoCovariance;
+  }
+
+  // Set vertexCompatibility for all TrackAtVertex objects
+  // at the current vertex
+  return setAllVertexCompatibilities(state, vtxIndex, ipState,
+                                     vertexingOptions);
+}
+
 template <typename input_track_t, typename linearizer_t>
 Acts::Result<void>
 Acts::AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::addVtxToFit(
     State& state, Vertex<input_track_t>& newVertex,
     const linearizer_t& linearizer,
     const VertexingOptions<input_track_t>& vertexingOptions) const {
-  if (state.vtxInfoMap[&newVertex].trackLinks.empty()) {
+  if (!state.hasVertex(newVertex) ||
+      state.vertexInfo(newVertex).trackLinks.empty()) {
     ACTS_ERROR(
         "newVertex does not have any associated tracks (i.e., its trackLinks "
         "are empty).")
     return VertexingError::EmptyInput;
   }
 
-  std::vector<Vertex<input_track_t>*> verticesToFit = {&newVertex};
+  std::size_t newVtxIndex = state.vertexIndex(newVertex);
+
+  std::vector<std::size_t> verticesToFit = {newVtxIndex};
+  // Flags marking the vertices that are already part of verticesToFit
+  std::vector<bool> isInFit(state.vertices.size(), false);
+  isInFit[newVtxIndex] = true;
 
   // List of vertices added in last iteration
-  std::vector<Vertex<input_track_t>*> lastIterAddedVertices = {&newVertex};
+  std::vector<std::size_t> lastIterAddedVertices = {newVtxIndex};
   // List of vertices added in current iteration
-  std::vector<Vertex<input_track_t>*> currentIterAddedVertices;
+  std::vector<std::size_t> currentIterAddedVertices;
 
   // Fill verticesToFit with vertices that are connected to newVertex (via
   // tracks and/or other vertices).
   while (!lastIterAddedVertices.empty()) {
-    for (auto& lastIterAddedVertex : lastIterAddedVertices) {
+    for (std::size_t lastIterAddedVertex : lastIterAddedVertices) {
       // Loop over all tracks at lastIterAddedVertex
-      const std::vector<const input_track_t*>& trks =
-          state.vtxInfoMap[lastIterAddedVertex].trackLinks;
-      for (const auto& trk : trks) {
-        // Range of vertices that are associated with trk. The range is
-        // represented via its bounds: begin refers to the first iterator of the
-        // range; end refers to the iterator after the last iterator of the
-        // range.
-        auto [begin, end] = state.trackToVerticesMultiMap.equal_range(trk);
-
-        for (auto it = begin; it != end; ++it) {
-          // it->first corresponds to trk, it->second to one of its associated
-          // vertices
-          auto vtxToFit = it->second;
+      for (std::size_t link : state.vertexInfos[lastIterAddedVertex].links) {
+        // Loop over all vertices that are associated with the track
+        for (std::size_t otherLink :
+             state.trackAdjacency[state.linkTrack[link]]) {
+          std::size_t vtxToFit = state.linkVertex[otherLink];
           // Add vertex to the fit if it is not already included
-          if (!isAlreadyInList(vtxToFit, verticesToFit)) {
+          if (!isInFit[vtxToFit]) {
+            isInFit[vtxToFit] = true;
             verticesToFit.push_back(vtxToFit);
-
-            // Collect vertices that were added this iteration
-            if (vtxToFit != lastIterAddedVertex) {
-              currentIterAddedVertices.push_back(vtxToFit);
-            }
+            currentIterAddedVertices.push_back(vtxToFit);
           }
         }  // End for loop over range of associated vertices
       }    // End loop over trackLinks
@@ -172,10 +239,14 @@ Acts::AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::addVtxToFit(
     currentIterAddedVertices.clear();
   }  // End while loop
 
-  state.vertexCollection = verticesToFit;
+  state.vertexCollection.clear();
+  for (std::size_t vtxIndex : verticesToFit) {
+    state.vertexCollection.push_back(state.vertices[vtxIndex]);
+  }
 
   // Save the 3D impact parameters of all tracks associated with newVertex.
-  auto res = prepareVertexForFit(state, &newVertex, vertexingOptions);
+  auto res =
+      prepareVertexForFit(state, newVtxIndex, state.ipState, vertexingOptions);
   if (!res.ok()) {
     // Print vertices and associated tracks if logger is in debug mode
     if (logger().doPrint(Logging::DEBUG)) {
@@ -193,33 +264,30 @@ Acts::AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::addVtxToFit(
   return {};
 }
 
-template <typename input_track_t, typename linearizer_t>
-bool Acts::AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::
-    isAlreadyInList(Vertex<input_track_t>* vtx,
-                    const std::vector<Vertex<input_track_t>*>& vertices) const {
-  return std::find(vertices.begin(), vertices.end(), vtx) != vertices.end();
-}
-
 template <typename input_track_t, typename linearizer_t>
 Acts::Result<void> Acts::
     AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::prepareVertexForFit(
-        State& state, Vertex<input_track_t>* vtx,
+        State& state, std::size_t vtxIndex,
+        typename IPEstimator::State& ipState,
         const VertexingOptions<input_track_t>& vertexingOptions) const {
   // Vertex info object
-  auto& vtxInfo = state.vtxInfoMap[vtx];
+  auto& vtxInfo = state.vertexInfos[vtxIndex];
   // Vertex seed position
   const Vector3& seedPos = vtxInfo.seedPosition.template head<3>();
 
   // Loop over all tracks at the vertex
-  for (const auto& trk : vtxInfo.trackLinks) {
+  for (std::size_t link : vtxInfo.links) {
+    const input_track_t* trk = state.tracks[state.linkTrack[link]];
     auto res = m_cfg.ipEst.estimate3DImpactParameters(
         vertexingOptions.geoContext, vertexingOptions.magFieldContext,
-        m_extractParameters(*trk), seedPos, state.ipState);
+        m_extractParameters(*trk), seedPos, ipState);
     if (!res.ok()) {
       return res.error();
     }
-    // Save 3D impact parameters of the track
-    vtxInfo.impactParams3D.emplace(trk, res.value());
+    // Save 3D impact parameters of the track, existing ones are kept
+    if (!state.impactParams3D[link]) {
+      state.impactParams3D[link].emplace(*res);
+    }
   }
   return {};
 }
@@ -228,36 +296,38 @@ template <typename input_track_t, typename linearizer_t>
 Acts::Result<void>
 Acts::AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::
     setAllVertexCompatibilities(
-        State& state, Vertex<input_track_t>* vtx,
+        State& state, std::size_t vtxIndex,
+        typename IPEstimator::State& ipState,
         const VertexingOptions<input_track_t>& vertexingOptions) const {
-  VertexInfo<input_track_t>& vtxInfo = state.vtxInfoMap[vtx];
+  VertexInfo<input_track_t>& vtxInfo = state.vertexInfos[vtxIndex];
 
   // Loop over all tracks that are associated with vtx and estimate their
   // compatibility
-  for (const auto& trk : vtxInfo.trackLinks) {
-    auto& trkAtVtx = state.tracksAtVerticesMap.at(std::make_pair(trk, vtx));
+  for (std::size_t link : vtxInfo.links) {
+    const input_track_t* trk = state.tracks[state.linkTrack[link]];
+    auto& trkAtVtx = state.tracksAtVertices[link];
+    auto& impactParams = state.impactParams3D[link];
     // Recover from cases where linearization point != 0 but
     // more tracks were added later on
-    if (vtxInfo.impactParams3D.find(trk) == vtxInfo.impactParams3D.end()) {
+    if (!impactParams) {
       auto res = m_cfg.ipEst.estimate3DImpactParameters(
           vertexingOptions.geoContext, vertexingOptions.magFieldContext,
           m_extractParameters(*trk), VectorHelpers::position(vtxInfo.linPoint),
-          state.ipState);
+          ipState);
       if (!res.ok()) {
         return res.error();
       }
       // Set impactParams3D for current trackAtVertex
-      vtxInfo.impactParams3D.emplace(trk, res.value());
+      impactParams.emplace(*res);
     }
     // Set compatibility with current vertex
     Acts::Result<double> compatibilityResult(0.);
     if (m_cfg.useTime) {
       compatibilityResult = m_cfg.ipEst.template getVertexCompatibility<4>(
-          vertexingOptions.geoContext, &(vtxInfo.impactParams3D.at(trk)),
-          vtxInfo.oldPosition);
+          vertexingOptions.geoContext, &(*impactParams), vtxInfo.oldPosition);
     } else {
       compatibilityResult = m_cfg.ipEst.template getVertexCompatibility<3>(
-          vertexingOptions.geoContext, &(vtxInfo.impactParams3D.at(trk)),
+          vertexingOptions.geoContext, &(*impactParams),
           VectorHelpers::position(vtxInfo.oldPosition));
     }
     if (!compatibilityResult.ok()) {
@@ -271,87 +341,84 @@ Acts::AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::
 template <typename input_track_t, typename linearizer_t>
 Acts::Result<void> Acts::
     AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::setWeightsAndUpdate(
-        State& state, const linearizer_t& linearizer,
+        State& state, std::size_t vtxIndex, const linearizer_t& linearizer,
+        typename Linearizer_t::State& linearizerState,
+        LinearizedTrackCache::Insertions& cacheInsertions,
         const VertexingOptions<input_track_t>& vertexingOptions) const {
-  for (auto vtx : state.vertexCollection) {
-    VertexInfo<input_track_t>& vtxInfo = state.vtxInfoMap[vtx];
-
-    if (vtxInfo.relinearize) {
-      vtxInfo.linPoint = vtxInfo.oldPosition;
-    }
-
-    const std::shared_ptr<PerigeeSurface> vtxPerigeeSurface =
-        Surface::makeShared<PerigeeSurface>(
-            VectorHelpers::position(vtxInfo.linPoint));
-
-    for (const auto& trk : vtxInfo.trackLinks) {
-      auto& trkAtVtx = state.tracksAtVerticesMap.at(std::make_pair(trk, vtx));
+  // Compatibilities of the current track wrt all of its vertices
+  std::vector<double> trkToVtxCompatibilities;
 
-      // Set trackWeight for current track
-      trkAtVtx.trackWeight = m_cfg.annealingTool.getWeight(
-          state.annealingState, trkAtVtx.vertexCompatibility,
-          collectTrackToVertexCompatibilities(state, trk));
+  Vertex<input_track_t>* vtx = state.vertices[vtxIndex];
+  VertexInfo<input_track_t>& vtxInfo = state.vertexInfos[vtxIndex];
 
-      if (trkAtVtx.trackWeight > m_cfg.minWeight) {
-        // Check if track is already linearized and whether we need to
-        // relinearize
-        if (!trkAtVtx.isLinearized || vtxInfo.relinearize) {
-          auto result = linearizer.linearizeTrack(
-              m_extractParameters(*trk), vtxInfo.linPoint[3],
-              *vtxPerigeeSurface, vertexingOptions.geoContext,
-              vertexingOptions.magFieldContext, state.linearizerState);
-          if (!result.ok()) {
-            return result.error();
-          }
+  if (vtxInfo.relinearize) {
+    vtxInfo.linPoint = vtxInfo.oldPosition;
+  }
 
-          trkAtVtx.linearizedState = *result;
-          trkAtVtx.isLinearized = true;
-        }
-        // Update the vertex with the new track. The second template argument
-        // corresponds to the number of fitted vertex dimensions (i.e., 3 if we
-        // only fit spatial coordinates and 4 if we also fit time).
-        if (m_cfg.useTime) {
-          KalmanVertexUpdater::updateVertexWithTrack<input_track_t, 4>(
-              *vtx, trkAtVtx);
-        } else {
-          KalmanVertexUpdater::updateVertexWithTrack<input_track_t, 3>(
-              *vtx, trkAtVtx);
+  const std::shared_ptr<PerigeeSurface> vtxPerigeeSurface =
+      Surface::makeShared<PerigeeSurface>(
+          VectorHelpers::position(vtxInfo.linPoint));
+
+  for (std::size_t link : vtxInfo.links) {
+    const input_track_t* trk = state.tracks[state.linkTrack[link]];
+    auto& trkAtVtx = state.tracksAtVertices[link];
+
+    // Set trackWeight for current track
+    collectTrackToVertexCompatibilities(state, state.linkTrack[link],
+                                        trkToVtxCompatibilities);
+    trkAtVtx.trackWeight = m_cfg.annealingTool.getWeight(
+        state.annealingState, trkAtVtx.vertexCompatibility,
+        trkToVtxCompatibilities);
+
+    if (trkAtVtx.trackWeight > m_cfg.minWeight) {
+      // Check if track is already linearized and whether we need to
+      // relinearize
+      if (!trkAtVtx.isLinearized || vtxInfo.relinearize) {
+        auto result = state.linearizationCache.get(
+            state.linkTrack[link], vtxInfo.linPoint,
+            m_cfg.linearizationCacheTolerance, [&]() {
+              return linearizer.linearizeTrack(
+                  m_extractParameters(*trk), vtxInfo.linPoint[3],
+                  *vtxPerigeeSurface, vertexingOptions.geoContext,
+                  vertexingOptions.magFieldContext, linearizerState);
+            },
+            cacheInsertions);
+        if (!result.ok()) {
+          return result.error();
         }
+
+        trkAtVtx.linearizedState = *result;
+        trkAtVtx.isLinearized = true;
+      }
+      // Update the vertex with the new track. The second template argument
+      // corresponds to the number of fitted vertex dimensions (i.e., 3 if we
+      // only fit spatial coordinates and 4 if we also fit time).
+      if (m_cfg.useTime) {
+        KalmanVertexUpdater::updateVertexWithTrack<input_track_t, 4>(
+            *vtx, trkAtVtx);
       } else {
-        ACTS_VERBOSE("Track weight too low. Skip track.");
+        KalmanVertexUpdater::updateVertexWithTrack<input_track_t, 3>(
+            *vtx, trkAtVtx);
       }
-    }  // End loop over tracks at vertex
-    ACTS_VERBOSE("New vertex position: " << vtx->fullPosition().transpose());
-  }  // End loop over vertex collection
+    } else {
+      ACTS_VERBOSE("Track weight too low. Skip track.");
+    }
+  }  // End loop over tracks at vertex
+  ACTS_VERBOSE("New vertex position: " << vtx->fullPosition().transpose());
 
   return {};
 }
 
 template <typename input_track_t, typename linearizer_t>
-std::vector<double>
-Acts::AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::
-    collectTrackToVertexCompatibilities(State& state,
-                                        const input_track_t* trk) const {
-  // Compatibilities of trk wrt all of its associated vertices
-  std::vector<double> trkToVtxCompatibilities;
-
-  // Range of vertices that are associated with trk. The range is
-  // represented via its bounds: begin refers to the first iterator of the
-  // range; end refers to the iterator after the last iterator of the range.
-  auto [begin, end] = state.trackToVerticesMultiMap.equal_range(trk);
-
-  // Allocate space in memory for the vector of compatibilities
-  trkToVtxCompatibilities.reserve(std::distance(begin, end));
-
-  for (auto it = begin; it != end; ++it) {
-    // it->first corresponds to trk, it->second to one of its associated
-    // vertices
-    trkToVtxCompatibilities.push_back(
-        state.tracksAtVerticesMap.at(std::make_pair(trk, it->second))
-            .vertexCompatibility);
+void Acts::AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::
+    collectTrackToVertexCompatibilities(
+        const State& state, std::size_t trkIndex,
+        std::vector<double>& compatibilities) const {
+  compatibilities.clear();
+  // Loop over the links of the track to all of its associated vertices
+  for (std::size_t link : state.trackAdjacency[trkIndex]) {
+    compatibilities.push_back(state.tracksAtVertices[link].vertexCompatibility);
   }
-
-  return trkToVtxCompatibilities;
 }
 
 template <typename input_track_t, typename linearizer_t>
@@ -359,7 +426,7 @@ bool Acts::AdaptiveMultiVertexFitter<
     input_track_t, linearizer_t>::checkSmallShift(State& state) const {
   for (auto vtx : state.vertexCollection) {
     Vector3 diff =
-        state.vtxInfoMap[vtx].oldPosition.template head<3>() - vtx->position();
+        state.vertexInfo(*vtx).oldPosition.template head<3>() - vtx->position();
     const SquareMatrix3& vtxCov = vtx->covariance();
     double relativeShift = diff.dot(vtxCov.inverse() * diff);
     if (relativeShift > m_cfg.maxRelativeShift) {
@@ -373,8 +440,8 @@ template <typename input_track_t, typename linearizer_t>
 void Acts::AdaptiveMultiVertexFitter<
     input_track_t, linearizer_t>::doVertexSmoothing(State& state) const {
   for (const auto vtx : state.vertexCollection) {
-    for (const auto trk : state.vtxInfoMap[vtx].trackLinks) {
-      auto& trkAtVtx = state.tracksAtVerticesMap.at(std::make_pair(trk, vtx));
+    for (std::size_t link : state.vertexInfo(*vtx).links) {
+      auto& trkAtVtx = state.tracksAtVertices[link];
       if (trkAtVtx.trackWeight > m_cfg.minWeight) {
         // Update the new track under the assumption that it originates at the
         // vertex. The second template argument corresponds to the number of
@@ -397,16 +464,15 @@ void Acts::AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::logDebugData(
              << state.vertexCollection.size() << " vertices:");
   for (std::size_t vtxInd = 0; vtxInd < state.vertexCollection.size();
        ++vtxInd) {
-    auto vtx = state.vertexCollection[vtxInd];
+    const auto& vtxInfo = state.vertexInfo(*state.vertexCollection[vtxInd]);
     ACTS_DEBUG("Position of " << vtxInd << ". vertex seed:\n"
-                              << state.vtxInfoMap.at(vtx).seedPosition);
+                              << vtxInfo.seedPosition);
     ACTS_DEBUG("Position of said vertex after the last fitting step:\n"
-               << state.vtxInfoMap.at(vtx).oldPosition);
+               << vtxInfo.oldPosition);
     ACTS_DEBUG("Associated tracks:");
-    const auto& trks = state.vtxInfoMap.at(vtx).trackLinks;
-    for (std::size_t trkInd = 0; trkInd < trks.size(); ++trkInd) {
-      const auto& trkAtVtx =
-          state.tracksAtVerticesMap.at(std::make_pair(trks[trkInd], vtx));
+    const auto& links = vtxInfo.links;
+    for (std::size_t trkInd = 0; trkInd < links.size(); ++trkInd) {
+      const auto& trkAtVtx = state.tracksAtVertices[links[trkInd]];
       const auto& trkParams = m_extractParameters(*(trkAtVtx.originalParams));
       ACTS_DEBUG(trkInd << ". track parameters:\n" << trkParams.parameters());
       ACTS_DEBUG(trkInd << ". track covariance matrix:\n"
@@ -0,0 +1,174 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Utilities/Result.hpp"
+
+#include <utility>
+
+namespace Acts {
+
+/// @class DynamicGaussianGridTrackDensity
+/// @brief Variant of the GaussianGridTrackDensity whose main grid and track
+/// grid sizes are configured at runtime.
+///
+/// As in the GaussianGridTrackDensity, each track is modelled as a 2-dim
+/// Gaussian in the d0-z0 plane of which only the overlap with the z-axis is
+/// calculated. The density of a track is evaluated for all its z bins at
+/// once, using Eigen's vectorized exponential which is accurate to a few
+/// units in the last place. Tracks can be added to and removed from the main
+/// grid one at a time, e.g. while tracks are assigned to vertices.
+///
+/// The interface is the same as the one of the GaussianGridTrackDensity,
+/// such that it can be used by the GridDensityVertexFinder.
+class DynamicGaussianGridTrackDensity {
+ public:
+  using MainGridVector = Eigen::VectorXf;
+  using TrackGridVector = Eigen::VectorXf;
+
+  /// The configuration struct
+  struct Config {
+    /// @param zMinMax_ The minimum and maximum z-values (in mm) that
+    ///                 should be covered by the main 1-dim density grid along
+    ///                 the z-axis
+    /// @param mainGridSize_ The size of the z-axis 1-dim main density grid
+    /// @param trkGridSize_ The 2(!)-dim grid size of a single track, has to
+    ///                     be odd and smaller than @p mainGridSize_
+    Config(float zMinMax_ = 100, int mainGridSize_ = 2000,
+           int trkGridSize_ = 15)
+        : zMinMax(zMinMax_),
+          mainGridSize(mainGridSize_),
+          trkGridSize(trkGridSize_) {
+      binSize = 2. * zMinMax / mainGridSize;
+    }
+    // Min and max z value of big grid
+    float zMinMax;  // mm
+
+    // Number of bins of the main grid
+    int mainGridSize;
+
+    // Number of bins of a single track in d and z direction
+    int trkGridSize;
+
+    // Z size of one single bin in grid
+    float binSize;  // mm
+
+    // Do NOT use just the z-bin with the highest
+    // track density, but instead check the (up to)
+    // first three density maxima (only those that have
+    // a maximum relative deviation of 'relativeDensityDev'
+    // from the main maximum) and take the z-bin of the
+    // maximum with the highest surrounding density sum
+    bool useHighestSumZPosition = false;
+
+    // The maximum relative density deviation from the main
+    // maximum to consider the second and third maximum for
+    // the highest-sum approach from above
+    float maxRelativeDensityDev = 0.01;
+  };
+
+  /// @param cfg The configuration
+  /// @note Throws std::invalid_argument for an even track grid size or a
+  /// track grid that is not smaller than the main grid
+  DynamicGaussianGridTrackDensity(const Config& cfg);
+
+  /// @brief Returns an empty main grid of the configured size
+  MainGridVector emptyMainGrid() const;
+
+  /// @brief Returns the z position of maximum track density
+  ///
+  /// @param mainGrid The main 1-dim density grid along the z-axis
+  ///
+  /// @return The z position of maximum track density
+  Result<float> getMaxZPosition(MainGridVector& mainGrid) const;
+
+  /// @brief Returns the z position of maximum track density and
+  /// the estimated width
+  ///
+  /// @param mainGrid The main 1-dim density grid along the z-axis
+  ///
+  /// @return The z position of maximum track density and width
+  Result<std::pair<float, float>> getMaxZPositionAndWidth(
+      MainGridVector& mainGrid) const;
+
+  /// @brief Adds a single track to the overall grid density
+  ///
+  /// @param trk The track to be added
+  /// @param mainGrid The main 1-dim density grid along the z-axis
+  ///
+  /// @return A pair storing information about the z-bin position
+  /// the track was added (int) and the 1-dim density contribution
+  /// of the track itself
+  std::pair<int, TrackGridVector> addTrack(const BoundTrackParameters& trk,
+                                           MainGridVector& mainGrid) const;
+
+  /// @brief Removes a track from the overall grid density
+  ///
+  /// @param zBin The center z-bin position the track needs to be
+  /// removed from
+  /// @param trkGrid The 1-dim density contribution of the track
+  /// @param mainGrid The main 1-dim density grid along the z-axis
+  void removeTrackGridFromMainGrid(int zBin, const TrackGridVector& trkGrid,
+                                   MainGridVector& mainGrid) const;
+
+ private:
+  /// @brief Helper function that modifies the main density grid
+  /// (either adds or removes a track)
+  ///
+  /// @param zBin The center z-bin position the track
+  /// @param trkGrid The 1-dim density contribution of the track
+  /// @param mainGrid The main 1-dim density grid along the z-axis
+  /// @param modifyModeSign Sign that determines the mode of modification,
+  /// +1 for adding a track, -1 for removing a track
+  void modifyMainGridWithTrackGrid(int zBin, const TrackGridVector& trkGrid,
+                                   MainGridVector& mainGrid,
+                                   float modifyModeSign) const;
+
+  /// @brief Function that creates a 1-dim track grid (i.e. a vector)
+  /// with the correct density contribution of a track along the z-axis
+  ///
+  /// @param d0 Transverse impact parameter
+  /// @param distCtrZ The distance in z0 from the track position to its
+  /// bin center in the 2-dim grid
+  /// @param cov The track covariance matrix
+  TrackGridVector createTrackGrid(float d0, float distCtrZ,
+                                  const SquareMatrix2& cov) const;
+
+  /// @brief Function that estimates the seed width based on the FWHM of
+  /// the maximum density peak
+  ///
+  /// @param mainGrid The main 1-dim density grid along the z-axis
+  /// @param maxZ z-position of the maximum density value
+  ///
+  /// @return The width
+  Result<float> estimateSeedWidth(const MainGridVector& mainGrid,
+                                  float maxZ) const;
+
+  /// @brief Checks the (up to) first three density maxima and returns the
+  /// z-bin of the maximum with the highest surrounding density
+  ///
+  /// @param mainGrid The main 1-dim density grid along the z-axis
+  ///
+  /// @return The z-bin position
+  int getHighestSumZPosition(MainGridVector& mainGrid) const;
+
+  /// @brief Calculates the density sum of a z-bin and its two neighboring bins
+  ///
+  /// @param mainGrid The main 1-dim density grid along the z-axis
+  /// @param pos The center z-bin position
+  ///
+  /// @return The sum
+  double getDensitySum(const MainGridVector& mainGrid, int pos) const;
+
+  Config m_cfg;
+};
+
+}  // namespace Acts
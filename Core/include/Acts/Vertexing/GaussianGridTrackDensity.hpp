@@ -69,6 +69,9 @@ class GaussianGridTrackDensity {
 
   GaussianGridTrackDensity(const Config& cfg) : m_cfg(cfg) {}
 
+  /// @brief Returns an empty main grid
+  MainGridVector emptyMainGrid() const { return MainGridVector::Zero(); }
+
   /// @brief Returns the z position of maximum track density
   ///
   /// @param mainGrid The main 1-dim density grid along the z-axis
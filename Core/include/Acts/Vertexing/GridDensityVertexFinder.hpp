@@ -31,8 +31,14 @@ namespace Acts {
 /// @tparam trkGridSize The 2(!)-dim grid size of a single track, i.e.
 /// a single track is modelled as a (trkGridSize x trkGridSize) grid
 /// in the d0-z0 plane. Note: trkGridSize has to be an odd value.
+/// @tparam vfitter_t The vertex fitter type
+/// @tparam grid_density_t The grid density type, e.g. the
+/// DynamicGaussianGridTrackDensity if the grid sizes should be configured at
+/// runtime, in which case mainGridSize and trkGridSize are not used
 template <int mainGridSize = 2000, int trkGridSize = 15,
-          typename vfitter_t = DummyVertexFitter<>>
+          typename vfitter_t = DummyVertexFitter<>,
+          typename grid_density_t =
+              GaussianGridTrackDensity<mainGridSize, trkGridSize>>
 class GridDensityVertexFinder {
   // Assert odd trkGridSize
   static_assert(trkGridSize % 2);
@@ -40,7 +46,7 @@ class GridDensityVertexFinder {
   static_assert(mainGridSize > trkGridSize);
 
   using InputTrack_t = typename vfitter_t::InputTrack_t;
-  using GridDensity = GaussianGridTrackDensity<mainGridSize, trkGridSize>;
+  using GridDensity = grid_density_t;
 
  public:
   using MainGridVector = typename GridDensity::MainGridVector;
@@ -79,8 +85,12 @@ class GridDensityVertexFinder {
   ///
   /// Only needed if cacheGridStateForTrackRemoval == true
   struct State {
-    // The main density grid
-    MainGridVector mainGrid = MainGridVector::Zero();
+    // The main density grid, empty for a runtime-sized grid density until
+    // the first call to find
+    MainGridVector mainGrid = MainGridVector::Zero(
+        MainGridVector::SizeAtCompileTime == Eigen::Dynamic
+            ? 0
+            : MainGridVector::SizeAtCompileTime);
     // Map to store z-bin and track grid (i.e. the density contribution of
     // a single track to the main grid) for every single track
     std::map<const InputTrack_t*, std::pair<int, TrackGridVector>>
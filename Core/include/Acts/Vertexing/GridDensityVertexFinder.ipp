@@ -6,8 +6,10 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
-template <int mainGridSize, int trkGridSize, typename vfitter_t>
-auto Acts::GridDensityVertexFinder<mainGridSize, trkGridSize, vfitter_t>::find(
+template <int mainGridSize, int trkGridSize, typename vfitter_t,
+          typename grid_density_t>
+auto Acts::GridDensityVertexFinder<mainGridSize, trkGridSize, vfitter_t,
+                                   grid_density_t>::find(
     const std::vector<const InputTrack_t*>& trackVector,
     const VertexingOptions<InputTrack_t>& vertexingOptions, State& state) const
     -> Result<std::vector<Vertex<InputTrack_t>>> {
@@ -34,7 +36,7 @@ auto Acts::GridDensityVertexFinder<mainGridSize, trkGridSize, vfitter_t>::find(
       return seedVec;
     }
   } else {
-    state.mainGrid = MainGridVector::Zero();
+    state.mainGrid = m_cfg.gridDensity.emptyMainGrid();
     // Fill with track densities
     for (auto trk : trackVector) {
       const BoundTrackParameters& trkParams = m_extractParameters(*trk);
@@ -58,7 +60,7 @@ auto Acts::GridDensityVertexFinder<mainGridSize, trkGridSize, vfitter_t>::find(
 
   double z = 0;
   double width = 0;
-  if (state.mainGrid != MainGridVector::Zero()) {
+  if (!state.mainGrid.isZero(0.)) {
     if (!m_cfg.estimateSeedWidth) {
       // Get z value of highest density bin
       auto maxZres = m_cfg.gridDensity.getMaxZPosition(state.mainGrid);
@@ -98,8 +100,10 @@ auto Acts::GridDensityVertexFinder<mainGridSize, trkGridSize, vfitter_t>::find(
   return seedVec;
 }
 
-template <int mainGridSize, int trkGridSize, typename vfitter_t>
-auto Acts::GridDensityVertexFinder<mainGridSize, trkGridSize, vfitter_t>::
+template <int mainGridSize, int trkGridSize, typename vfitter_t,
+          typename grid_density_t>
+auto Acts::GridDensityVertexFinder<mainGridSize, trkGridSize, vfitter_t,
+                                   grid_density_t>::
     doesPassTrackSelection(const BoundTrackParameters& trk) const -> bool {
   // Get required track parameters
   const double d0 = trk.parameters()[BoundIndices::eBoundLoc0];
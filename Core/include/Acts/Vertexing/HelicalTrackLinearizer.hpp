@@ -82,6 +82,14 @@ class HelicalTrackLinearizer {
     /// Tolerance determining how close we need to get to the Perigee surface to
     /// reach it during propagation
     ActsScalar targetTolerance = 1e-12;
+
+    /// Transport the track parameters to the Perigee surface along an
+    /// analytic helix instead of running the propagator if the magnetic field
+    /// is homogeneous. Falls back to the propagator otherwise.
+    bool useAnalyticHelix = false;
+    /// Relative field variation between the track and the Perigee surface
+    /// below which the field is considered to be homogeneous
+    ActsScalar fieldTolerance = 1e-4;
   };
 
   /// @brief Constructor
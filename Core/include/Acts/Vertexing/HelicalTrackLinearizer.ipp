@@ -6,6 +6,7 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include "Acts/Propagator/detail/HelixTransport.hpp"
 #include "Acts/Surfaces/PerigeeSurface.hpp"
 #include "Acts/Vertexing/LinearizerTrackParameters.hpp"
 
@@ -15,50 +16,60 @@ Acts::Result<Acts::LinearizedTrack> Acts::
         const BoundTrackParameters& params, double linPointTime,
         const Surface& perigeeSurface, const Acts::GeometryContext& gctx,
         const Acts::MagneticFieldContext& mctx, State& state) const {
-  // Create propagator options
-  propagator_options_t pOptions(gctx, mctx);
-
-  // Length scale at which we consider to be sufficiently close to the Perigee
-  // surface to skip the propagation.
-  pOptions.surfaceTolerance = m_cfg.targetTolerance;
-
-  // Get intersection of the track with the Perigee if the particle would
-  // move on a straight line.
-  // This allows us to determine whether we need to propagate the track
-  // forward or backward to arrive at the PCA.
-  auto intersection = perigeeSurface
-                          .intersect(gctx, params.position(gctx),
-                                     params.direction(), BoundaryCheck(false))
-                          .closest();
-
-  // Setting the propagation direction using the intersection length from
-  // above
-  // We handle zero path length as forward propagation, but we could actually
-  // skip the whole propagation in this case
-  pOptions.direction =
-      Direction::fromScalarZeroAsPositive(intersection.pathLength());
-
-  // Propagate to the PCA of the reference point
-  auto result = m_cfg.propagator->propagate(params, perigeeSurface, pOptions);
-  if (!result.ok()) {
-    return result.error();
+  // Track parameters at the PCA of the reference point - this corresponds to
+  // the Perigee representation of the track wrt the reference point
+  std::optional<BoundTrackParameters> endParams;
+
+  if (m_cfg.useAnalyticHelix) {
+    endParams = detail::tryTransportAlongHelix(
+        gctx, params, perigeeSurface, *m_cfg.bField, state.fieldCache,
+        m_cfg.fieldTolerance, m_cfg.targetTolerance);
   }
 
-  // Extracting the track parameters at said PCA - this corresponds to the
-  // Perigee representation of the track wrt the reference point
-  const auto& endParams = *result->endParameters;
-  BoundVector paramsAtPCA = endParams.parameters();
+  if (!endParams.has_value()) {
+    // Create propagator options
+    propagator_options_t pOptions(gctx, mctx);
+
+    // Length scale at which we consider to be sufficiently close to the Perigee
+    // surface to skip the propagation.
+    pOptions.surfaceTolerance = m_cfg.targetTolerance;
+
+    // Get intersection of the track with the Perigee if the particle would
+    // move on a straight line.
+    // This allows us to determine whether we need to propagate the track
+    // forward or backward to arrive at the PCA.
+    auto intersection = perigeeSurface
+                            .intersect(gctx, params.position(gctx),
+                                       params.direction(), BoundaryCheck(false))
+                            .closest();
+
+    // Setting the propagation direction using the intersection length from
+    // above
+    // We handle zero path length as forward propagation, but we could actually
+    // skip the whole propagation in this case
+    pOptions.direction =
+        Direction::fromScalarZeroAsPositive(intersection.pathLength());
+
+    // Propagate to the PCA of the reference point
+    auto result = m_cfg.propagator->propagate(params, perigeeSurface, pOptions);
+    if (!result.ok()) {
+      return result.error();
+    }
+    endParams = *result->endParameters;
+  }
+
+  BoundVector paramsAtPCA = endParams->parameters();
 
   // Extracting the 4D position of the PCA in global coordinates
   Vector4 pca = Vector4::Zero();
   {
-    auto pos = endParams.position(gctx);
+    auto pos = endParams->position(gctx);
     pca[ePos0] = pos[ePos0];
     pca[ePos1] = pos[ePos1];
     pca[ePos2] = pos[ePos2];
-    pca[eTime] = endParams.time();
+    pca[eTime] = endParams->time();
   }
-  BoundSquareMatrix parCovarianceAtPCA = endParams.covariance().value();
+  BoundSquareMatrix parCovarianceAtPCA = endParams->covariance().value();
 
   // Extracting Perigee parameters and compute functions of them for later
   // usage
@@ -82,6 +82,13 @@ class ImpactPointEstimator {
     int maxIterations = 20;
     /// Desired precision of deltaPhi in Newton method
     double precision = 1.e-10;
+    /// Transport the track parameters in `estimate3DImpactParameters` along
+    /// an analytic helix instead of running the propagator if the magnetic
+    /// field is homogeneous. Falls back to the propagator otherwise.
+    bool useAnalyticHelix = false;
+    /// Relative field variation between the track and the reference plane
+    /// below which the field is considered to be homogeneous
+    double fieldTolerance = 1e-4;
   };
 
   /// @brief Constructor
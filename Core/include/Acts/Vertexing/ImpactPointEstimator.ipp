@@ -6,7 +6,9 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include "Acts/Definitions/Tolerance.hpp"
 #include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/detail/HelixTransport.hpp"
 #include "Acts/Surfaces/PerigeeSurface.hpp"
 #include "Acts/Surfaces/PlaneSurface.hpp"
 #include "Acts/Vertexing/VertexingError.hpp"
@@ -81,6 +83,18 @@ Acts::ImpactPointEstimator<input_track_t, propagator_t, propagator_options_t>::
   std::shared_ptr<PlaneSurface> planeSurface =
       Surface::makeShared<PlaneSurface>(coordinateSystem);
 
+  if (m_cfg.useAnalyticHelix) {
+    auto helixParams = detail::tryTransportAlongHelix(
+        gctx, trkParams, *planeSurface, *m_cfg.bField, state.fieldCache,
+        m_cfg.fieldTolerance, s_onSurfaceTolerance);
+    if (helixParams.has_value()) {
+      return std::move(*helixParams);
+    }
+    ACTS_VERBOSE(
+        "Analytic helix transport not applicable, falling back to the "
+        "propagator.");
+  }
+
   auto intersection =
       planeSurface
           ->intersect(gctx, trkParams.position(gctx), trkParams.direction(),
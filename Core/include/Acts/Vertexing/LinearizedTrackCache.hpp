@@ -0,0 +1,189 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Utilities/Result.hpp"
+#include "Acts/Vertexing/LinearizedTrack.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Acts {
+
+/// @class LinearizedTrackCache
+///
+/// Cache of track linearizations keyed on the track and the linearization
+/// point.
+///
+/// The linearization point is quantized into cells whose size is given by
+/// the tolerance, separately for each of the four coordinates (the time is
+/// given in native units, i.e. as a length). A cached linearization is
+/// reused if it belongs to the same cell and none of the coordinates of its
+/// linearization point differs by more than the tolerance from the requested
+/// one. The returned linearization is then defined with respect to the
+/// cached linearization point, which is consistent for the vertex update.
+///
+/// Lookups through a set of @ref Insertions only see the linearizations
+/// that were committed before, and new linearizations are only added by
+/// @ref commit. Lookups of tasks running concurrently, e.g. vertices that
+/// are fitted in parallel, are therefore allowed and the reused
+/// linearizations do not depend on the scheduling as long as the insertions
+/// are committed in a fixed order.
+class LinearizedTrackCache {
+ private:
+  struct Key {
+    std::size_t track = 0;
+    std::array<std::int64_t, 4> cell = {};
+
+    bool operator==(const Key& other) const {
+      return track == other.track && cell == other.cell;
+    }
+  };
+
+  struct KeyHash {
+    std::size_t operator()(const Key& key) const {
+      std::size_t seed = std::hash<std::size_t>()(key.track);
+      for (std::int64_t c : key.cell) {
+        seed ^= std::hash<std::int64_t>()(c) + 0x9e3779b9 + (seed << 6) +
+                (seed >> 2);
+      }
+      return seed;
+    }
+  };
+
+ public:
+  /// Cache statistics
+  struct Statistics {
+    /// Number of lookups served from the cache
+    std::size_t hits = 0;
+    /// Number of lookups that required a new linearization
+    std::size_t misses = 0;
+  };
+
+  /// Linearizations and statistics of a set of lookups that have not been
+  /// committed to the cache yet
+  class Insertions {
+   public:
+    /// Number of pending linearizations
+    std::size_t size() const { return m_entries.size(); }
+
+   private:
+    friend class LinearizedTrackCache;
+
+    std::vector<std::pair<Key, LinearizedTrack>> m_entries;
+    Statistics m_statistics;
+  };
+
+  /// Get the linearization of a track at a linearization point, either
+  /// from the committed linearizations or by calling the linearizer. New
+  /// linearizations are recorded in the insertions.
+  ///
+  /// @tparam linearize_t Callable returning a `Result<LinearizedTrack>`
+  ///
+  /// @param trackIndex Unique index of the track
+  /// @param linPoint The requested linearization point
+  /// @param tolerance The tolerance for reusing a linearization, the cache
+  ///        is bypassed if it is not positive
+  /// @param linearize The linearizer
+  /// @param insertions The pending insertions of the calling task
+  ///
+  /// @return The linearized track
+  template <typename linearize_t>
+  Result<LinearizedTrack> get(std::size_t trackIndex, const Vector4& linPoint,
+                              double tolerance, linearize_t&& linearize,
+                              Insertions& insertions) const {
+    if (!(tolerance > 0.)) {
+      return linearize();
+    }
+
+    Key key{trackIndex, {}};
+    for (std::size_t i = 0; i < 4; ++i) {
+      key.cell[i] =
+          static_cast<std::int64_t>(std::floor(linPoint[i] / tolerance));
+    }
+
+    auto it = m_entries.find(key);
+    if (it != m_entries.end() &&
+        (it->second.linearizationPoint - linPoint).cwiseAbs().maxCoeff() <=
+            tolerance) {
+      ++insertions.m_statistics.hits;
+      return it->second;
+    }
+
+    auto result = linearize();
+    if (!result.ok()) {
+      return result;
+    }
+
+    ++insertions.m_statistics.misses;
+    insertions.m_entries.emplace_back(key, *result);
+    return result;
+  }
+
+  /// Get the linearization of a track at a linearization point and commit
+  /// a new linearization immediately.
+  ///
+  /// @tparam linearize_t Callable returning a `Result<LinearizedTrack>`
+  ///
+  /// @param trackIndex Unique index of the track
+  /// @param linPoint The requested linearization point
+  /// @param tolerance The tolerance for reusing a linearization, the cache
+  ///        is bypassed if it is not positive
+  /// @param linearize The linearizer
+  ///
+  /// @return The linearized track
+  template <typename linearize_t>
+  Result<LinearizedTrack> get(std::size_t trackIndex, const Vector4& linPoint,
+                              double tolerance, linearize_t&& linearize) {
+    Insertions insertions;
+    auto result = get(trackIndex, linPoint, tolerance,
+                      std::forward<linearize_t>(linearize), insertions);
+    commit(insertions);
+    return result;
+  }
+
+  /// Add pending linearizations to the cache, replacing cached ones in the
+  /// same cell, and clear the insertions.
+  ///
+  /// @param insertions The insertions to commit
+  void commit(Insertions& insertions) {
+    for (auto& [key, linTrack] : insertions.m_entries) {
+      m_entries.insert_or_assign(key, std::move(linTrack));
+    }
+    m_statistics.hits += insertions.m_statistics.hits;
+    m_statistics.misses += insertions.m_statistics.misses;
+    insertions.m_entries.clear();
+    insertions.m_statistics = Statistics();
+  }
+
+  /// Number of cached linearizations
+  std::size_t size() const { return m_entries.size(); }
+
+  /// The cache statistics
+  Statistics statistics() const { return m_statistics; }
+
+  /// Remove all cached linearizations and reset the statistics
+  void clear() {
+    m_entries.clear();
+    m_statistics = Statistics();
+  }
+
+ private:
+  std::unordered_map<Key, LinearizedTrack, KeyHash> m_entries;
+  Statistics m_statistics;
+};
+
+}  // namespace Acts
@@ -0,0 +1,229 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace Acts {
+
+/// @class SparseDensityMap
+///
+/// Flat map between z-t bins and track densities.
+///
+/// The entries are stored contiguously and sorted by the t bin first and the
+/// z bin second, such that the bins of a track form contiguous runs in z. The
+/// densities of a track are added with a single merge pass instead of one
+/// hash lookup per bin. The entry with the highest density is tracked
+/// incrementally: adding densities only compares the touched entries with
+/// the current maximum, and a full scan is only needed if the maximum itself
+/// was decreased or modified through a mutable reference.
+///
+/// The interface mirrors the subset of `std::unordered_map` used for the
+/// density maps, iteration yields `std::pair<Bin, float>` in sorted order.
+class SparseDensityMap {
+ public:
+  // The first (second) integer indicates the bin's z (t) position
+  using Bin = std::pair<int, int>;
+  using value_type = std::pair<Bin, float>;
+  using const_iterator = std::vector<value_type>::const_iterator;
+  using iterator = const_iterator;
+
+  SparseDensityMap() = default;
+
+  const_iterator begin() const { return m_entries.begin(); }
+  const_iterator end() const { return m_entries.end(); }
+
+  bool empty() const { return m_entries.empty(); }
+  std::size_t size() const { return m_entries.size(); }
+
+  void reserve(std::size_t n) { m_entries.reserve(n); }
+
+  void clear() {
+    m_entries.clear();
+    m_maxValid = false;
+  }
+
+  /// Find the entry of a bin
+  /// @param bin The bin
+  /// @return Iterator to the entry or end() if the bin is not filled
+  const_iterator find(const Bin& bin) const {
+    auto it = lowerBound(m_entries.begin(), m_entries.end(), bin);
+    if (it != m_entries.end() && it->first == bin) {
+      return it;
+    }
+    return m_entries.end();
+  }
+
+  /// @param bin The bin
+  /// @return 1 if the bin is filled, 0 otherwise
+  std::size_t count(const Bin& bin) const {
+    return find(bin) != m_entries.end() ? 1 : 0;
+  }
+
+  /// @param bin The bin, which must be filled
+  /// @return The density of the bin
+  float at(const Bin& bin) const {
+    auto it = find(bin);
+    if (it == m_entries.end()) {
+      throw std::out_of_range("SparseDensityMap: bin is not filled");
+    }
+    return it->second;
+  }
+
+  /// Mutable access to the density of a filled bin
+  /// @note This invalidates the tracked maximum
+  float& at(const Bin& bin) {
+    auto it = lowerBound(m_entries.begin(), m_entries.end(), bin);
+    if (it == m_entries.end() || it->first != bin) {
+      throw std::out_of_range("SparseDensityMap: bin is not filled");
+    }
+    m_maxValid = false;
+    return it->second;
+  }
+
+  /// Mutable access to the density of a bin, which is inserted with zero
+  /// density if it is not filled yet
+  /// @note This invalidates the tracked maximum
+  float& operator[](const Bin& bin) {
+    auto it = lowerBound(m_entries.begin(), m_entries.end(), bin);
+    if (it == m_entries.end() || it->first != bin) {
+      it = m_entries.insert(it, value_type(bin, 0.f));
+    }
+    m_maxValid = false;
+    return it->second;
+  }
+
+  /// Add the weighted densities of another map, bins that are not filled
+  /// yet are inserted.
+  ///
+  /// @param other The densities to add
+  /// @param weight The weight of the added densities, e.g. -1 to remove
+  ///        a track that was added before
+  void accumulate(const SparseDensityMap& other, float weight = 1.f) {
+    if (other.empty()) {
+      return;
+    }
+
+    // Count the bins that need to be inserted, the bins of the other map are
+    // searched in increasing order
+    std::size_t nMissing = 0;
+    {
+      auto it = m_entries.begin();
+      for (const auto& [bin, density] : other.m_entries) {
+        it = lowerBound(it, m_entries.end(), bin);
+        if (it == m_entries.end() || it->first != bin) {
+          ++nMissing;
+        } else {
+          ++it;
+        }
+      }
+    }
+
+    bool maxTouched = false;
+    auto update = [&](value_type& entry, float added) {
+      if (m_maxValid) {
+        if (entry.first == m_maxEntry.first) {
+          m_maxEntry.second = entry.second;
+          maxTouched = maxTouched || added < 0.f;
+        } else if (isLarger(entry, m_maxEntry)) {
+          m_maxEntry = entry;
+        }
+      }
+    };
+
+    if (nMissing == 0) {
+      auto it = m_entries.begin();
+      for (const auto& [bin, density] : other.m_entries) {
+        it = lowerBound(it, m_entries.end(), bin);
+        it->second += weight * density;
+        update(*it, weight * density);
+        ++it;
+      }
+    } else {
+      // Merge from the back, which moves every existing entry at most once
+      std::size_t nOld = m_entries.size();
+      m_entries.resize(nOld + nMissing);
+      auto out = m_entries.rbegin();
+      auto old = std::next(m_entries.rbegin(), nMissing);
+      auto oldEnd = m_entries.rend();
+      for (auto add = other.m_entries.rbegin(); add != other.m_entries.rend();
+           ++add, ++out) {
+        while (old != oldEnd && less(add->first, old->first)) {
+          *out = *old;
+          ++old;
+          ++out;
+        }
+        if (old != oldEnd && old->first == add->first) {
+          *out = *old;
+          out->second += weight * add->second;
+          ++old;
+        } else {
+          *out = value_type(add->first, weight * add->second);
+        }
+        update(*out, weight * add->second);
+      }
+    }
+
+    // Only a decreased maximum can be overtaken by an untouched entry
+    if (maxTouched) {
+      m_maxValid = false;
+    }
+  }
+
+  /// Entry with the highest density; ties are resolved in favour of the
+  /// first entry in iteration order
+  /// @return Iterator to the entry or end() if the map is empty
+  const_iterator maxEntry() const {
+    if (m_entries.empty()) {
+      return m_entries.end();
+    }
+    if (!m_maxValid) {
+      auto it = std::max_element(m_entries.begin(), m_entries.end(),
+                                 [](const value_type& a, const value_type& b) {
+                                   return a.second < b.second;
+                                 });
+      m_maxEntry = *it;
+      m_maxValid = true;
+      return it;
+    }
+    return find(m_maxEntry.first);
+  }
+
+ private:
+  /// Ordering of the bins, t first and z second
+  static bool less(const Bin& a, const Bin& b) {
+    return a.second < b.second || (a.second == b.second && a.first < b.first);
+  }
+
+  /// Whether an entry replaces the current maximum, consistent with a scan
+  /// using std::max_element
+  static bool isLarger(const value_type& entry, const value_type& max) {
+    return entry.second > max.second ||
+           (entry.second == max.second && less(entry.first, max.first));
+  }
+
+  template <typename iterator_t>
+  static iterator_t lowerBound(iterator_t first, iterator_t last,
+                               const Bin& bin) {
+    return std::lower_bound(first, last, bin,
+                            [](const value_type& entry, const Bin& b) {
+                              return less(entry.first, b);
+                            });
+  }
+
+  std::vector<value_type> m_entries;
+  mutable value_type m_maxEntry;
+  mutable bool m_maxValid = false;
+};
+
+}  // namespace Acts
@@ -8,39 +8,110 @@
 
 #include "Acts/AmbiguityResolution/GreedyAmbiguityResolution.hpp"
 
+#include <algorithm>
+#include <limits>
+#include <utility>
+
 namespace Acts {
 
 namespace {
 
-/// Removes a track from the state which has to be done for multiple properties
-/// because of redundancy.
-static void removeTrack(GreedyAmbiguityResolution::State& state,
-                        std::size_t iTrack) {
-  for (auto iMeasurement : state.measurementsPerTrack[iTrack]) {
-    state.tracksPerMeasurement[iMeasurement].erase(iTrack);
+/// Binary max-heap of track indices which keeps track of the position of each
+/// track, such that a track can be removed or its key can be changed in
+/// logarithmic time.
+template <typename less_t>
+class IndexedMaxHeap {
+ public:
+  IndexedMaxHeap(std::size_t nTracks, less_t less)
+      : m_position(nTracks, s_invalid), m_less(std::move(less)) {}
+
+  bool empty() const { return m_heap.empty(); }
+
+  bool contains(std::size_t iTrack) const {
+    return m_position[iTrack] != s_invalid;
+  }
+
+  std::size_t top() const { return m_heap.front(); }
 
-    if (state.tracksPerMeasurement[iMeasurement].size() == 1) {
-      auto jTrack = *state.tracksPerMeasurement[iMeasurement].begin();
-      --state.sharedMeasurementsPerTrack[jTrack];
+  void push(std::size_t iTrack) {
+    m_position[iTrack] = m_heap.size();
+    m_heap.push_back(iTrack);
+    siftUp(m_heap.size() - 1);
+  }
+
+  void erase(std::size_t iTrack) {
+    std::size_t pos = m_position[iTrack];
+    if (pos == s_invalid) {
+      return;
+    }
+    swap(pos, m_heap.size() - 1);
+    m_heap.pop_back();
+    m_position[iTrack] = s_invalid;
+    if (pos < m_heap.size()) {
+      update(m_heap[pos]);
     }
   }
 
-  state.selectedTracks.erase(iTrack);
-}
+  /// Restores the heap property after the key of a track changed
+  void update(std::size_t iTrack) {
+    std::size_t pos = m_position[iTrack];
+    if (pos == s_invalid) {
+      return;
+    }
+    siftDown(siftUp(pos));
+  }
+
+ private:
+  static constexpr std::size_t s_invalid =
+      std::numeric_limits<std::size_t>::max();
+
+  void swap(std::size_t a, std::size_t b) {
+    std::swap(m_heap[a], m_heap[b]);
+    m_position[m_heap[a]] = a;
+    m_position[m_heap[b]] = b;
+  }
+
+  std::size_t siftUp(std::size_t pos) {
+    while (pos > 0) {
+      std::size_t parent = (pos - 1) / 2;
+      if (!m_less(m_heap[parent], m_heap[pos])) {
+        break;
+      }
+      swap(parent, pos);
+      pos = parent;
+    }
+    return pos;
+  }
+
+  void siftDown(std::size_t pos) {
+    while (true) {
+      std::size_t largest = pos;
+      for (std::size_t child = 2 * pos + 1;
+           child < std::min(2 * pos + 3, m_heap.size()); ++child) {
+        if (m_less(m_heap[largest], m_heap[child])) {
+          largest = child;
+        }
+      }
+      if (largest == pos) {
+        break;
+      }
+      swap(largest, pos);
+      pos = largest;
+    }
+  }
+
+  std::vector<std::size_t> m_heap;
+  std::vector<std::size_t> m_position;
+  less_t m_less;
+};
 
 }  // namespace
 
 void GreedyAmbiguityResolution::resolve(State& state) const {
-  /// Compares two tracks based on the number of shared measurements in order to
-  /// decide if we already met the final state.
-  auto sharedMeasurementsComperator = [&state](std::size_t a, std::size_t b) {
-    return state.sharedMeasurementsPerTrack[a] <
-           state.sharedMeasurementsPerTrack[b];
-  };
-
   /// Compares two tracks in order to find the one which should be evicted.
   /// First we compare the relative amount of shared measurements. If that is
-  /// indecisive we use the chi2.
+  /// indecisive we use the chi2 and finally the track index, such that the
+  /// track with the lower index is evicted first.
   auto trackComperator = [&state](std::size_t a, std::size_t b) {
     /// Helper to calculate the relative amount of shared measurements.
     auto relativeSharedMeasurements = [&state](std::size_t i) {
@@ -51,40 +122,89 @@ void GreedyAmbiguityResolution::resolve(State& state) const {
     if (relativeSharedMeasurements(a) != relativeSharedMeasurements(b)) {
       return relativeSharedMeasurements(a) < relativeSharedMeasurements(b);
     }
-    return state.trackChi2[a] < state.trackChi2[b];
+    if (state.trackChi2[a] != state.trackChi2[b]) {
+      return state.trackChi2[a] < state.trackChi2[b];
+    }
+    return a > b;
   };
 
+  IndexedMaxHeap<decltype(trackComperator)> heap(state.numberOfTracks,
+                                                 trackComperator);
+  // Number of selected tracks with too many shared measurements, the
+  // resolution is done once there are none left
+  std::size_t nTracksAboveMaximum = 0;
+  for (auto iTrack : state.selectedTracks) {
+    heap.push(iTrack);
+    if (state.sharedMeasurementsPerTrack[iTrack] >= m_cfg.maximumSharedHits) {
+      ++nTracksAboveMaximum;
+    }
+  }
+
+  /// Removes a track from the state which has to be done for multiple
+  /// properties because of redundancy.
+  auto removeTrack = [&](std::size_t iTrack) {
+    if (state.sharedMeasurementsPerTrack[iTrack] >= m_cfg.maximumSharedHits) {
+      --nTracksAboveMaximum;
+    }
+    heap.erase(iTrack);
+
+    for (auto iMeasurement : state.measurementsPerTrack[iTrack]) {
+      auto& tracks = state.tracksPerMeasurement[iMeasurement];
+      auto it = std::find(tracks.begin(), tracks.end(), iTrack);
+      if (it != tracks.end()) {
+        *it = tracks.back();
+        tracks.pop_back();
+      }
+
+      if (tracks.size() == 1) {
+        auto jTrack = tracks.front();
+        if (heap.contains(jTrack) &&
+            state.sharedMeasurementsPerTrack[jTrack] ==
+                m_cfg.maximumSharedHits) {
+          --nTracksAboveMaximum;
+        }
+        --state.sharedMeasurementsPerTrack[jTrack];
+        heap.update(jTrack);
+      }
+    }
+  };
+
+  std::vector<bool> removed(state.numberOfTracks, false);
   for (std::size_t i = 0; i < m_cfg.maximumIterations; ++i) {
     // Lazy out if there is nothing to filter on.
-    if (state.selectedTracks.empty()) {
+    if (heap.empty()) {
       ACTS_VERBOSE("no tracks left - exit loop");
       break;
     }
 
-    // Find the maximum amount of shared measurements per track to decide if we
-    // are done or not.
-    auto maximumSharedMeasurements = *std::max_element(
-        state.selectedTracks.begin(), state.selectedTracks.end(),
-        sharedMeasurementsComperator);
-    ACTS_VERBOSE(
-        "maximum shared measurements "
-        << state.sharedMeasurementsPerTrack[maximumSharedMeasurements]);
-    if (state.sharedMeasurementsPerTrack[maximumSharedMeasurements] <
-        m_cfg.maximumSharedHits) {
+    // Check if any track still has too many shared measurements to decide if
+    // we are done or not.
+    ACTS_VERBOSE("tracks above maximum shared measurements "
+                 << nTracksAboveMaximum);
+    if (nTracksAboveMaximum == 0) {
       break;
     }
 
-    // Find the "worst" track by comparing them to each other
-    auto badTrack =
-        *std::max_element(state.selectedTracks.begin(),
-                          state.selectedTracks.end(), trackComperator);
+    // The "worst" track is on top of the heap
+    auto badTrack = heap.top();
     ACTS_VERBOSE("remove track "
                  << badTrack << " nMeas "
                  << state.measurementsPerTrack[badTrack].size() << " nShared "
                  << state.sharedMeasurementsPerTrack[badTrack] << " chi2 "
                  << state.trackChi2[badTrack]);
-    removeTrack(state, badTrack);
+    removeTrack(badTrack);
+    removed[badTrack] = true;
   }
+
+  // Erasing from the flat set once avoids moving its elements for every
+  // removed track
+  auto selectedTracks = state.selectedTracks.extract_sequence();
+  auto isRemoved = [&removed](std::size_t iTrack) { return removed[iTrack]; };
+  selectedTracks.erase(
+      std::remove_if(selectedTracks.begin(), selectedTracks.end(), isRemoved),
+      selectedTracks.end());
+  state.selectedTracks.adopt_sequence(boost::container::ordered_unique_range,
+                                      std::move(selectedTracks));
 }
 
 }  // namespace Acts
@@ -0,0 +1,28 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/EventData/CompactTrackStates.hpp"
+
+#include "Acts/EventData/VectorMultiTrajectory.hpp"
+
+namespace Acts {
+
+void packTrackStates(VectorMultiTrajectory& trajectory,
+                     TrackStatePropMask mask) {
+  TrackStatePropMask present = TrackStatePropMask::None;
+  for (VectorMultiTrajectory::IndexType i = 0; i < trajectory.size(); ++i) {
+    present |= trajectory.getTrackState(i).getMask();
+  }
+  addCompactTrackStateColumns(trajectory, mask & present);
+  for (VectorMultiTrajectory::IndexType i = 0; i < trajectory.size(); ++i) {
+    packTrackState(trajectory.getTrackState(i), mask);
+  }
+  trajectory.releaseUnusedComponents();
+}
+
+}  // namespace Acts
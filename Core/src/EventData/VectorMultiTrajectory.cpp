@@ -13,8 +13,11 @@
 #include "Acts/Utilities/Helpers.hpp"
 
 #include <iomanip>
+#include <memory>
 #include <ostream>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <boost/histogram.hpp>
 #include <boost/histogram/axis/category.hpp>
@@ -37,6 +40,7 @@ auto VectorMultiTrajectory::addTrackState_impl(TrackStatePropMask mask,
 
   // always set, but can be null
   m_referenceSurfaces.emplace_back(nullptr);
+  m_referenceSurfaceOwners.emplace_back(kInvalid);
 
   assert(m_params.size() == m_cov.size());
 
@@ -167,6 +171,103 @@ void VectorMultiTrajectory::unset_impl(TrackStatePropMask target,
   }
 }
 
+void VectorMultiTrajectory::addTrackStateComponents_impl(
+    IndexType istate, TrackStatePropMask mask) {
+  using PropMask = TrackStatePropMask;
+
+  IndexData& p = m_index[istate];
+
+  assert(m_params.size() == m_cov.size());
+
+  if (ACTS_CHECK_BIT(mask, PropMask::Predicted) && p.ipredicted == kInvalid) {
+    m_params.emplace_back();
+    m_cov.emplace_back();
+    p.ipredicted = m_params.size() - 1;
+    p.allocMask |= PropMask::Predicted;
+  }
+
+  if (ACTS_CHECK_BIT(mask, PropMask::Filtered) && p.ifiltered == kInvalid) {
+    m_params.emplace_back();
+    m_cov.emplace_back();
+    p.ifiltered = m_params.size() - 1;
+    p.allocMask |= PropMask::Filtered;
+  }
+
+  if (ACTS_CHECK_BIT(mask, PropMask::Smoothed) && p.ismoothed == kInvalid) {
+    m_params.emplace_back();
+    m_cov.emplace_back();
+    p.ismoothed = m_params.size() - 1;
+    p.allocMask |= PropMask::Smoothed;
+  }
+
+  assert(m_params.size() == m_cov.size());
+
+  if (ACTS_CHECK_BIT(mask, PropMask::Jacobian) && p.ijacobian == kInvalid) {
+    m_jac.emplace_back();
+    p.ijacobian = m_jac.size() - 1;
+    p.allocMask |= PropMask::Jacobian;
+  }
+}
+
+void VectorMultiTrajectory::releaseUnusedComponents() {
+  using PropMask = TrackStatePropMask;
+
+  std::vector<IndexType> paramsMap(m_params.size(), kInvalid);
+  std::vector<IndexType> jacMap(m_jac.size(), kInvalid);
+
+  IndexType nParams = 0;
+  IndexType nJac = 0;
+  for (const IndexData& p : m_index) {
+    for (IndexType i : {p.ipredicted, p.ifiltered, p.ismoothed}) {
+      if (i != kInvalid && paramsMap[i] == kInvalid) {
+        paramsMap[i] = nParams++;
+      }
+    }
+    if (p.ijacobian != kInvalid && jacMap[p.ijacobian] == kInvalid) {
+      jacMap[p.ijacobian] = nJac++;
+    }
+  }
+
+  decltype(m_params) params{memoryResource()};
+  decltype(m_cov) cov{memoryResource()};
+  decltype(m_jac) jac{memoryResource()};
+  params.resize(nParams);
+  cov.resize(nParams);
+  jac.resize(nJac);
+
+  for (IndexType i = 0; i < paramsMap.size(); ++i) {
+    if (paramsMap[i] != kInvalid) {
+      params[paramsMap[i]] = m_params[i];
+      cov[paramsMap[i]] = m_cov[i];
+    }
+  }
+  for (IndexType i = 0; i < jacMap.size(); ++i) {
+    if (jacMap[i] != kInvalid) {
+      jac[jacMap[i]] = m_jac[i];
+    }
+  }
+
+  auto remap = [](IndexType& index, const std::vector<IndexType>& map,
+                  TrackStatePropMask& allocMask, PropMask component) {
+    if (index == kInvalid) {
+      allocMask &= ~component;
+    } else {
+      index = map[index];
+    }
+  };
+
+  for (IndexData& p : m_index) {
+    remap(p.ipredicted, paramsMap, p.allocMask, PropMask::Predicted);
+    remap(p.ifiltered, paramsMap, p.allocMask, PropMask::Filtered);
+    remap(p.ismoothed, paramsMap, p.allocMask, PropMask::Smoothed);
+    remap(p.ijacobian, jacMap, p.allocMask, PropMask::Jacobian);
+  }
+
+  m_params = std::move(params);
+  m_cov = std::move(cov);
+  m_jac = std::move(jac);
+}
+
 void VectorMultiTrajectory::clear_impl() {
   m_index.clear();
   m_previous.clear();
@@ -181,11 +282,35 @@ void VectorMultiTrajectory::clear_impl() {
   m_sourceLinks.clear();
   m_projectors.clear();
   m_referenceSurfaces.clear();
+  m_referenceSurfaceOwners.clear();
+  m_ownedReferenceSurfaces.clear();
   for (auto& [key, vec] : m_dynamic) {
     vec->clear();
   }
 }
 
+void VectorMultiTrajectory::setReferenceSurface_impl(
+    IndexType istate, std::shared_ptr<const Surface> surface) {
+  m_referenceSurfaces[istate] = surface.get();
+  IndexType& owner = m_referenceSurfaceOwners[istate];
+  if (owner != kInvalid) {
+    m_ownedReferenceSurfaces[owner] = std::move(surface);
+  } else if (surface != nullptr) {
+    owner = static_cast<IndexType>(m_ownedReferenceSurfaces.size());
+    m_ownedReferenceSurfaces.push_back(std::move(surface));
+  }
+}
+
+void VectorMultiTrajectory::setReferenceSurfaceUnowned_impl(
+    IndexType istate, const Surface* surface) {
+  m_referenceSurfaces[istate] = surface;
+  IndexType owner = m_referenceSurfaceOwners[istate];
+  if (owner != kInvalid) {
+    // release a previously owned surface, the entry stays with this state
+    m_ownedReferenceSurfaces[owner].reset();
+  }
+}
+
 void detail_vmt::VectorMultiTrajectoryBase::Statistics::toStream(
     std::ostream& os, std::size_t n) {
   using namespace boost::histogram;
@@ -238,6 +363,7 @@ void VectorMultiTrajectory::reserve(std::size_t n) {
   m_sourceLinks.reserve(n);
   m_projectors.reserve(n);
   m_referenceSurfaces.reserve(n);
+  m_referenceSurfaceOwners.reserve(n);
 
   for (auto& [key, vec] : m_dynamic) {
     vec->reserve(n);
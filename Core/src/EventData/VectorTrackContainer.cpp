@@ -11,11 +11,30 @@
 #include "Acts/EventData/ParticleHypothesis.hpp"
 
 #include <iterator>
+#include <memory>
+#include <utility>
 
 namespace Acts {
 
 namespace detail_vtc {
 
+VectorTrackContainerBase::VectorTrackContainerBase(
+    std::pmr::memory_resource* resource)
+    : m_tipIndex{resource},
+      m_stemIndex{resource},
+      m_particleHypothesis{resource},
+      m_params{resource},
+      m_cov{resource},
+      m_referenceSurfaces{resource},
+      m_referenceSurfaceOwners{resource},
+      m_ownedReferenceSurfaces{resource},
+      m_nMeasurements{resource},
+      m_nHoles{resource},
+      m_chi2{resource},
+      m_ndf{resource},
+      m_nOutliers{resource},
+      m_nSharedHits{resource} {}
+
 VectorTrackContainerBase::VectorTrackContainerBase(
     const VectorTrackContainerBase& other)
     : m_tipIndex{other.m_tipIndex},
@@ -24,6 +43,8 @@ VectorTrackContainerBase::VectorTrackContainerBase(
       m_params{other.m_params},
       m_cov{other.m_cov},
       m_referenceSurfaces{other.m_referenceSurfaces},
+      m_referenceSurfaceOwners{other.m_referenceSurfaceOwners},
+      m_ownedReferenceSurfaces{other.m_ownedReferenceSurfaces},
       m_nMeasurements{other.m_nMeasurements},
       m_nHoles{other.m_nHoles},
       m_chi2{other.m_chi2},
@@ -47,6 +68,7 @@ VectorTrackContainer::IndexType VectorTrackContainer::addTrack_impl() {
   m_params.emplace_back();
   m_cov.emplace_back();
   m_referenceSurfaces.emplace_back();
+  m_referenceSurfaceOwners.emplace_back(kInvalid);
 
   m_nMeasurements.emplace_back();
   m_nHoles.emplace_back();
@@ -75,12 +97,17 @@ void VectorTrackContainer::removeTrack_impl(IndexType itrack) {
     vec.erase(it);
   };
 
+  // release an owned reference surface, the empty entry is only reclaimed
+  // on clear
+  setReferenceSurfaceUnowned_impl(itrack, nullptr);
+
   erase(m_tipIndex);
   erase(m_stemIndex);
 
   erase(m_params);
   erase(m_cov);
   erase(m_referenceSurfaces);
+  erase(m_referenceSurfaceOwners);
 
   erase(m_nMeasurements);
   erase(m_nHoles);
@@ -96,6 +123,28 @@ void VectorTrackContainer::removeTrack_impl(IndexType itrack) {
   }
 }
 
+void VectorTrackContainer::setReferenceSurface_impl(
+    IndexType itrack, std::shared_ptr<const Surface> surface) {
+  m_referenceSurfaces[itrack] = surface.get();
+  IndexType& owner = m_referenceSurfaceOwners[itrack];
+  if (owner != kInvalid) {
+    m_ownedReferenceSurfaces[owner] = std::move(surface);
+  } else if (surface != nullptr) {
+    owner = static_cast<IndexType>(m_ownedReferenceSurfaces.size());
+    m_ownedReferenceSurfaces.push_back(std::move(surface));
+  }
+}
+
+void VectorTrackContainer::setReferenceSurfaceUnowned_impl(
+    IndexType itrack, const Surface* surface) {
+  m_referenceSurfaces[itrack] = surface;
+  IndexType owner = m_referenceSurfaceOwners[itrack];
+  if (owner != kInvalid) {
+    // release a previously owned surface, the entry stays with this track
+    m_ownedReferenceSurfaces[owner].reset();
+  }
+}
+
 void VectorTrackContainer::copyDynamicFrom_impl(
     IndexType dstIdx, const VectorTrackContainerBase& src, IndexType srcIdx) {
   for (const auto& [key, value] : src.m_dynamic) {
@@ -113,7 +162,13 @@ void VectorTrackContainer::ensureDynamicColumns_impl(
     const detail_vtc::VectorTrackContainerBase& other) {
   for (auto& [key, value] : other.m_dynamic) {
     if (m_dynamic.find(key) == m_dynamic.end()) {
-      m_dynamic[key] = value->clone(true);
+      auto column = value->clone(true);
+      // the new column covers the existing tracks
+      column->reserve(m_tipIndex.size());
+      for (std::size_t i = 0; i < m_tipIndex.size(); ++i) {
+        column->add();
+      }
+      m_dynamic[key] = std::move(column);
     }
   }
 }
@@ -126,6 +181,7 @@ void VectorTrackContainer::reserve(IndexType size) {
   m_params.reserve(size);
   m_cov.reserve(size);
   m_referenceSurfaces.reserve(size);
+  m_referenceSurfaceOwners.reserve(size);
 
   m_nMeasurements.reserve(size);
   m_nHoles.reserve(size);
@@ -149,6 +205,8 @@ void VectorTrackContainer::clear() {
   m_params.clear();
   m_cov.clear();
   m_referenceSurfaces.clear();
+  m_referenceSurfaceOwners.clear();
+  m_ownedReferenceSurfaces.clear();
 
   m_nMeasurements.clear();
   m_nHoles.clear();
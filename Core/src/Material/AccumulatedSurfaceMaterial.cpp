@@ -11,6 +11,7 @@
 #include "Acts/Material/BinnedSurfaceMaterial.hpp"
 #include "Acts/Material/HomogeneousSurfaceMaterial.hpp"
 
+#include <stdexcept>
 #include <utility>
 
 // Default Constructor - for homogeneous material
@@ -129,6 +130,27 @@ void Acts::AccumulatedSurfaceMaterial::trackAverage(
   }
 }
 
+// Merge the material accumulated from other tracks
+void Acts::AccumulatedSurfaceMaterial::merge(
+    const AccumulatedSurfaceMaterial& other) {
+  const AccumulatedMatrix& otherMaterial = other.m_accumulatedMaterial;
+  bool sameBinning = otherMaterial.size() == m_accumulatedMaterial.size();
+  for (std::size_t ib1 = 0; sameBinning && ib1 < otherMaterial.size();
+       ++ib1) {
+    sameBinning =
+        otherMaterial[ib1].size() == m_accumulatedMaterial[ib1].size();
+  }
+  if (!sameBinning) {
+    throw std::invalid_argument(
+        "Accumulated surface material can only be merged with equal binning");
+  }
+  for (std::size_t ib1 = 0; ib1 < otherMaterial.size(); ++ib1) {
+    for (std::size_t ib0 = 0; ib0 < otherMaterial[ib1].size(); ++ib0) {
+      m_accumulatedMaterial[ib1][ib0].merge(otherMaterial[ib1][ib0]);
+    }
+  }
+}
+
 /// Total average creates SurfaceMaterial
 std::unique_ptr<const Acts::ISurfaceMaterial>
 Acts::AccumulatedSurfaceMaterial::totalAverage() {
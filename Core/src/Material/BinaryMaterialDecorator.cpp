@@ -0,0 +1,62 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Material/BinaryMaterialDecorator.hpp"
+
+#include "Acts/Geometry/TrackingVolume.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+
+namespace Acts {
+
+BinaryMaterialDecorator::BinaryMaterialDecorator(const std::string& fileName,
+                                                 Acts::Logging::Level level,
+                                                 bool clearSurfaceMaterial,
+                                                 bool clearVolumeMaterial)
+    : m_clearSurfaceMaterial(clearSurfaceMaterial),
+      m_clearVolumeMaterial(clearVolumeMaterial),
+      m_logger{getDefaultLogger("BinaryMaterialDecorator", level)} {
+  ACTS_VERBOSE("Mapping binary material description from: " << fileName);
+  auto maps = readBinaryMaterialMaps(fileName);
+  m_surfaceMaterialMap = std::move(maps.first);
+  m_volumeMaterialMap = std::move(maps.second);
+  ACTS_VERBOSE("Binary material description with "
+               << m_surfaceMaterialMap.size() << " surfaces and "
+               << m_volumeMaterialMap.size() << " volumes mapped");
+}
+
+void BinaryMaterialDecorator::decorate(Surface& surface) const {
+  ACTS_VERBOSE("Processing surface: " << surface.geometryId());
+  // Clear the material if registered to do so
+  if (m_clearSurfaceMaterial) {
+    ACTS_VERBOSE("-> Clearing surface material");
+    surface.assignSurfaceMaterial(nullptr);
+  }
+  // Try to find the surface in the map
+  auto sMaterial = m_surfaceMaterialMap.find(surface.geometryId());
+  if (sMaterial != m_surfaceMaterialMap.end()) {
+    ACTS_VERBOSE("-> Found material for surface, assigning");
+    surface.assignSurfaceMaterial(sMaterial->second);
+  }
+}
+
+void BinaryMaterialDecorator::decorate(TrackingVolume& volume) const {
+  ACTS_VERBOSE("Processing volume: " << volume.geometryId());
+  // Clear the material if registered to do so
+  if (m_clearVolumeMaterial) {
+    ACTS_VERBOSE("-> Clearing volume material");
+    volume.assignVolumeMaterial(nullptr);
+  }
+  // Try to find the volume in the map
+  auto vMaterial = m_volumeMaterialMap.find(volume.geometryId());
+  if (vMaterial != m_volumeMaterialMap.end()) {
+    ACTS_VERBOSE("-> Found material for volume, assigning");
+    volume.assignVolumeMaterial(vMaterial->second);
+  }
+}
+
+}  // namespace Acts
@@ -0,0 +1,468 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Material/BinaryMaterialMaps.hpp"
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Material/BinnedSurfaceMaterial.hpp"
+#include "Acts/Material/CompactSurfaceMaterial.hpp"
+#include "Acts/Material/HomogeneousSurfaceMaterial.hpp"
+#include "Acts/Material/HomogeneousVolumeMaterial.hpp"
+#include "Acts/Material/Material.hpp"
+#include "Acts/Material/MaterialSlab.hpp"
+#include "Acts/Utilities/BinUtility.hpp"
+#include "Acts/Utilities/BinningData.hpp"
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+// The slab table is used in place, so it has to match the in-memory layout
+static_assert(std::is_trivially_copyable_v<Acts::MaterialSlab>,
+              "Material slabs can not be stored in their in-memory layout");
+static_assert(sizeof(Acts::MaterialSlab) == 8 * sizeof(float),
+              "Unexpected material slab layout");
+
+constexpr std::array<char, 8> s_magic = {'A', 'C', 'T', 'S',
+                                         'M', 'A', 'T', '\0'};
+constexpr std::uint32_t s_version = 1;
+// Detects files written on a machine with a different byte order
+constexpr std::uint32_t s_byteOrder = 0x01020304;
+// All sections start at a multiple of the largest alignment
+constexpr std::size_t s_alignment = 8;
+
+struct FileHeader {
+  std::array<char, 8> magic;
+  std::uint32_t version;
+  std::uint32_t byteOrder;
+  std::uint32_t slabSize;
+  std::uint32_t indexSize;
+  std::uint64_t nSlabs;
+  std::uint64_t slabOffset;
+  std::uint64_t nSurfaces;
+  std::uint64_t surfaceOffset;
+  std::uint64_t nVolumes;
+  std::uint64_t volumeOffset;
+};
+
+struct SurfaceRecord {
+  std::uint64_t geometryId;
+  double splitFactor;
+  std::int32_t mappingType;
+  // No binning for homogeneous material, which has a single index
+  std::uint32_t nBinning;
+  std::uint64_t binningOffset;
+  std::uint64_t indexOffset;
+  // Upper three rows of the affine transform, column-major
+  std::array<double, 12> transform;
+};
+
+struct BinningRecord {
+  std::uint32_t type;
+  std::uint32_t option;
+  std::uint32_t binValue;
+  std::uint32_t nBins;
+  float min;
+  float max;
+  // Offset of the nBins + 1 boundaries for arbitrary binning
+  std::uint64_t boundaryOffset;
+};
+
+struct VolumeRecord {
+  std::uint64_t geometryId;
+  std::array<float, 5> parameters;
+  std::uint32_t padding;
+};
+
+/// Binary output buffer
+class Buffer {
+ public:
+  /// Append raw data at the next aligned position
+  ///
+  /// @return the offset of the data
+  std::uint64_t append(const void* data, std::size_t size) {
+    m_data.resize((m_data.size() + s_alignment - 1) / s_alignment *
+                  s_alignment);
+    std::uint64_t offset = m_data.size();
+    m_data.resize(offset + size);
+    if (size > 0) {
+      std::memcpy(m_data.data() + offset, data, size);
+    }
+    return offset;
+  }
+
+  template <typename T>
+  std::uint64_t append(const std::vector<T>& values) {
+    return append(values.data(), values.size() * sizeof(T));
+  }
+
+  void overwrite(std::uint64_t offset, const void* data, std::size_t size) {
+    std::memcpy(m_data.data() + offset, data, size);
+  }
+
+  const std::vector<char>& data() const { return m_data; }
+
+ private:
+  std::vector<char> m_data;
+};
+
+/// Table of the distinct material slabs
+class SlabTable {
+ public:
+  std::uint32_t index(const Acts::MaterialSlab& slab) {
+    // Compare the stored bit pattern, which is what ends up in the file
+    std::array<std::uint32_t, 8> key{};
+    std::memcpy(key.data(), &slab, sizeof(slab));
+    auto [it, inserted] =
+        m_indices.try_emplace(key, static_cast<std::uint32_t>(m_slabs.size()));
+    if (inserted) {
+      m_slabs.push_back(slab);
+    }
+    return it->second;
+  }
+
+  const std::vector<Acts::MaterialSlab>& slabs() const { return m_slabs; }
+
+ private:
+  std::map<std::array<std::uint32_t, 8>, std::uint32_t> m_indices;
+  std::vector<Acts::MaterialSlab> m_slabs;
+};
+
+/// Read-only mapping of a whole file
+class MappedFile {
+ public:
+  explicit MappedFile(const std::string& fileName) {
+    int fd = ::open(fileName.c_str(), O_RDONLY);
+    if (fd < 0) {
+      throw std::runtime_error("Unable to open binary material file: " +
+                               fileName);
+    }
+    struct stat fileStat {};
+    if (::fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0) {
+      ::close(fd);
+      throw std::runtime_error("Empty binary material file: " + fileName);
+    }
+    m_size = static_cast<std::size_t>(fileStat.st_size);
+    m_data = ::mmap(nullptr, m_size, PROT_READ, MAP_SHARED, fd, 0);
+    // The mapping stays valid after closing the descriptor
+    ::close(fd);
+    if (m_data == MAP_FAILED) {
+      throw std::runtime_error("Unable to map binary material file: " +
+                               fileName);
+    }
+  }
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  ~MappedFile() { ::munmap(m_data, m_size); }
+
+  /// Access an array in the file with bounds and alignment checks
+  template <typename T>
+  const T* array(std::uint64_t offset, std::uint64_t count) const {
+    if (offset % alignof(T) != 0 || offset > m_size ||
+        count > (m_size - offset) / sizeof(T)) {
+      throw std::runtime_error("Malformed binary material file");
+    }
+    return reinterpret_cast<const T*>(static_cast<const char*>(m_data) +
+                                      offset);
+  }
+
+ private:
+  void* m_data = nullptr;
+  std::size_t m_size = 0;
+};
+
+template <typename index_t>
+void checkIndices(const index_t* indices, std::size_t count,
+                  std::uint64_t nSlabs) {
+  for (const index_t* index = indices; index != indices + count; ++index) {
+    if (*index >= nSlabs) {
+      throw std::runtime_error("Malformed binary material file");
+    }
+  }
+}
+
+}  // namespace
+
+void Acts::writeBinaryMaterialMaps(const std::string& fileName,
+                                   const DetectorMaterialMaps& maps) {
+  SlabTable slabTable;
+  std::vector<SurfaceRecord> surfaces;
+  std::vector<BinningRecord> binnings;
+  // The slab indices of all surfaces, the ones of surface i start at
+  // indexStarts[i]
+  std::vector<std::uint32_t> indices;
+  std::vector<std::pair<std::size_t, std::size_t>> binningRanges;
+  std::vector<std::size_t> indexStarts;
+  std::vector<std::vector<float>> boundaries;
+
+  for (const auto& [geoId, material] : maps.first) {
+    SurfaceRecord record{};
+    record.geometryId = geoId.value();
+    // The split factor is only exposed through the update factor
+    record.splitFactor =
+        material->factor(Direction::Negative, MaterialUpdateStage::PreUpdate);
+    record.mappingType = static_cast<std::int32_t>(material->mappingType());
+    Transform3 transform = Transform3::Identity();
+    indexStarts.push_back(indices.size());
+    binningRanges.emplace_back(binnings.size(), binnings.size());
+
+    if (const auto* binned =
+            dynamic_cast<const BinnedSurfaceMaterial*>(material.get())) {
+      const BinUtility& binUtility = binned->binUtility();
+      transform = binUtility.transform();
+      for (const auto& data : binUtility.binningData()) {
+        if (data.subBinningData) {
+          throw std::invalid_argument(
+              "Sub-binning can not be stored for surface " +
+              std::to_string(geoId.value()));
+        }
+        BinningRecord binning{};
+        binning.type = static_cast<std::uint32_t>(data.type);
+        binning.option = static_cast<std::uint32_t>(data.option);
+        binning.binValue = static_cast<std::uint32_t>(data.binvalue);
+        binning.nBins = static_cast<std::uint32_t>(data.bins());
+        binning.min = data.min;
+        binning.max = data.max;
+        binnings.push_back(binning);
+        boundaries.push_back(data.type == arbitrary ? data.boundaries()
+                                                    : std::vector<float>());
+      }
+      binningRanges.back().second = binnings.size();
+      record.nBinning =
+          static_cast<std::uint32_t>(binUtility.binningData().size());
+
+      std::size_t nBins0 = binUtility.max(0) + 1;
+      std::size_t nBins1 = binUtility.max(1) + 1;
+      const MaterialSlabMatrix& slabs = binned->fullMaterial();
+      if (slabs.size() != nBins1) {
+        throw std::invalid_argument("Inconsistent binning for surface " +
+                                    std::to_string(geoId.value()));
+      }
+      for (std::size_t bin1 = 0; bin1 < nBins1; ++bin1) {
+        if (slabs[bin1].size() != nBins0) {
+          throw std::invalid_argument("Inconsistent binning for surface " +
+                                      std::to_string(geoId.value()));
+        }
+        for (std::size_t bin0 = 0; bin0 < nBins0; ++bin0) {
+          indices.push_back(slabTable.index(slabs[bin1][bin0]));
+        }
+      }
+    } else if (const auto* homogeneous =
+                   dynamic_cast<const HomogeneousSurfaceMaterial*>(
+                       material.get())) {
+      record.nBinning = 0;
+      indices.push_back(slabTable.index(homogeneous->materialSlab(0, 0)));
+    } else {
+      throw std::invalid_argument(
+          "Unsupported surface material type for surface " +
+          std::to_string(geoId.value()));
+    }
+
+    Eigen::Map<Eigen::Matrix<double, 3, 4>>(record.transform.data()) =
+        transform.matrix().topRows<3>();
+    surfaces.push_back(record);
+  }
+  indexStarts.push_back(indices.size());
+
+  std::vector<VolumeRecord> volumes;
+  for (const auto& [geoId, material] : maps.second) {
+    const auto* homogeneous =
+        dynamic_cast<const HomogeneousVolumeMaterial*>(material.get());
+    if (homogeneous == nullptr) {
+      throw std::invalid_argument(
+          "Unsupported volume material type for volume " +
+          std::to_string(geoId.value()));
+    }
+    VolumeRecord record{};
+    record.geometryId = geoId.value();
+    Material::ParametersVector parameters =
+        homogeneous->material(Vector3::Zero()).parameters();
+    for (std::size_t i = 0; i < record.parameters.size(); ++i) {
+      record.parameters[i] = parameters[i];
+    }
+    volumes.push_back(record);
+  }
+
+  const std::vector<MaterialSlab>& slabs = slabTable.slabs();
+  bool shortIndices = slabs.size() <= std::numeric_limits<std::uint16_t>::max();
+
+  FileHeader header{};
+  header.magic = s_magic;
+  header.version = s_version;
+  header.byteOrder = s_byteOrder;
+  header.slabSize = sizeof(MaterialSlab);
+  header.indexSize = static_cast<std::uint32_t>(
+      shortIndices ? sizeof(std::uint16_t) : sizeof(std::uint32_t));
+  header.nSlabs = slabs.size();
+  header.nSurfaces = surfaces.size();
+  header.nVolumes = volumes.size();
+
+  Buffer buffer;
+  buffer.append(&header, sizeof(header));
+  header.slabOffset = buffer.append(slabs);
+
+  for (std::size_t i = 0; i < surfaces.size(); ++i) {
+    auto [binningBegin, binningEnd] = binningRanges[i];
+    for (std::size_t j = binningBegin; j < binningEnd; ++j) {
+      if (!boundaries[j].empty()) {
+        binnings[j].boundaryOffset = buffer.append(boundaries[j]);
+      }
+    }
+    surfaces[i].binningOffset =
+        buffer.append(binnings.data() + binningBegin,
+                      (binningEnd - binningBegin) * sizeof(BinningRecord));
+
+    std::vector<std::uint32_t> surfaceIndices(
+        indices.begin() + indexStarts[i], indices.begin() + indexStarts[i + 1]);
+    if (shortIndices) {
+      std::vector<std::uint16_t> shortSurfaceIndices(surfaceIndices.begin(),
+                                                     surfaceIndices.end());
+      surfaces[i].indexOffset = buffer.append(shortSurfaceIndices);
+    } else {
+      surfaces[i].indexOffset = buffer.append(surfaceIndices);
+    }
+  }
+  header.surfaceOffset = buffer.append(surfaces);
+  header.volumeOffset = buffer.append(volumes);
+  buffer.overwrite(0, &header, sizeof(header));
+
+  std::ofstream out(fileName, std::ios::binary | std::ios::trunc);
+  out.write(buffer.data().data(),
+            static_cast<std::streamsize>(buffer.data().size()));
+  if (!out.good()) {
+    throw std::runtime_error("Unable to write binary material file: " +
+                             fileName);
+  }
+}
+
+Acts::DetectorMaterialMaps Acts::readBinaryMaterialMaps(
+    const std::string& fileName) {
+  auto file = std::make_shared<const MappedFile>(fileName);
+
+  const FileHeader& header = *file->array<FileHeader>(0, 1);
+  if (header.magic != s_magic || header.version != s_version) {
+    throw std::runtime_error("Not a binary material file: " + fileName);
+  }
+  if (header.byteOrder != s_byteOrder ||
+      header.slabSize != sizeof(MaterialSlab)) {
+    throw std::runtime_error(
+        "Binary material file written on an incompatible platform: " +
+        fileName);
+  }
+  if (header.indexSize != sizeof(std::uint16_t) &&
+      header.indexSize != sizeof(std::uint32_t)) {
+    throw std::runtime_error("Malformed binary material file: " + fileName);
+  }
+
+  const MaterialSlab* slabs =
+      file->array<MaterialSlab>(header.slabOffset, header.nSlabs);
+  const SurfaceRecord* surfaces =
+      file->array<SurfaceRecord>(header.surfaceOffset, header.nSurfaces);
+  const VolumeRecord* volumes =
+      file->array<VolumeRecord>(header.volumeOffset, header.nVolumes);
+
+  // Slab indices of a surface, checked to be within the slab table
+  auto indexArray = [&](std::uint64_t offset,
+                        std::size_t count) -> const void* {
+    if (header.indexSize == sizeof(std::uint16_t)) {
+      const auto* indices = file->array<std::uint16_t>(offset, count);
+      checkIndices(indices, count, header.nSlabs);
+      return indices;
+    }
+    const auto* indices = file->array<std::uint32_t>(offset, count);
+    checkIndices(indices, count, header.nSlabs);
+    return indices;
+  };
+
+  DetectorMaterialMaps maps;
+  for (const SurfaceRecord* record = surfaces;
+       record != surfaces + header.nSurfaces; ++record) {
+    GeometryIdentifier geoId(record->geometryId);
+    if (record->mappingType < MappingType::PreMapping ||
+        record->mappingType > MappingType::Sensor) {
+      throw std::runtime_error("Malformed binary material file: " + fileName);
+    }
+    auto mappingType = static_cast<MappingType>(record->mappingType);
+
+    if (record->nBinning == 0) {
+      const void* index = indexArray(record->indexOffset, 1);
+      std::uint32_t slabIndex =
+          header.indexSize == sizeof(std::uint16_t)
+              ? *static_cast<const std::uint16_t*>(index)
+              : *static_cast<const std::uint32_t*>(index);
+      maps.first.emplace(geoId,
+                         std::make_shared<HomogeneousSurfaceMaterial>(
+                             slabs[slabIndex], record->splitFactor,
+                             mappingType));
+      continue;
+    }
+
+    Transform3 transform = Transform3::Identity();
+    transform.matrix().topRows<3>() =
+        Eigen::Map<const Eigen::Matrix<double, 3, 4>>(
+            record->transform.data());
+    BinUtility binUtility(transform);
+    const BinningRecord* binnings =
+        file->array<BinningRecord>(record->binningOffset, record->nBinning);
+    for (const BinningRecord* binning = binnings;
+         binning != binnings + record->nBinning; ++binning) {
+      if (binning->nBins == 0 || binning->binValue >= binValues ||
+          binning->type > arbitrary || binning->option > closed) {
+        throw std::runtime_error("Malformed binary material file: " +
+                                 fileName);
+      }
+      auto option = static_cast<BinningOption>(binning->option);
+      auto binValue = static_cast<BinningValue>(binning->binValue);
+      if (binning->type == arbitrary) {
+        const float* boundaries = file->array<float>(binning->boundaryOffset,
+                                                     binning->nBins + 1ull);
+        binUtility += BinUtility(BinningData(
+            option, binValue,
+            std::vector<float>(boundaries, boundaries + binning->nBins + 1)));
+      } else {
+        binUtility += BinUtility(BinningData(
+            option, binValue, binning->nBins, binning->min, binning->max));
+      }
+    }
+
+    std::size_t nBins = (binUtility.max(0) + 1) * (binUtility.max(1) + 1);
+    const void* indices = indexArray(record->indexOffset, nBins);
+    maps.first.emplace(geoId, std::make_shared<CompactSurfaceMaterial>(
+                                  binUtility, slabs, indices,
+                                  header.indexSize, file, record->splitFactor,
+                                  mappingType));
+  }
+
+  for (const VolumeRecord* record = volumes;
+       record != volumes + header.nVolumes; ++record) {
+    Material::ParametersVector parameters;
+    for (std::size_t i = 0; i < record->parameters.size(); ++i) {
+      parameters[i] = record->parameters[i];
+    }
+    maps.second.emplace(
+        GeometryIdentifier(record->geometryId),
+        std::make_shared<HomogeneousVolumeMaterial>(Material(parameters)));
+  }
+  return maps;
+}
@@ -0,0 +1,72 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Material/CompactSurfaceMaterial.hpp"
+
+#include <ostream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+Acts::CompactSurfaceMaterial::CompactSurfaceMaterial(
+    const BinUtility& binUtility, const MaterialSlab* slabs,
+    const void* indices, std::size_t indexSize,
+    std::shared_ptr<const void> storage, double splitFactor,
+    Acts::MappingType mappingType)
+    : ISurfaceMaterial(splitFactor, mappingType),
+      m_binUtility(binUtility),
+      m_nBins0(binUtility.max(0) + 1),
+      m_slabs(slabs),
+      m_indices(indices),
+      m_indexSize(indexSize),
+      m_storage(std::move(storage)) {
+  if (m_indexSize != sizeof(std::uint16_t) &&
+      m_indexSize != sizeof(std::uint32_t)) {
+    throw std::invalid_argument("Slab indices must have 2 or 4 bytes");
+  }
+}
+
+Acts::CompactSurfaceMaterial& Acts::CompactSurfaceMaterial::operator*=(
+    double scale) {
+  std::size_t nBins1 = m_binUtility.max(1) + 1;
+  auto scaled = std::make_shared<std::vector<MaterialSlab>>();
+  scaled->reserve(m_nBins0 * nBins1);
+  for (std::size_t bin1 = 0; bin1 < nBins1; ++bin1) {
+    for (std::size_t bin0 = 0; bin0 < m_nBins0; ++bin0) {
+      scaled->push_back(materialSlab(bin0, bin1));
+      scaled->back().scaleThickness(scale);
+    }
+  }
+  m_slabs = scaled->data();
+  m_indices = nullptr;
+  m_storage = std::move(scaled);
+  return (*this);
+}
+
+const Acts::MaterialSlab& Acts::CompactSurfaceMaterial::materialSlab(
+    const Vector2& lp) const {
+  std::size_t ibin0 = m_binUtility.bin(lp, 0);
+  std::size_t ibin1 = m_binUtility.max(1) != 0u ? m_binUtility.bin(lp, 1) : 0;
+  return materialSlab(ibin0, ibin1);
+}
+
+const Acts::MaterialSlab& Acts::CompactSurfaceMaterial::materialSlab(
+    const Vector3& gp) const {
+  std::size_t ibin0 = m_binUtility.bin(gp, 0);
+  std::size_t ibin1 = m_binUtility.max(1) != 0u ? m_binUtility.bin(gp, 1) : 0;
+  return materialSlab(ibin0, ibin1);
+}
+
+std::ostream& Acts::CompactSurfaceMaterial::toStream(std::ostream& sl) const {
+  sl << "Acts::CompactSurfaceMaterial : " << std::endl;
+  sl << "   - Number of Material bins [0,1] : " << m_binUtility.max(0) + 1
+     << " / " << m_binUtility.max(1) + 1 << std::endl;
+  sl << "   - Slab index size               : " << m_indexSize << std::endl;
+  sl << "  - BinUtility: " << m_binUtility << std::endl;
+  return sl;
+}
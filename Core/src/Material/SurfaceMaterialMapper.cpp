@@ -202,6 +202,18 @@ void Acts::SurfaceMaterialMapper::finalizeMaps(State& mState) const {
   }
 }
 
+void Acts::SurfaceMaterialMapper::mergeState(State& mState,
+                                             const State& other) const {
+  for (const auto& [geoId, accMaterial] : other.accumulatedMaterial) {
+    auto it = mState.accumulatedMaterial.find(geoId);
+    if (it == mState.accumulatedMaterial.end()) {
+      mState.accumulatedMaterial.emplace(geoId, accMaterial);
+    } else {
+      it->second.merge(accMaterial);
+    }
+  }
+}
+
 void Acts::SurfaceMaterialMapper::mapMaterialTrack(
     State& mState, RecordedMaterialTrack& mTrack) const {
   // Retrieve the recorded material from the recorded material track
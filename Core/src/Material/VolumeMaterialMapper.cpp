@@ -361,6 +361,33 @@ void Acts::VolumeMaterialMapper::finalizeMaps(State& mState) const {
   }
 }
 
+void Acts::VolumeMaterialMapper::mergeState(State& mState,
+                                            const State& other) const {
+  for (const auto& [geoId, accMaterial] : other.homogeneousGrid) {
+    mState.homogeneousGrid[geoId].merge(accMaterial);
+  }
+  // Grids with the same identifier are created with the same binning
+  auto mergeGrids = [](auto& grids, const auto& otherGrids) {
+    for (const auto& [geoId, otherGrid] : otherGrids) {
+      auto it = grids.find(geoId);
+      if (it == grids.end()) {
+        grids.emplace(geoId, otherGrid);
+        continue;
+      }
+      auto& grid = it->second;
+      if (grid.size() != otherGrid.size()) {
+        throw std::invalid_argument(
+            "Material grids can only be merged with equal binning");
+      }
+      for (std::size_t bin = 0; bin < grid.size(); ++bin) {
+        grid.at(bin).merge(otherGrid.at(bin));
+      }
+    }
+  };
+  mergeGrids(mState.grid2D, other.grid2D);
+  mergeGrids(mState.grid3D, other.grid3D);
+}
+
 void Acts::VolumeMaterialMapper::mapMaterialTrack(
     State& mState, RecordedMaterialTrack& mTrack) const {
   using VectorHelpers::makeVector4;
@@ -0,0 +1,201 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Propagator/detail/HelixTransport.hpp"
+
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/detail/TransformationBoundToFree.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/NullBField.hpp"
+#include "Acts/Propagator/PropagatorError.hpp"
+#include "Acts/Propagator/detail/CovarianceEngine.hpp"
+#include "Acts/Surfaces/BoundaryCheck.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+
+#include <cmath>
+#include <tuple>
+
+namespace Acts::detail {
+
+namespace {
+
+/// Coefficients of the helix after a path length s with curvature k.
+///
+/// With the start direction T0 decomposed into the components parallel to
+/// the field direction h, perpendicular to it and T0 x h, the helix reads
+///
+///   T(s) = (T0.h) h + cos(ks) T0perp + sin(ks) T0 x h
+///   r(s) = r0 + (T0.h) h s + a T0perp + b T0 x h
+///
+/// with a = sin(ks) / k and b = (1 - cos(ks)) / k. The derivatives of a and b
+/// w.r.t. the curvature are needed for the transport Jacobian. Series
+/// expansions are used for small bending angles to avoid cancellations.
+struct HelixCoefficients {
+  double cosX = 1.;
+  double sinX = 0.;
+  double a = 0.;
+  double b = 0.;
+  double dadk = 0.;
+  double dbdk = 0.;
+
+  HelixCoefficients(double k, double s) {
+    const double x = k * s;
+    const double x2 = x * x;
+    cosX = std::cos(x);
+    sinX = std::sin(x);
+    if (std::abs(x) < 1e-2) {
+      a = s * (1. - x2 / 6. * (1. - x2 / 20.));
+      b = s * x * (0.5 - x2 / 24. * (1. - x2 / 30.));
+      dadk = s * s * x * (-1. / 3. + x2 / 30. - x2 * x2 / 840.);
+      dbdk = s * s * (0.5 - x2 / 8. + x2 * x2 / 144.);
+    } else {
+      const double sinHalfX = std::sin(0.5 * x);
+      a = sinX / k;
+      b = 2. * sinHalfX * sinHalfX / k;
+      dadk = s * s * (x * cosX - sinX) / x2;
+      dbdk = s * s * (x * sinX - 2. * sinHalfX * sinHalfX) / x2;
+    }
+  }
+};
+
+}  // namespace
+
+Result<BoundTrackParameters> transportAlongHelix(
+    const GeometryContext& gctx, const BoundTrackParameters& params,
+    const Surface& surface, const Vector3& bField, double tolerance,
+    unsigned int maxIterations) {
+  const FreeVector start = transformBoundToFreeParameters(
+      params.referenceSurface(), gctx, params.parameters());
+  const Vector3 startPos = start.segment<3>(eFreePos0);
+  const Vector3 startDir = start.segment<3>(eFreeDir0);
+  const double qop = start[eFreeQOverP];
+
+  // curvature of the helix, consistent with the equation of motion
+  // dT/ds = qop * T x B used by the steppers
+  const double bNorm = bField.norm();
+  const Vector3 h = bNorm > 0. ? Vector3(bField / bNorm) : Vector3::UnitZ();
+  const double k = qop * bNorm;
+
+  const double dirPar = startDir.dot(h);
+  const Vector3 dirPerp = startDir - dirPar * h;
+  const Vector3 dirCross = startDir.cross(h);
+
+  double s = 0.;
+  Vector3 pos = startPos;
+  Vector3 dir = startDir;
+  bool converged = false;
+  for (unsigned int i = 0; i < maxIterations; ++i) {
+    auto intersection =
+        surface.intersect(gctx, pos, dir, BoundaryCheck(false)).closest();
+    if (!intersection) {
+      return PropagatorError::Failure;
+    }
+    const double ds = intersection.pathLength();
+    s += ds;
+
+    HelixCoefficients c(k, s);
+    pos = startPos + (s * dirPar) * h + c.a * dirPerp + c.b * dirCross;
+    dir = dirPar * h + c.cosX * dirPerp + c.sinX * dirCross;
+
+    if (std::abs(ds) < tolerance) {
+      converged = true;
+      break;
+    }
+  }
+  if (!converged) {
+    return PropagatorError::StepCountLimitReached;
+  }
+
+  const double mass = params.particleHypothesis().mass();
+  const double absQ = params.particleHypothesis().absoluteCharge();
+  const double p = params.particleHypothesis().extractMomentum(qop);
+  const double dtds = std::hypot(1., mass / p);
+
+  FreeVector end = start;
+  end.segment<3>(eFreePos0) = pos;
+  end[eFreeTime] += s * dtds;
+  end.segment<3>(eFreeDir0) = dir;
+
+  // Derivatives of the end parameters w.r.t. the path length
+  FreeVector derivatives = FreeVector::Zero();
+  derivatives.segment<3>(eFreePos0) = dir;
+  derivatives[eFreeTime] = dtds;
+  derivatives.segment<3>(eFreeDir0) = qop * dir.cross(bField);
+
+  // Transport Jacobian at fixed path length, the projection onto the surface
+  // is handled by the covariance engine using the derivatives above
+  FreeMatrix transportJacobian = FreeMatrix::Identity();
+  {
+    HelixCoefficients c(k, s);
+    const SquareMatrix3 parallel = h * h.transpose();
+    const SquareMatrix3 perp = SquareMatrix3::Identity() - parallel;
+    // cross product with the field direction: crossH * v = v x h
+    SquareMatrix3 crossH;
+    crossH << 0., h.z(), -h.y(), -h.z(), 0., h.x(), h.y(), -h.x(), 0.;
+
+    transportJacobian.block<3, 3>(eFreePos0, eFreeDir0) =
+        s * parallel + c.a * perp + c.b * crossH;
+    transportJacobian.block<3, 3>(eFreeDir0, eFreeDir0) =
+        parallel + c.cosX * perp + c.sinX * crossH;
+    transportJacobian.block<3, 1>(eFreePos0, eFreeQOverP) =
+        bNorm * (c.dadk * dirPerp + c.dbdk * dirCross);
+    transportJacobian.block<3, 1>(eFreeDir0, eFreeQOverP) =
+        (bNorm * s) * (c.cosX * dirCross - c.sinX * dirPerp);
+    // neutral particles carry q/p = 1/p
+    const double q = absQ > 0. ? absQ : 1.;
+    transportJacobian(eFreeTime, eFreeQOverP) =
+        s * mass * mass * qop / (q * q * dtds);
+  }
+
+  const bool covTransport = params.covariance().has_value();
+  BoundSquareMatrix cov =
+      params.covariance().value_or(BoundSquareMatrix::Zero());
+  BoundMatrix jacobian = BoundMatrix::Identity();
+  BoundToFreeMatrix jacToGlobal =
+      params.referenceSurface().boundToFreeJacobian(gctx, params.parameters());
+
+  auto state = boundState(gctx, cov, jacobian, transportJacobian, derivatives,
+                          jacToGlobal, end, params.particleHypothesis(),
+                          covTransport, s, surface);
+  if (!state.ok()) {
+    return state.error();
+  }
+  return std::get<BoundTrackParameters>(std::move(*state));
+}
+
+std::optional<BoundTrackParameters> tryTransportAlongHelix(
+    const GeometryContext& gctx, const BoundTrackParameters& params,
+    const Surface& surface, const MagneticFieldProvider& field,
+    MagneticFieldProvider::Cache& fieldCache, double fieldTolerance,
+    double tolerance) {
+  auto startField = field.getField(params.position(gctx), fieldCache);
+  if (!startField.ok()) {
+    return std::nullopt;
+  }
+
+  auto result =
+      transportAlongHelix(gctx, params, surface, *startField, tolerance);
+  if (!result.ok()) {
+    return std::nullopt;
+  }
+
+  const bool isHomogeneous =
+      dynamic_cast<const ConstantBField*>(&field) != nullptr ||
+      dynamic_cast<const NullBField*>(&field) != nullptr;
+  if (!isHomogeneous) {
+    auto endField = field.getField(result->position(gctx), fieldCache);
+    if (!endField.ok() || (*endField - *startField).norm() >
+                              fieldTolerance * startField->norm()) {
+      return std::nullopt;
+    }
+  }
+
+  return std::move(*result);
+}
+
+}  // namespace Acts::detail
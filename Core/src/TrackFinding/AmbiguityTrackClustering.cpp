@@ -8,10 +8,18 @@
 
 #include "Acts/TrackFinding/detail/AmbiguityTrackClustering.hpp"
 
+#include <atomic>
+#include <cstdint>
 #include <iterator>
 
-std::unordered_map<int, std::vector<int>> Acts::detail::clusterDuplicateTracks(
-    const std::multimap<int, std::pair<int, std::vector<int>>>& trackMap) {
+namespace {
+
+using TrackEntry = std::pair<int, std::vector<int>>;
+using TrackMap = std::multimap<int, TrackEntry>;
+
+/// Clusterise the tracks in the order they are given
+std::unordered_map<int, std::vector<int>> clusterTracks(
+    const std::vector<const TrackEntry*>& tracks) {
   // Unordered map associating a vector with all the track ID of a cluster to
   // the ID of the first track of the cluster
   std::unordered_map<int, std::vector<int>> cluster;
@@ -20,8 +28,8 @@ std::unordered_map<int, std::vector<int>> Acts::detail::clusterDuplicateTracks(
   std::unordered_map<int, int> hitToTrack;
 
   // Loop over all the tracks
-  for (auto track = trackMap.rbegin(); track != trackMap.rend(); ++track) {
-    std::vector<int> hits = track->second.second;
+  for (const TrackEntry* track : tracks) {
+    const std::vector<int>& hits = track->second;
     auto matchedTrack = hitToTrack.end();
     // Loop over all the hits in the track
     for (auto hit = hits.begin(); hit != hits.end(); hit++) {
@@ -29,19 +37,220 @@ std::unordered_map<int, std::vector<int>> Acts::detail::clusterDuplicateTracks(
       matchedTrack = hitToTrack.find(*hit);
       if (matchedTrack != hitToTrack.end()) {
         // Add the track to the cluster associated to the matched track
-        cluster.at(matchedTrack->second).push_back(track->second.first);
+        cluster.at(matchedTrack->second).push_back(track->first);
         break;
       }
     }
     // None of the hits have been matched to a track create a new cluster
     if (matchedTrack == hitToTrack.end()) {
-      cluster.emplace(track->second.first,
-                      std::vector<int>(1, track->second.first));
+      cluster.emplace(track->first, std::vector<int>(1, track->first));
       for (const auto& hit : hits) {
         // Add the hits of the new cluster to the hitToTrack
-        hitToTrack.emplace(hit, track->second.first);
+        hitToTrack.emplace(hit, track->first);
       }
     }
   }
   return cluster;
 }
+
+/// Tracks in the order they are clusterised, i.e. by decreasing key
+std::vector<const TrackEntry*> orderedTracks(const TrackMap& trackMap) {
+  std::vector<const TrackEntry*> tracks;
+  tracks.reserve(trackMap.size());
+  for (auto track = trackMap.rbegin(); track != trackMap.rend(); ++track) {
+    tracks.push_back(&track->second);
+  }
+  return tracks;
+}
+
+/// Union-find over the track indices which can be modified concurrently.
+///
+/// Roots are always linked below roots with a smaller index, so the root of
+/// each set is its smallest element independent of the order of the unions.
+class ConcurrentUnionFind {
+ public:
+  explicit ConcurrentUnionFind(std::size_t size) : m_parent(size) {
+    for (std::size_t i = 0; i < size; ++i) {
+      m_parent[i].store(static_cast<std::uint32_t>(i),
+                        std::memory_order_relaxed);
+    }
+  }
+
+  std::uint32_t find(std::uint32_t i) {
+    while (true) {
+      std::uint32_t parent = m_parent[i].load();
+      if (parent == i) {
+        return i;
+      }
+      std::uint32_t grandParent = m_parent[parent].load();
+      // Path halving, it does not matter if another thread was faster
+      if (parent != grandParent) {
+        m_parent[i].compare_exchange_weak(parent, grandParent);
+      }
+      i = grandParent;
+    }
+  }
+
+  void unite(std::uint32_t a, std::uint32_t b) {
+    while (true) {
+      a = find(a);
+      b = find(b);
+      if (a == b) {
+        return;
+      }
+      if (a < b) {
+        std::swap(a, b);
+      }
+      // Fails if another thread has linked the root in the meantime
+      std::uint32_t expected = a;
+      if (m_parent[a].compare_exchange_strong(expected, b)) {
+        return;
+      }
+    }
+  }
+
+ private:
+  std::vector<std::atomic<std::uint32_t>> m_parent;
+};
+
+/// Lock-free open addressing hash table storing the first track which
+/// registered a hit. Hit and track index are packed into a single word, so
+/// an entry is published atomically.
+class ConcurrentHitTable {
+ public:
+  explicit ConcurrentHitTable(std::size_t nHits) {
+    // Keep the load factor below 0.5
+    std::size_t capacity = 2;
+    m_shift = 63;
+    while (capacity < 2 * nHits) {
+      capacity *= 2;
+      --m_shift;
+    }
+    m_mask = capacity - 1;
+    m_slots = std::vector<std::atomic<std::uint64_t>>(capacity);
+    for (auto& slot : m_slots) {
+      slot.store(s_empty, std::memory_order_relaxed);
+    }
+  }
+
+  /// Register a hit for a track
+  ///
+  /// @return the first track which registered the hit
+  std::uint32_t insert(int hit, std::uint32_t iTrack) {
+    const std::uint64_t key = static_cast<std::uint32_t>(hit);
+    const std::uint64_t entry = (key << 32) | (iTrack + 1u);
+    // Fibonacci hashing
+    std::size_t slot = (key * 0x9E3779B97F4A7C15ull) >> m_shift;
+    while (true) {
+      std::uint64_t current = m_slots[slot].load(std::memory_order_relaxed);
+      if (current == s_empty &&
+          m_slots[slot].compare_exchange_strong(current, entry,
+                                                std::memory_order_relaxed)) {
+        return iTrack;
+      }
+      // The slot is occupied, either by this hit or by another one
+      if ((current >> 32) == key) {
+        return static_cast<std::uint32_t>(current) - 1u;
+      }
+      slot = (slot + 1) & m_mask;
+    }
+  }
+
+ private:
+  // Track indices are stored shifted by one, so no entry is zero
+  static constexpr std::uint64_t s_empty = 0;
+
+  std::vector<std::atomic<std::uint64_t>> m_slots;
+  std::size_t m_mask = 0;
+  unsigned int m_shift = 0;
+};
+
+/// Split the ordered tracks into the connected components
+std::vector<std::vector<const TrackEntry*>> trackComponents(
+    const std::vector<const TrackEntry*>& tracks,
+    const Acts::ParallelForExecutor& executor) {
+  std::size_t nHits = 0;
+  for (const TrackEntry* track : tracks) {
+    nHits += track->second.size();
+  }
+
+  ConcurrentHitTable hitTable(nHits);
+  ConcurrentUnionFind unionFind(tracks.size());
+  Acts::parallelFor(executor, tracks.size(),
+                    [&](std::size_t begin, std::size_t end) {
+                      for (std::size_t i = begin; i < end; ++i) {
+                        auto iTrack = static_cast<std::uint32_t>(i);
+                        for (int hit : tracks[i]->second) {
+                          std::uint32_t jTrack = hitTable.insert(hit, iTrack);
+                          if (jTrack != iTrack) {
+                            unionFind.unite(iTrack, jTrack);
+                          }
+                        }
+                      }
+                    });
+
+  std::vector<std::uint32_t> roots(tracks.size());
+  Acts::parallelFor(executor, tracks.size(),
+                    [&](std::size_t begin, std::size_t end) {
+                      for (std::size_t i = begin; i < end; ++i) {
+                        roots[i] =
+                            unionFind.find(static_cast<std::uint32_t>(i));
+                      }
+                    });
+
+  // The root is the first track of a component, so the components are
+  // created in the order of their first track
+  std::vector<std::vector<const TrackEntry*>> components;
+  std::vector<std::size_t> componentIndex(tracks.size());
+  for (std::size_t i = 0; i < tracks.size(); ++i) {
+    if (roots[i] == i) {
+      componentIndex[i] = components.size();
+      components.emplace_back();
+    }
+    components[componentIndex[roots[i]]].push_back(tracks[i]);
+  }
+  return components;
+}
+
+}  // namespace
+
+std::unordered_map<int, std::vector<int>> Acts::detail::clusterDuplicateTracks(
+    const std::multimap<int, std::pair<int, std::vector<int>>>& trackMap) {
+  return clusterTracks(orderedTracks(trackMap));
+}
+
+std::unordered_map<int, std::vector<int>> Acts::detail::clusterDuplicateTracks(
+    const std::multimap<int, std::pair<int, std::vector<int>>>& trackMap,
+    const ParallelForExecutor& executor) {
+  auto components = trackComponents(orderedTracks(trackMap), executor);
+
+  std::vector<std::unordered_map<int, std::vector<int>>> componentClusters(
+      components.size());
+  parallelFor(executor, components.size(),
+              [&](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) {
+                  componentClusters[i] = clusterTracks(components[i]);
+                }
+              });
+
+  std::unordered_map<int, std::vector<int>> cluster;
+  for (auto& clusters : componentClusters) {
+    cluster.merge(clusters);
+  }
+  return cluster;
+}
+
+std::vector<std::vector<int>> Acts::detail::connectedTrackComponents(
+    const std::multimap<int, std::pair<int, std::vector<int>>>& trackMap,
+    const ParallelForExecutor& executor) {
+  auto components = trackComponents(orderedTracks(trackMap), executor);
+
+  std::vector<std::vector<int>> trackIds(components.size());
+  for (std::size_t i = 0; i < components.size(); ++i) {
+    trackIds[i].reserve(components[i].size());
+    for (const TrackEntry* track : components[i]) {
+      trackIds[i].push_back(track->first);
+    }
+  }
+  return trackIds;
+}
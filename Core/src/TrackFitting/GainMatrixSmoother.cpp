@@ -77,4 +77,42 @@ Result<void> GainMatrixSmoother::calculate(
 
   return Result<void>::success();
 }
+
+void GainMatrixSmoother::smoothBatch(Batch& batch, const Logger& logger) const {
+  const std::size_t n = batch.size();
+  ACTS_VERBOSE("Invoked batched GainMatrixSmoother on " << n << " states");
+
+  batch.smoothed.resize(n);
+  batch.smoothedCovariance.resize(n);
+  batch.errors.assign(n, std::error_code());
+
+  for (std::size_t i = 0; i < n; ++i) {
+    // Same expressions as the single state smoothing
+    BoundMatrix G = batch.filteredCovariance[i] *
+                    batch.nextJacobian[i].transpose() *
+                    batch.nextPredictedCovariance[i].inverse();
+
+    if (G.hasNaN()) {
+      batch.errors[i] = KalmanFitterError::SmoothFailed;
+      continue;
+    }
+
+    batch.smoothed[i] =
+        batch.filtered[i] +
+        G * (batch.nextSmoothed[i] - batch.nextPredicted[i]);
+
+    BoundSquareMatrix smoothedCov =
+        batch.filteredCovariance[i] +
+        G * (batch.nextSmoothedCovariance[i] -
+             batch.nextPredictedCovariance[i]) *
+            G.transpose();
+    if (!detail::covariance_helper<BoundSquareMatrix>::validate(smoothedCov)) {
+      ACTS_DEBUG(
+          "Smoothed covariance is not positive definite. Could result in "
+          "negative covariance!");
+    }
+    batch.smoothedCovariance[i] = smoothedCov;
+  }
+}
+
 }  // namespace Acts
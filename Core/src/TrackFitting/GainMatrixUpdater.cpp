@@ -94,4 +94,69 @@ std::tuple<double, std::error_code> GainMatrixUpdater::visitMeasurement(
   return {chi2, error};
 }
 
+template <std::size_t kMeasurementSize>
+void GainMatrixUpdater::updateBatch(Batch<kMeasurementSize>& batch,
+                                    Direction direction,
+                                    const Logger& logger) const {
+  using ParametersVector = ActsVector<kMeasurementSize>;
+  using CovarianceMatrix = ActsSquareMatrix<kMeasurementSize>;
+
+  const std::size_t n = batch.size();
+  ACTS_VERBOSE("Invoked batched GainMatrixUpdater on "
+               << n << " states with measurement dimension "
+               << kMeasurementSize);
+
+  batch.filtered.resize(n);
+  batch.filteredCovariance.resize(n);
+  batch.chi2.assign(n, 0.);
+  batch.errors.assign(n, std::error_code());
+
+  for (std::size_t i = 0; i < n; ++i) {
+    const auto& H = batch.projector[i];
+    const auto& predicted = batch.predicted[i];
+    const auto& predictedCovariance = batch.predictedCovariance[i];
+    const auto& calibrated = batch.calibrated[i];
+    const auto& calibratedCovariance = batch.calibratedCovariance[i];
+
+    // Same expressions as the single state update
+    const auto K = (predictedCovariance * H.transpose() *
+                    (H * predictedCovariance * H.transpose() +
+                     calibratedCovariance)
+                        .inverse())
+                       .eval();
+
+    if (K.hasNaN()) {
+      batch.errors[i] = (direction == Direction::Forward)
+                            ? KalmanFitterError::ForwardUpdateFailed
+                            : KalmanFitterError::BackwardUpdateFailed;
+      continue;
+    }
+
+    batch.filtered[i] = predicted + K * (calibrated - H * predicted);
+    batch.filteredCovariance[i] =
+        (BoundSquareMatrix::Identity() - K * H) * predictedCovariance;
+
+    ParametersVector residual;
+    residual = calibrated - H * batch.filtered[i];
+
+    CovarianceMatrix m =
+        ((CovarianceMatrix::Identity() - H * K) * calibratedCovariance).eval();
+
+    batch.chi2[i] = (residual.transpose() * m.inverse() * residual).value();
+  }
+}
+
+template void GainMatrixUpdater::updateBatch<1>(Batch<1>&, Direction,
+                                                const Logger&) const;
+template void GainMatrixUpdater::updateBatch<2>(Batch<2>&, Direction,
+                                                const Logger&) const;
+template void GainMatrixUpdater::updateBatch<3>(Batch<3>&, Direction,
+                                                const Logger&) const;
+template void GainMatrixUpdater::updateBatch<4>(Batch<4>&, Direction,
+                                                const Logger&) const;
+template void GainMatrixUpdater::updateBatch<5>(Batch<5>&, Direction,
+                                                const Logger&) const;
+template void GainMatrixUpdater::updateBatch<6>(Batch<6>&, Direction,
+                                                const Logger&) const;
+
 }  // namespace Acts
@@ -8,44 +8,7 @@
 
 #include "Acts/TrackFitting/GsfMixtureReduction.hpp"
 
-#include "Acts/TrackFitting/detail/SymmetricKlDistanceMatrix.hpp"
-
-template <typename proj_t, typename angle_desc_t>
-void reduceWithKLDistanceImpl(std::vector<Acts::GsfComponent> &cmpCache,
-                              std::size_t maxCmpsAfterMerge, const proj_t &proj,
-                              const angle_desc_t &desc) {
-  Acts::detail::SymmetricKLDistanceMatrix distances(cmpCache, proj);
-
-  auto remainingComponents = cmpCache.size();
-
-  while (remainingComponents > maxCmpsAfterMerge) {
-    const auto [minI, minJ] = distances.minDistancePair();
-
-    // Set one component and compute associated distances
-    cmpCache[minI] =
-        mergeComponents(cmpCache[minI], cmpCache[minJ], proj, desc);
-    distances.recomputeAssociatedDistances(minI, cmpCache, proj);
-
-    // Set weight of the other component to -1 so we can remove it later and
-    // mask its distances
-    proj(cmpCache[minJ]).weight = -1.0;
-    distances.maskAssociatedDistances(minJ);
-
-    remainingComponents--;
-  }
-
-  // Remove all components which are labeled with weight -1
-  std::sort(cmpCache.begin(), cmpCache.end(),
-            [&](const auto &a, const auto &b) {
-              return proj(a).weight < proj(b).weight;
-            });
-  cmpCache.erase(
-      std::remove_if(cmpCache.begin(), cmpCache.end(),
-                     [&](const auto &a) { return proj(a).weight == -1.0; }),
-      cmpCache.end());
-
-  assert(cmpCache.size() == maxCmpsAfterMerge && "size mismatch");
-}
+#include "Acts/TrackFitting/detail/KlMixtureReduction.hpp"
 
 namespace Acts {
 
@@ -69,12 +32,14 @@ void reduceMixtureWithKLDistance(std::vector<Acts::GsfComponent> &cmpCache,
     return;
   }
 
-  auto proj = [](auto &a) -> decltype(auto) { return a; };
+  // One reducer per thread, so that its buffers are reused across the
+  // surfaces and fits
+  thread_local detail::KLDistanceMixtureReducer reducer;
 
   // We must differ between surface types, since there can be different
   // local coordinates
   detail::angleDescriptionSwitch(surface, [&](const auto &desc) {
-    reduceWithKLDistanceImpl(cmpCache, maxCmpsAfterMerge, proj, desc);
+    reducer.reduce(cmpCache, maxCmpsAfterMerge, desc);
   });
 }
 
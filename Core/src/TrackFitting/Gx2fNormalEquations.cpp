@@ -0,0 +1,150 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/TrackFitting/detail/Gx2fNormalEquations.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+namespace Acts::detail {
+
+Gx2fNormalEquations::Gx2fNormalEquations(std::size_t nGlobal,
+                                         std::size_t bandwidth)
+    : m_bandwidth(bandwidth),
+      m_globalMatrix(ActsDynamicMatrix::Zero(nGlobal, nGlobal)),
+      m_globalVector(ActsDynamicVector::Zero(nGlobal)) {}
+
+std::size_t Gx2fNormalEquations::addBlock(std::size_t size) {
+  const std::size_t k = m_blocks.size();
+  Block& block = m_blocks.emplace_back();
+  block.coupling = ActsDynamicMatrix::Zero(size, nGlobal());
+  block.vector = ActsDynamicVector::Zero(size);
+  const std::size_t nBand = std::min(k, m_bandwidth) + 1;
+  block.band.reserve(nBand);
+  for (std::size_t d = 0; d < nBand; ++d) {
+    block.band.push_back(ActsDynamicMatrix::Zero(size, blockSize(k - d)));
+  }
+  return k;
+}
+
+double Gx2fNormalEquations::addMeasurement(
+    double residual, double variance,
+    const ActsDynamicVector& globalDerivatives, std::size_t block,
+    const ActsDynamicVector& blockDerivatives) {
+  assert(static_cast<std::size_t>(globalDerivatives.size()) == nGlobal());
+  const double invVariance = 1. / variance;
+
+  m_globalMatrix.noalias() +=
+      globalDerivatives * globalDerivatives.transpose() * invVariance;
+  m_globalVector += globalDerivatives * (residual * invVariance);
+
+  if (block != kNoBlock) {
+    Block& b = m_blocks[block];
+    assert(blockDerivatives.size() == b.vector.size());
+    b.coupling.noalias() +=
+        blockDerivatives * globalDerivatives.transpose() * invVariance;
+    b.band[0].noalias() +=
+        blockDerivatives * blockDerivatives.transpose() * invVariance;
+    b.vector += blockDerivatives * (residual * invVariance);
+  }
+
+  return residual * invVariance * residual;
+}
+
+double Gx2fNormalEquations::addPrior(std::size_t block,
+                                     const ActsDynamicVector& variances,
+                                     const ActsDynamicVector& values) {
+  Block& b = m_blocks[block];
+  assert(variances.size() == b.vector.size());
+  assert(values.size() == b.vector.size());
+
+  const ActsDynamicVector invVariances = variances.cwiseInverse();
+  b.band[0].diagonal() += invVariances;
+  // The prior pulls the parameters back to zero
+  b.vector -= values.cwiseProduct(invVariances);
+
+  return values.cwiseProduct(invVariances).dot(values);
+}
+
+bool Gx2fNormalEquations::solve() {
+  const std::size_t n = m_blocks.size();
+  const auto nG = static_cast<Eigen::Index>(nGlobal());
+
+  // Block Cholesky factorisation L = F F^T, F has the same band structure
+  for (std::size_t k = 0; k < n; ++k) {
+    Block& bk = m_blocks[k];
+    const std::size_t first = k - std::min(k, m_bandwidth);
+
+    for (std::size_t j = first; j < k; ++j) {
+      const Block& bj = m_blocks[j];
+      ActsDynamicMatrix& fkj = bk.band[k - j];
+      for (std::size_t i = first; i < j; ++i) {
+        fkj.noalias() -= bk.band[k - i] * bj.band[j - i].transpose();
+      }
+      // F_kj = M F_jj^-T
+      fkj = bj.band[0]
+                .triangularView<Eigen::Lower>()
+                .solve(fkj.transpose())
+                .transpose();
+    }
+
+    ActsDynamicMatrix diagonal = bk.band[0];
+    for (std::size_t i = first; i < k; ++i) {
+      diagonal.noalias() -= bk.band[k - i] * bk.band[k - i].transpose();
+    }
+    Eigen::LLT<ActsDynamicMatrix> llt(diagonal);
+    if (llt.info() != Eigen::Success) {
+      return false;
+    }
+    bk.band[0] = llt.matrixL();
+  }
+
+  // Forward substitution F Z = [C, b] and the Schur complement of L
+  ActsDynamicMatrix schur = m_globalMatrix;
+  ActsDynamicVector schurVector = m_globalVector;
+  for (std::size_t k = 0; k < n; ++k) {
+    Block& bk = m_blocks[k];
+    const std::size_t first = k - std::min(k, m_bandwidth);
+
+    ActsDynamicMatrix rhs(bk.vector.size(), nG + 1);
+    rhs.leftCols(nG) = bk.coupling;
+    rhs.col(nG) = bk.vector;
+    for (std::size_t i = first; i < k; ++i) {
+      rhs.noalias() -= bk.band[k - i] * m_blocks[i].forward;
+    }
+    bk.forward = bk.band[0].triangularView<Eigen::Lower>().solve(rhs);
+
+    const auto zc = bk.forward.leftCols(nG);
+    schur.noalias() -= zc.transpose() * zc;
+    schurVector.noalias() -= zc.transpose() * bk.forward.col(nG);
+  }
+
+  Eigen::LLT<ActsDynamicMatrix> llt(schur);
+  if (llt.info() != Eigen::Success) {
+    return false;
+  }
+  m_globalDelta = llt.solve(schurVector);
+  m_globalCovariance = llt.solve(ActsDynamicMatrix::Identity(nG, nG));
+
+  // Backward substitution F^T delta = Z_b - Z_c globalDelta
+  for (std::size_t k = n; k-- > 0;) {
+    Block& bk = m_blocks[k];
+    ActsDynamicVector rhs =
+        bk.forward.col(nG) - bk.forward.leftCols(nG) * m_globalDelta;
+    const std::size_t last = std::min(n - 1, k + m_bandwidth);
+    for (std::size_t m = k + 1; m <= last; ++m) {
+      rhs.noalias() -= m_blocks[m].band[m - k].transpose() * m_blocks[m].delta;
+    }
+    bk.delta =
+        bk.band[0].transpose().triangularView<Eigen::Upper>().solve(rhs);
+  }
+
+  return true;
+}
+
+}  // namespace Acts::detail
@@ -0,0 +1,57 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Utilities/AllocationCounter.hpp"
+
+#include <atomic>
+
+namespace {
+
+// Plain integers in thread-local storage do not allocate on first access,
+// which is required since they are used from within operator new.
+thread_local std::uint64_t t_allocations = 0;
+thread_local std::uint64_t t_deallocations = 0;
+thread_local std::uint64_t t_bytes = 0;
+
+std::atomic<std::uint64_t> s_allocations{0};
+std::atomic<std::uint64_t> s_deallocations{0};
+std::atomic<std::uint64_t> s_bytes{0};
+
+}  // namespace
+
+void Acts::detail::countAllocation(std::size_t size) noexcept {
+  ++t_allocations;
+  t_bytes += size;
+  s_allocations.fetch_add(1, std::memory_order_relaxed);
+  s_bytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+void Acts::detail::countDeallocation() noexcept {
+  ++t_deallocations;
+  s_deallocations.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool Acts::allocationCountingEnabled() {
+  // Any program allocates during startup, so the counters are only empty if
+  // no counting operator new is installed
+  return s_allocations.load(std::memory_order_relaxed) > 0;
+}
+
+Acts::AllocationCount Acts::threadAllocationCount() {
+  return {t_allocations, t_deallocations, t_bytes};
+}
+
+Acts::AllocationCount Acts::globalAllocationCount() {
+  return {s_allocations.load(std::memory_order_relaxed),
+          s_deallocations.load(std::memory_order_relaxed),
+          s_bytes.load(std::memory_order_relaxed)};
+}
+
+#if defined(ACTS_ENABLE_ALLOCATION_COUNTING)
+#include "Acts/Utilities/detail/CountingAllocationOperators.hpp"
+#endif
@@ -0,0 +1,266 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Vertexing/DynamicGaussianGridTrackDensity.hpp"
+
+#include "Acts/Utilities/AlgebraHelpers.hpp"
+#include "Acts/Vertexing/VertexingError.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+Acts::DynamicGaussianGridTrackDensity::DynamicGaussianGridTrackDensity(
+    const Config& cfg)
+    : m_cfg(cfg) {
+  if (m_cfg.trkGridSize % 2 == 0) {
+    throw std::invalid_argument("The track grid size has to be odd.");
+  }
+  if (m_cfg.mainGridSize <= m_cfg.trkGridSize) {
+    throw std::invalid_argument(
+        "The main grid has to be bigger than the track grid.");
+  }
+}
+
+Acts::DynamicGaussianGridTrackDensity::MainGridVector
+Acts::DynamicGaussianGridTrackDensity::emptyMainGrid() const {
+  return MainGridVector::Zero(m_cfg.mainGridSize);
+}
+
+Acts::Result<float> Acts::DynamicGaussianGridTrackDensity::getMaxZPosition(
+    MainGridVector& mainGrid) const {
+  if (mainGrid.size() != m_cfg.mainGridSize || mainGrid.isZero(0.)) {
+    return VertexingError::EmptyInput;
+  }
+
+  int zbin = -1;
+  if (!m_cfg.useHighestSumZPosition) {
+    // Get bin with maximum content
+    mainGrid.maxCoeff(&zbin);
+  } else {
+    // Get z position with highest density sum
+    // of surrounding bins
+    zbin = getHighestSumZPosition(mainGrid);
+  }
+
+  // Derive corresponding z value
+  return (zbin - m_cfg.mainGridSize / 2.0f + 0.5f) * m_cfg.binSize;
+}
+
+Acts::Result<std::pair<float, float>>
+Acts::DynamicGaussianGridTrackDensity::getMaxZPositionAndWidth(
+    MainGridVector& mainGrid) const {
+  // Get z maximum value
+  auto maxZRes = getMaxZPosition(mainGrid);
+  if (!maxZRes.ok()) {
+    return maxZRes.error();
+  }
+  float maxZ = *maxZRes;
+
+  // Get seed width estimate
+  auto widthRes = estimateSeedWidth(mainGrid, maxZ);
+  if (!widthRes.ok()) {
+    return widthRes.error();
+  }
+  float width = *widthRes;
+  std::pair<float, float> returnPair{maxZ, width};
+  return returnPair;
+}
+
+std::pair<int, Acts::DynamicGaussianGridTrackDensity::TrackGridVector>
+Acts::DynamicGaussianGridTrackDensity::addTrack(
+    const BoundTrackParameters& trk, MainGridVector& mainGrid) const {
+  SquareMatrix2 cov = trk.spatialImpactParameterCovariance().value();
+  float d0 = trk.parameters()[0];
+  float z0 = trk.parameters()[1];
+
+  // Calculate offset in d direction to central bin at z-axis
+  int dOffset = static_cast<int>(std::floor(d0 / m_cfg.binSize - 0.5) + 1);
+  // Check if current track does affect grid density
+  // in central bins at z-axis
+  if (std::abs(dOffset) > (m_cfg.trkGridSize - 1) / 2.) {
+    // Current track is too far away to contribute
+    // to track density at z-axis bins
+    return {-1, TrackGridVector::Zero(m_cfg.trkGridSize)};
+  }
+
+  // Calculate bin in z
+  int zBin = int(z0 / m_cfg.binSize + m_cfg.mainGridSize / 2.);
+
+  if (zBin < 0 || zBin >= m_cfg.mainGridSize) {
+    return {-1, TrackGridVector::Zero(m_cfg.trkGridSize)};
+  }
+  // Calculate the positions of the bin centers
+  float binCtrZ = (zBin + 0.5f) * m_cfg.binSize - m_cfg.zMinMax;
+
+  // Calculate the distance between IP values and their
+  // corresponding bin centers
+  float distCtrZ = z0 - binCtrZ;
+
+  // Create the track grid
+  TrackGridVector trackGrid = createTrackGrid(d0, distCtrZ, cov);
+  // Add the track grid to the main grid
+  modifyMainGridWithTrackGrid(zBin, trackGrid, mainGrid, +1.f);
+
+  return {zBin, std::move(trackGrid)};
+}
+
+void Acts::DynamicGaussianGridTrackDensity::removeTrackGridFromMainGrid(
+    int zBin, const TrackGridVector& trkGrid, MainGridVector& mainGrid) const {
+  modifyMainGridWithTrackGrid(zBin, trkGrid, mainGrid, -1.f);
+}
+
+void Acts::DynamicGaussianGridTrackDensity::modifyMainGridWithTrackGrid(
+    int zBin, const TrackGridVector& trkGrid, MainGridVector& mainGrid,
+    float modifyModeSign) const {
+  if (zBin < 0) {
+    // The track was not added to the grid
+    return;
+  }
+  int width = (m_cfg.trkGridSize - 1) / 2;
+  // Clip the track grid to the main grid
+  int first = std::max(zBin - width, 0);
+  int last = std::min(zBin + width + 1, m_cfg.mainGridSize);
+  mainGrid.segment(first, last - first) +=
+      modifyModeSign * trkGrid.segment(first - (zBin - width), last - first);
+}
+
+Acts::DynamicGaussianGridTrackDensity::TrackGridVector
+Acts::DynamicGaussianGridTrackDensity::createTrackGrid(
+    float d0, float distCtrZ, const SquareMatrix2& cov) const {
+  const int n = m_cfg.trkGridSize;
+  float floorHalfTrkGridSize = static_cast<float>(n) / 2 - 0.5f;
+
+  // The exponent of the 2-dim Gaussian at d = -d0 is a quadratic
+  // polynomial in z, which is evaluated for all bins at once
+  float det = cov.determinant();
+  float coef = 1 / std::sqrt(det);
+  float d = -d0;
+  float a = -cov(0, 0) / (2 * det);
+  float b = (cov(0, 1) + cov(1, 0)) * d / (2 * det);
+  float c = -cov(1, 1) * d * d / (2 * det);
+
+  Eigen::ArrayXf z =
+      (Eigen::ArrayXf::LinSpaced(n, 0, n - 1) - floorHalfTrkGridSize) *
+          m_cfg.binSize -
+      distCtrZ;
+  Eigen::ArrayXf expo = (a * z + b) * z + c;
+  // Underflowing values are set to 0, see safeExp
+  constexpr float minExponent = -ExpSafeLimit<float>::value;
+  return coef * (expo < minExponent).select(0.f, expo.exp()).matrix();
+}
+
+Acts::Result<float> Acts::DynamicGaussianGridTrackDensity::estimateSeedWidth(
+    const MainGridVector& mainGrid, float maxZ) const {
+  if (mainGrid.isZero(0.)) {
+    return VertexingError::EmptyInput;
+  }
+  // Get z bin of max density z value
+  int zBin = int(maxZ / m_cfg.binSize + m_cfg.mainGridSize / 2.);
+  const int lastBin = m_cfg.mainGridSize - 1;
+
+  const float maxValue = mainGrid(zBin);
+  float gridValue = mainGrid(zBin);
+
+  // Find right half-maximum bin, without leaving the grid
+  int rhmBin = zBin;
+  while (gridValue > maxValue / 2 && rhmBin < lastBin) {
+    rhmBin += 1;
+    gridValue = mainGrid(rhmBin);
+  }
+
+  // Find left half-maximum bin
+  int lhmBin = zBin;
+  gridValue = mainGrid(zBin);
+  while (gridValue > maxValue / 2 && lhmBin > 0) {
+    lhmBin -= 1;
+    gridValue = mainGrid(lhmBin);
+  }
+
+  // The maximum is at the edge of the grid
+  if (rhmBin == zBin || lhmBin == zBin) {
+    return 0.0f;
+  }
+
+  // Use linear approximation to find better z value for FWHM between bins
+  float deltaZ1 = m_cfg.binSize * (maxValue / 2 - mainGrid(rhmBin - 1)) /
+                  (mainGrid(rhmBin) - mainGrid(rhmBin - 1));
+  float deltaZ2 = m_cfg.binSize * (mainGrid(lhmBin + 1) - maxValue / 2) /
+                  (mainGrid(lhmBin + 1) - mainGrid(lhmBin));
+
+  // Approximate FWHM
+  float fwhm =
+      rhmBin * m_cfg.binSize - deltaZ1 - lhmBin * m_cfg.binSize - deltaZ2;
+
+  // FWHM = 2.355 * sigma
+  float width = fwhm / 2.355f;
+
+  return std::isnormal(width) ? width : 0.0f;
+}
+
+int Acts::DynamicGaussianGridTrackDensity::getHighestSumZPosition(
+    MainGridVector& mainGrid) const {
+  // Checks the first (up to) 3 density maxima, if they are close, checks which
+  // one has the highest surrounding density sum (the two neighboring bins)
+
+  // The global maximum
+  int zbin = -1;
+  mainGrid.maxCoeff(&zbin);
+  int zFirstMax = zbin;
+  double firstDensity = mainGrid(zFirstMax);
+  double firstSum = getDensitySum(mainGrid, zFirstMax);
+
+  // Get the second highest maximum
+  mainGrid[zFirstMax] = 0;
+  mainGrid.maxCoeff(&zbin);
+  int zSecondMax = zbin;
+  double secondDensity = mainGrid(zSecondMax);
+  double secondSum = 0;
+  if (firstDensity - secondDensity <
+      firstDensity * m_cfg.maxRelativeDensityDev) {
+    secondSum = getDensitySum(mainGrid, zSecondMax);
+  }
+
+  // Get the third highest maximum
+  mainGrid[zSecondMax] = 0;
+  mainGrid.maxCoeff(&zbin);
+  int zThirdMax = zbin;
+  double thirdDensity = mainGrid(zThirdMax);
+  double thirdSum = 0;
+  if (firstDensity - thirdDensity <
+      firstDensity * m_cfg.maxRelativeDensityDev) {
+    thirdSum = getDensitySum(mainGrid, zThirdMax);
+  }
+
+  // Revert back to original values
+  mainGrid[zFirstMax] = firstDensity;
+  mainGrid[zSecondMax] = secondDensity;
+
+  // Return the z-bin position of the highest density sum
+  if (secondSum > firstSum && secondSum > thirdSum) {
+    return zSecondMax;
+  }
+  if (thirdSum > secondSum && thirdSum > firstSum) {
+    return zThirdMax;
+  }
+  return zFirstMax;
+}
+
+double Acts::DynamicGaussianGridTrackDensity::getDensitySum(
+    const MainGridVector& mainGrid, int pos) const {
+  double sum = mainGrid(pos);
+  // Sum up only the density contributions from the
+  // neighboring bins if they are still within bounds
+  if (pos - 1 >= 0) {
+    sum += mainGrid(pos - 1);
+  }
+  if (pos + 1 <= mainGrid.size() - 1) {
+    sum += mainGrid(pos + 1);
+  }
+  return sum;
+}
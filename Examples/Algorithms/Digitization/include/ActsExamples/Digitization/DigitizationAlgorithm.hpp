@@ -25,12 +25,14 @@
 #include "ActsExamples/Framework/IAlgorithm.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
 #include "ActsExamples/Framework/RandomNumbers.hpp"
+#include "ActsExamples/Utilities/Range.hpp"
 #include "ActsFatras/Digitization/Channelizer.hpp"
 #include "ActsFatras/Digitization/Segmentizer.hpp"
 #include "ActsFatras/Digitization/UncorrelatedHitSmearer.hpp"
 
 #include <cstddef>
 #include <memory>
+#include <set>
 #include <string>
 #include <tuple>
 #include <utility>
@@ -94,6 +96,30 @@ class DigitizationAlgorithm final : public IAlgorithm {
                                  CombinedDigitizer<2>, CombinedDigitizer<3>,
                                  CombinedDigitizer<4>>;
 
+  /// Digitized parameters and contributing simulated hits of one module
+  struct ModuleDigitization {
+    std::vector<
+        std::pair<DigitizedParameters, std::set<SimHitContainer::size_type>>>
+        parameters;
+    std::size_t skippedHits = 0;
+  };
+
+  /// Digitize the simulated hits of a single module
+  ///
+  /// @param ctx is the algorithm context with event information
+  /// @param simHits are all simulated hits of the event
+  /// @param moduleSimHits are the simulated hits of the module
+  /// @param surface is the module surface
+  /// @param digitizer is the digitizer of the module
+  /// @param rng the Random number engine
+  ///
+  /// @return the digitized parameters of the module
+  ModuleDigitization digitizeModule(
+      const AlgorithmContext& ctx, const SimHitContainer& simHits,
+      const Range<SimHitContainer::const_iterator>& moduleSimHits,
+      const Acts::Surface& surface, const Digitizer& digitizer,
+      RandomEngine& rng) const;
+
   /// Configuration of the Algorithm
   DigitizationConfig m_cfg;
   /// Digitizers within geometry hierarchy
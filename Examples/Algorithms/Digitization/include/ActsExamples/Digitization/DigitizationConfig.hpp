@@ -151,6 +151,11 @@ class DigitizationConfig {
   /// Table 35.10)
   /// @NOTE The default is set to 0 because this works only well with Geant4
   double minEnergyDeposit = 0.0;  // 1000 * 3.65 * Acts::UnitConstants::eV;
+  /// Digitize the modules concurrently. Each module then uses its own random
+  /// number stream seeded from the event and the module identifier, so the
+  /// results do not depend on the number of threads, but differ from the
+  /// sequential mode.
+  bool parallelModules = false;
   /// The digitizers per GeometryIdentifiers
   Acts::GeometryHierarchyMap<DigiComponentsConfig> digitizationConfigs;
 
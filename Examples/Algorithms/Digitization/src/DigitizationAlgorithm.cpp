@@ -23,6 +23,7 @@
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
 #include "ActsExamples/Utilities/GroupBy.hpp"
 #include "ActsExamples/Utilities/Range.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
 #include "ActsFatras/EventData/Barcode.hpp"
 #include "ActsFatras/EventData/Hit.hpp"
 
@@ -31,6 +32,7 @@
 #include <cmath>
 #include <cstdint>
 #include <ostream>
+#include <random>
 #include <set>
 #include <stdexcept>
 #include <string>
@@ -147,21 +149,16 @@ ActsExamples::ProcessCode ActsExamples::DigitizationAlgorithm::execute(
   measurementParticlesMap.reserve(simHits.size());
   measurementSimHitsMap.reserve(simHits.size());
 
-  // Setup random number generator
-  auto rng = m_cfg.randomNumbers->spawnGenerator(ctx);
-
-  // Some statistics
-  std::size_t skippedHits = 0;
-
-  ACTS_DEBUG("Starting loop over modules ...");
-  for (const auto& simHitsGroup : groupByModule(simHits)) {
-    // Manual pair unpacking instead of using
-    //   auto [moduleGeoId, moduleSimHits] : ...
-    // otherwise clang on macos complains that it is unable to capture the local
-    // binding in the lambda used for visiting the smearer below.
-    Acts::GeometryIdentifier moduleGeoId = simHitsGroup.first;
-    const auto& moduleSimHits = simHitsGroup.second;
+  // Collect the modules with a digitizer
+  struct ModuleInput {
+    Acts::GeometryIdentifier geoId;
+    const Acts::Surface* surface = nullptr;
+    const Digitizer* digitizer = nullptr;
+    Range<SimHitContainer::const_iterator> simHits;
+  };
+  std::vector<ModuleInput> modules;
 
+  for (const auto& [moduleGeoId, moduleSimHits] : groupByModule(simHits)) {
     const Acts::Surface* surfacePtr =
         m_cfg.trackingGeometry->findSurface(moduleGeoId);
 
@@ -180,106 +177,75 @@ ActsExamples::ProcessCode ActsExamples::DigitizationAlgorithm::execute(
     } else {
       ACTS_VERBOSE("Digitizer found for module " << moduleGeoId);
     }
+    modules.push_back({moduleGeoId, surfacePtr, &(*digitizerItr),
+                       moduleSimHits});
+  }
 
-    // Run the digitizer. Iterate over the hits for this surface inside the
-    // visitor so we do not need to lookup the variant object per-hit.
-    std::visit(
-        [&](const auto& digitizer) {
-          ModuleClusters moduleClusters(
-              digitizer.geometric.segmentation, digitizer.geometric.indices,
-              m_cfg.doMerge, m_cfg.mergeNsigma, m_cfg.mergeCommonCorner);
-
-          for (auto h = moduleSimHits.begin(); h != moduleSimHits.end(); ++h) {
-            const auto& simHit = *h;
-            const auto simHitIdx = simHits.index_of(h);
-
-            DigitizedParameters dParameters;
-
-            if (simHit.depositedEnergy() < m_cfg.minEnergyDeposit) {
-              ACTS_VERBOSE("Skip hit because energy deposit to small")
-              continue;
-            }
-
-            // Geometric part - 0, 1, 2 local parameters are possible
-            if (!digitizer.geometric.indices.empty()) {
-              ACTS_VERBOSE("Configured to geometric digitize "
-                           << digitizer.geometric.indices.size()
-                           << " parameters.");
-              const auto& cfg = digitizer.geometric;
-              Acts::Vector3 driftDir = cfg.drift(simHit.position(), rng);
-              auto channelsRes = m_channelizer.channelize(
-                  simHit, *surfacePtr, ctx.geoContext, driftDir,
-                  cfg.segmentation, cfg.thickness);
-              if (!channelsRes.ok() || channelsRes->empty()) {
-                ACTS_DEBUG(
-                    "Geometric channelization did not work, skipping this hit.")
-                continue;
-              }
-              ACTS_VERBOSE("Activated " << channelsRes->size()
-                                        << " channels for this hit.");
-              dParameters =
-                  localParameters(digitizer.geometric, *channelsRes, rng);
-            }
-
-            // Smearing part - (optionally) rest
-            if (!digitizer.smearing.indices.empty()) {
-              ACTS_VERBOSE("Configured to smear "
-                           << digitizer.smearing.indices.size()
-                           << " parameters.");
-              auto res =
-                  digitizer.smearing(rng, simHit, *surfacePtr, ctx.geoContext);
-              if (!res.ok()) {
-                ++skippedHits;
-                ACTS_DEBUG("Problem in hit smearing, skip hit ("
-                           << res.error().message() << ")");
-                continue;
-              }
-              const auto& [par, cov] = res.value();
-              for (Eigen::Index ip = 0; ip < par.rows(); ++ip) {
-                dParameters.indices.push_back(digitizer.smearing.indices[ip]);
-                dParameters.values.push_back(par[ip]);
-                dParameters.variances.push_back(cov(ip, ip));
-              }
-            }
-
-            // Check on success - threshold could have eliminated all channels
-            if (dParameters.values.empty()) {
-              ACTS_VERBOSE(
-                  "Parameter digitization did not yield a measurement.")
-              continue;
-            }
-
-            moduleClusters.add(std::move(dParameters), simHitIdx);
+  ACTS_DEBUG("Starting loop over " << modules.size() << " modules ...");
+  std::vector<ModuleDigitization> digitizedModules(modules.size());
+  if (m_cfg.parallelModules) {
+    const std::uint64_t eventSeed = m_cfg.randomNumbers->generateSeed(ctx);
+    tbbWrap::parallel_for(
+        tbb::blocked_range<std::size_t>(0, modules.size()),
+        [&](const tbb::blocked_range<std::size_t>& r) {
+          for (std::size_t i = r.begin(); i != r.end(); ++i) {
+            const ModuleInput& module = modules[i];
+            // Random number stream of the module, independent of the
+            // order in which the modules are processed
+            const std::uint64_t geoId = module.geoId.value();
+            std::seed_seq seeds{static_cast<std::uint32_t>(eventSeed),
+                                static_cast<std::uint32_t>(eventSeed >> 32),
+                                static_cast<std::uint32_t>(geoId),
+                                static_cast<std::uint32_t>(geoId >> 32)};
+            RandomEngine rng(seeds);
+            digitizedModules[i] =
+                digitizeModule(ctx, simHits, module.simHits, *module.surface,
+                               *module.digitizer, rng);
           }
+        });
+  } else {
+    // Setup random number generator
+    auto rng = m_cfg.randomNumbers->spawnGenerator(ctx);
+    for (std::size_t i = 0; i < modules.size(); ++i) {
+      const ModuleInput& module = modules[i];
+      digitizedModules[i] =
+          digitizeModule(ctx, simHits, module.simHits, *module.surface,
+                         *module.digitizer, rng);
+    }
+  }
 
-          for (auto& [dParameters, simhits] :
-               moduleClusters.digitizedParameters()) {
-            // The measurement container is unordered and the index under which
-            // the measurement will be stored is known before adding it.
-            Index measurementIdx = measurements.size();
-            IndexSourceLink sourceLink{moduleGeoId, measurementIdx};
-
-            // Add to output containers:
-            // index map and source link container are geometry-ordered.
-            // since the input is also geometry-ordered, new items can
-            // be added at the end.
-            sourceLinks.insert(sourceLinks.end(), sourceLink);
-
-            measurements.emplace_back(
-                createMeasurement(dParameters, sourceLink));
-            clusters.emplace_back(std::move(dParameters.cluster));
-            // this digitization does hit merging so there can be more than one
-            // mapping entry for each digitized hit.
-            for (auto simHitIdx : simhits) {
-              measurementParticlesMap.emplace_hint(
-                  measurementParticlesMap.end(), measurementIdx,
-                  simHits.nth(simHitIdx)->particleId());
-              measurementSimHitsMap.emplace_hint(measurementSimHitsMap.end(),
-                                                 measurementIdx, simHitIdx);
-            }
-          }
-        },
-        *digitizerItr);
+  // Merge in module order, such that the measurement indices do not depend
+  // on the processing order
+  std::size_t skippedHits = 0;
+  for (std::size_t i = 0; i < modules.size(); ++i) {
+    skippedHits += digitizedModules[i].skippedHits;
+
+    for (auto& [dParameters, simhits] : digitizedModules[i].parameters) {
+      // The measurement container is unordered and the index under which
+      // the measurement will be stored is known before adding it.
+      Index measurementIdx = measurements.size();
+      IndexSourceLink sourceLink{modules[i].geoId, measurementIdx};
+
+      // Add to output containers:
+      // index map and source link container are geometry-ordered.
+      // since the input is also geometry-ordered, new items can
+      // be added at the end.
+      sourceLinks.insert(sourceLinks.end(), sourceLink);
+
+      measurements.emplace_back(createMeasurement(dParameters, sourceLink));
+      clusters.emplace_back(std::move(dParameters.cluster));
+      // this digitization does hit merging so there can be more than one
+      // mapping entry for each digitized hit.
+      for (auto simHitIdx : simhits) {
+        measurementParticlesMap.emplace_hint(
+            measurementParticlesMap.end(), measurementIdx,
+            simHits.nth(simHitIdx)->particleId());
+        measurementSimHitsMap.emplace_hint(measurementSimHitsMap.end(),
+                                           measurementIdx, simHitIdx);
+      }
+    }
+    // Release the memory of the module early
+    digitizedModules[i] = ModuleDigitization();
   }
 
   if (skippedHits > 0) {
@@ -296,6 +262,93 @@ ActsExamples::ProcessCode ActsExamples::DigitizationAlgorithm::execute(
   return ProcessCode::SUCCESS;
 }
 
+ActsExamples::DigitizationAlgorithm::ModuleDigitization
+ActsExamples::DigitizationAlgorithm::digitizeModule(
+    const AlgorithmContext& ctx, const SimHitContainer& simHits,
+    const Range<SimHitContainer::const_iterator>& moduleSimHits,
+    const Acts::Surface& surface, const Digitizer& digitizer,
+    RandomEngine& rng) const {
+  ModuleDigitization output;
+
+  // Run the digitizer. Iterate over the hits for this surface inside the
+  // visitor so we do not need to lookup the variant object per-hit.
+  std::visit(
+      [&](const auto& combinedDigitizer) {
+        ModuleClusters moduleClusters(
+            combinedDigitizer.geometric.segmentation,
+            combinedDigitizer.geometric.indices, m_cfg.doMerge,
+            m_cfg.mergeNsigma, m_cfg.mergeCommonCorner);
+
+        for (auto h = moduleSimHits.begin(); h != moduleSimHits.end(); ++h) {
+          const auto& simHit = *h;
+          const auto simHitIdx = simHits.index_of(h);
+
+          DigitizedParameters dParameters;
+
+          if (simHit.depositedEnergy() < m_cfg.minEnergyDeposit) {
+            ACTS_VERBOSE("Skip hit because energy deposit to small")
+            continue;
+          }
+
+          // Geometric part - 0, 1, 2 local parameters are possible
+          if (!combinedDigitizer.geometric.indices.empty()) {
+            ACTS_VERBOSE("Configured to geometric digitize "
+                         << combinedDigitizer.geometric.indices.size()
+                         << " parameters.");
+            const auto& cfg = combinedDigitizer.geometric;
+            Acts::Vector3 driftDir = cfg.drift(simHit.position(), rng);
+            auto channelsRes = m_channelizer.channelize(
+                simHit, surface, ctx.geoContext, driftDir, cfg.segmentation,
+                cfg.thickness);
+            if (!channelsRes.ok() || channelsRes->empty()) {
+              ACTS_DEBUG(
+                  "Geometric channelization did not work, skipping this hit.")
+              continue;
+            }
+            ACTS_VERBOSE("Activated " << channelsRes->size()
+                                      << " channels for this hit.");
+            dParameters = localParameters(combinedDigitizer.geometric,
+                                          *channelsRes, rng);
+          }
+
+          // Smearing part - (optionally) rest
+          if (!combinedDigitizer.smearing.indices.empty()) {
+            ACTS_VERBOSE("Configured to smear "
+                         << combinedDigitizer.smearing.indices.size()
+                         << " parameters.");
+            auto res = combinedDigitizer.smearing(rng, simHit, surface,
+                                                  ctx.geoContext);
+            if (!res.ok()) {
+              ++output.skippedHits;
+              ACTS_DEBUG("Problem in hit smearing, skip hit ("
+                         << res.error().message() << ")");
+              continue;
+            }
+            const auto& [par, cov] = res.value();
+            for (Eigen::Index ip = 0; ip < par.rows(); ++ip) {
+              dParameters.indices.push_back(
+                  combinedDigitizer.smearing.indices[ip]);
+              dParameters.values.push_back(par[ip]);
+              dParameters.variances.push_back(cov(ip, ip));
+            }
+          }
+
+          // Check on success - threshold could have eliminated all channels
+          if (dParameters.values.empty()) {
+            ACTS_VERBOSE("Parameter digitization did not yield a measurement.")
+            continue;
+          }
+
+          moduleClusters.add(std::move(dParameters), simHitIdx);
+        }
+
+        output.parameters = moduleClusters.digitizedParameters();
+      },
+      digitizer);
+
+  return output;
+}
+
 ActsExamples::DigitizedParameters
 ActsExamples::DigitizationAlgorithm::localParameters(
     const GeometricConfig& geoCfg,
@@ -0,0 +1,58 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Material/BinaryMaterialMaps.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "ActsExamples/MaterialMapping/IMaterialWriter.hpp"
+
+#include <memory>
+#include <string>
+
+namespace ActsExamples {
+
+/// @class BinaryMaterialWriter
+///
+/// @brief Writes out the detector material maps in the compact binary format,
+/// which can be memory-mapped by the Acts::BinaryMaterialDecorator
+class BinaryMaterialWriter : public IMaterialWriter {
+ public:
+  struct Config {
+    /// The name of the output file
+    std::string fileName = "material-maps.bin";
+  };
+
+  /// Constructor
+  ///
+  /// @param config The configuration struct of the writer
+  /// @param level The log level
+  BinaryMaterialWriter(const Config& config, Acts::Logging::Level level);
+
+  /// Virtual destructor
+  ~BinaryMaterialWriter() override;
+
+  /// Write out the material map
+  ///
+  /// @param detMaterial is the SurfaceMaterial and VolumeMaterial maps
+  void writeMaterial(const Acts::DetectorMaterialMaps& detMaterial) override;
+
+  /// Readonly access to the config
+  const Config& config() const { return m_cfg; }
+
+ private:
+  const Acts::Logger& logger() const { return *m_logger; }
+
+  /// The config of the writer
+  Config m_cfg;
+
+  /// The logger instance
+  std::unique_ptr<const Acts::Logger> m_logger;
+};
+
+}  // namespace ActsExamples
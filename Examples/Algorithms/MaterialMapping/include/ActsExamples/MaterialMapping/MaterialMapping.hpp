@@ -68,7 +68,9 @@ namespace ActsExamples {
 /// the I/O structure.
 ///
 /// It therefore saves the mapping state/cache as a private member variable
-/// and is designed to be executed in a single threaded mode.
+/// and is designed to be executed in a single threaded mode. With
+/// `parallelMapping` the tracks are instead mapped concurrently onto a pool
+/// of per-thread states, which are merged before the maps are finalized.
 class MaterialMapping : public IAlgorithm {
  public:
   /// @class nested Config class
@@ -98,6 +100,9 @@ class MaterialMapping : public IAlgorithm {
 
     /// The TrackingGeometry to be mapped on
     std::shared_ptr<const Acts::TrackingGeometry> trackingGeometry = nullptr;
+
+    /// Map the tracks concurrently using per-thread mapping states
+    bool parallelMapping = false;
   };
 
   /// Constructor
@@ -134,6 +139,29 @@ class MaterialMapping : public IAlgorithm {
       m_mappingStateVol;  //!< Material mapping state
                           //
 
+  /// Mapping states used by one thread at a time in the parallel mode
+  struct ThreadState {
+    ThreadState(const Acts::GeometryContext& gctx,
+                const Acts::MagneticFieldContext& mctx)
+        : surface(gctx, mctx), volume(gctx, mctx) {}
+
+    Acts::SurfaceMaterialMapper::State surface;
+    Acts::VolumeMaterialMapper::State volume;
+  };
+
+  /// Take a state from the pool, a new one is created if none is free
+  ThreadState* acquireThreadState() const;
+
+  /// Return a state to the pool
+  void releaseThreadState(ThreadState* state) const;
+
+  /// Merge the per-thread states into the central ones and clear the pool
+  void mergeThreadStates();
+
+  mutable std::mutex m_threadStateMutex;
+  mutable std::vector<std::unique_ptr<ThreadState>> m_threadStates;
+  mutable std::vector<ThreadState*> m_freeThreadStates;
+
   ReadDataHandle<std::unordered_map<std::size_t, Acts::RecordedMaterialTrack>>
       m_inputMaterialTracks{this, "InputMaterialTracks"};
   WriteDataHandle<std::unordered_map<std::size_t, Acts::RecordedMaterialTrack>>
@@ -0,0 +1,31 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/MaterialMapping/BinaryMaterialWriter.hpp"
+
+#include <stdexcept>
+
+ActsExamples::BinaryMaterialWriter::BinaryMaterialWriter(
+    const ActsExamples::BinaryMaterialWriter::Config& config,
+    Acts::Logging::Level level)
+    : m_cfg(config),
+      m_logger{Acts::getDefaultLogger("BinaryMaterialWriter", level)} {
+  if (m_cfg.fileName.empty()) {
+    throw std::invalid_argument("Missing output filename");
+  }
+}
+
+ActsExamples::BinaryMaterialWriter::~BinaryMaterialWriter() = default;
+
+void ActsExamples::BinaryMaterialWriter::writeMaterial(
+    const Acts::DetectorMaterialMaps& detMaterial) {
+  ACTS_INFO("Writing " << detMaterial.first.size() << " surface and "
+                       << detMaterial.second.size()
+                       << " volume material maps to " << m_cfg.fileName);
+  Acts::writeBinaryMaterialMaps(m_cfg.fileName, detMaterial);
+}
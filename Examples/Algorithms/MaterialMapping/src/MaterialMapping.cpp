@@ -11,6 +11,7 @@
 #include "Acts/Material/AccumulatedMaterialSlab.hpp"
 #include "Acts/Material/AccumulatedSurfaceMaterial.hpp"
 #include "ActsExamples/MaterialMapping/IMaterialWriter.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
 
 #include <iostream>
 #include <stdexcept>
@@ -36,8 +37,10 @@ ActsExamples::MaterialMapping::MaterialMapping(
   m_inputMaterialTracks.initialize(m_cfg.collection);
   m_outputMaterialTracks.initialize(m_cfg.mappingMaterialCollection);
 
-  ACTS_INFO("This algorithm requires inter-event information, "
-            << "run in single-threaded mode!");
+  if (!m_cfg.parallelMapping) {
+    ACTS_INFO("This algorithm requires inter-event information, "
+              << "run in single-threaded mode!");
+  }
 
   if (m_cfg.materialSurfaceMapper) {
     // Generate and retrieve the central cache object
@@ -52,6 +55,9 @@ ActsExamples::MaterialMapping::MaterialMapping(
 }
 
 ActsExamples::MaterialMapping::~MaterialMapping() {
+  // Collect the material accumulated by the parallel mapping
+  mergeThreadStates();
+
   Acts::DetectorMaterialMaps detectorMaterial;
 
   if (m_cfg.materialSurfaceMapper && m_cfg.materialVolumeMapper) {
@@ -104,6 +110,33 @@ ActsExamples::ProcessCode ActsExamples::MaterialMapping::execute(
   std::unordered_map<std::size_t, Acts::RecordedMaterialTrack>
       mtrackCollection = m_inputMaterialTracks(context);
 
+  if (m_cfg.parallelMapping) {
+    std::vector<Acts::RecordedMaterialTrack*> mTracks;
+    mTracks.reserve(mtrackCollection.size());
+    for (auto& [idTrack, mTrack] : mtrackCollection) {
+      mTracks.push_back(&mTrack);
+    }
+    // Each chunk of tracks is mapped onto a state no other thread uses
+    tbbWrap::parallel_for(
+        tbb::blocked_range<std::size_t>(0, mTracks.size()),
+        [&](const tbb::blocked_range<std::size_t>& range) {
+          ThreadState* state = acquireThreadState();
+          for (std::size_t i = range.begin(); i != range.end(); ++i) {
+            if (m_cfg.materialSurfaceMapper) {
+              m_cfg.materialSurfaceMapper->mapMaterialTrack(state->surface,
+                                                            *mTracks[i]);
+            }
+            if (m_cfg.materialVolumeMapper) {
+              m_cfg.materialVolumeMapper->mapMaterialTrack(state->volume,
+                                                           *mTracks[i]);
+            }
+          }
+          releaseThreadState(state);
+        });
+    m_outputMaterialTracks(context, std::move(mtrackCollection));
+    return ActsExamples::ProcessCode::SUCCESS;
+  }
+
   if (m_cfg.materialSurfaceMapper) {
     // To make it work with the framework needs a lock guard
     auto mappingState =
@@ -128,9 +161,54 @@ ActsExamples::ProcessCode ActsExamples::MaterialMapping::execute(
   return ActsExamples::ProcessCode::SUCCESS;
 }
 
+ActsExamples::MaterialMapping::ThreadState*
+ActsExamples::MaterialMapping::acquireThreadState() const {
+  std::lock_guard<std::mutex> lock(m_threadStateMutex);
+  if (!m_freeThreadStates.empty()) {
+    ThreadState* state = m_freeThreadStates.back();
+    m_freeThreadStates.pop_back();
+    return state;
+  }
+  auto state =
+      std::make_unique<ThreadState>(m_cfg.geoContext, m_cfg.magFieldContext);
+  if (m_cfg.materialSurfaceMapper) {
+    state->surface = m_cfg.materialSurfaceMapper->createState(
+        m_cfg.geoContext, m_cfg.magFieldContext, *m_cfg.trackingGeometry);
+  }
+  if (m_cfg.materialVolumeMapper) {
+    state->volume = m_cfg.materialVolumeMapper->createState(
+        m_cfg.geoContext, m_cfg.magFieldContext, *m_cfg.trackingGeometry);
+  }
+  m_threadStates.push_back(std::move(state));
+  return m_threadStates.back().get();
+}
+
+void ActsExamples::MaterialMapping::releaseThreadState(
+    ThreadState* state) const {
+  std::lock_guard<std::mutex> lock(m_threadStateMutex);
+  m_freeThreadStates.push_back(state);
+}
+
+void ActsExamples::MaterialMapping::mergeThreadStates() {
+  std::lock_guard<std::mutex> lock(m_threadStateMutex);
+  for (const auto& threadState : m_threadStates) {
+    if (m_cfg.materialSurfaceMapper) {
+      m_cfg.materialSurfaceMapper->mergeState(m_mappingState,
+                                              threadState->surface);
+    }
+    if (m_cfg.materialVolumeMapper) {
+      m_cfg.materialVolumeMapper->mergeState(m_mappingStateVol,
+                                             threadState->volume);
+    }
+  }
+  m_threadStates.clear();
+  m_freeThreadStates.clear();
+}
+
 std::vector<std::pair<double, int>>
 ActsExamples::MaterialMapping::scoringParameters(uint64_t surfaceID) {
   std::vector<std::pair<double, int>> scoringParameters;
+  mergeThreadStates();
 
   if (m_cfg.materialSurfaceMapper) {
     auto surfaceAccumulatedMaterial = m_mappingState.accumulatedMaterial.find(
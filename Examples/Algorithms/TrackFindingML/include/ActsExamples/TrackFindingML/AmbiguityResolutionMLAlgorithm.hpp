@@ -34,6 +34,8 @@ class AmbiguityResolutionMLAlgorithm final : public AmbiguityResolutionML {
     std::string outputTracks;
     /// Minimum number of measurement to form a track.
     int nMeasurementsMin = 7;
+    /// Cluster independent groups of tracks concurrently
+    bool parallelClustering = false;
   };
 
   /// Construct the ambiguity resolution algorithm.
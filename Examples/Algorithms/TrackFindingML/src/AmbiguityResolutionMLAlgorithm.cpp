@@ -8,7 +8,10 @@
 
 #include "ActsExamples/TrackFindingML/AmbiguityResolutionMLAlgorithm.hpp"
 
+#include "Acts/TrackFinding/detail/AmbiguityTrackClustering.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
 
 #include <iterator>
 #include <map>
@@ -37,7 +40,11 @@ ActsExamples::ProcessCode ActsExamples::AmbiguityResolutionMLAlgorithm::execute(
   // Associate measurement to their respective tracks
   std::multimap<int, std::pair<int, std::vector<int>>> trackMap =
       mapTrackHits(tracks, m_cfg.nMeasurementsMin);
-  auto cluster = Acts::detail::clusterDuplicateTracks(trackMap);
+  Acts::ParallelForExecutor executor;
+  if (m_cfg.parallelClustering) {
+    executor = tbbWrap::parallelForExecutor();
+  }
+  auto cluster = Acts::detail::clusterDuplicateTracks(trackMap, executor);
   // Select the ID of the track we want to keep
   std::vector<int> goodTracks =
       m_duplicateClassifier.solveAmbuguity(cluster, tracks);
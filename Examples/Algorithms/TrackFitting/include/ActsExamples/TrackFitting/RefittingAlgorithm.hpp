@@ -33,6 +33,11 @@ class RefittingAlgorithm final : public IAlgorithm {
     std::shared_ptr<TrackFitterFunction> fit;
     /// Pick a single track for debugging (-1 process all tracks)
     int pickTrack = -1;
+    /// Reuse the transport of the input fit, if the fitter supports it
+    bool linearizedRefit = false;
+    /// Maximum change of the filtered parameters, as chi2 w.r.t. the input
+    /// fit, up to which the transport is reused in a linearized refit
+    double refitMaxParameterChange = 1.0;
   };
 
   /// Constructor of the fitting algorithm
@@ -56,6 +56,22 @@ class TrackFitterFunction {
                                        const RefittingCalibrator&,
                                        const std::vector<const Acts::Surface*>&,
                                        TrackContainer&) const = 0;
+
+  /// Refit a track of a previous fit, reusing its transport if the fitter
+  /// supports it and the parameters change by less than
+  /// @p maxParameterChange. By default the track is fitted again along the
+  /// surface sequence.
+  virtual TrackFitterResult refit(
+      const ConstTrackContainer::ConstTrackProxy& /*track*/,
+      const std::vector<Acts::SourceLink>& sourceLinks,
+      const TrackParameters& initialParameters,
+      const GeneralFitterOptions& options,
+      const RefittingCalibrator& calibrator,
+      const std::vector<const Acts::Surface*>& surfaceSequence,
+      double /*maxParameterChange*/, TrackContainer& tracks) const {
+    return (*this)(sourceLinks, initialParameters, options, calibrator,
+                   surfaceSequence, tracks);
+  }
 };
 
 /// Makes a fitter function object for the Kalman Filter
@@ -24,6 +24,7 @@
 #include "Acts/TrackFitting/KalmanFitter.hpp"
 #include "Acts/Utilities/Delegate.hpp"
 #include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/Zip.hpp"
 #include "ActsExamples/EventData/IndexSourceLink.hpp"
 #include "ActsExamples/EventData/MeasurementCalibration.hpp"
 #include "ActsExamples/EventData/Track.hpp"
@@ -143,6 +144,38 @@ struct KalmanFitterFunctionImpl final : public TrackFitterFunction {
                             initialParameters, kfOptions, surfaceSequence,
                             tracks);
   }
+
+  TrackFitterResult refit(
+      const ConstTrackContainer::ConstTrackProxy& track,
+      const std::vector<Acts::SourceLink>& /*sourceLinks*/,
+      const TrackParameters& initialParameters,
+      const GeneralFitterOptions& options,
+      const RefittingCalibrator& calibrator,
+      const std::vector<const Acts::Surface*>& /*surfaceSequence*/,
+      double maxParameterChange, TrackContainer& tracks) const override {
+    auto kfOptions = makeKfOptions(options, calibrator);
+    kfOptions.refitMaxParameterChange = maxParameterChange;
+
+    // The refit calibrates the uncalibrated source links of the previous
+    // track states, so they have to refer to the input states
+    TrackContainer previous{std::make_shared<Acts::VectorTrackContainer>(),
+                            std::make_shared<Acts::VectorMultiTrajectory>()};
+    previous.ensureDynamicColumns(track.container());
+    auto previousTrack = previous.getTrack(previous.addTrack());
+    previousTrack.copyFrom(track, true);
+
+    auto previousStates = previousTrack.trackStatesReversed();
+    auto inputStates = track.trackStatesReversed();
+    for (auto [state, input] : Acts::zip(previousStates, inputStates)) {
+      if (input.hasUncalibratedSourceLink()) {
+        state.setUncalibratedSourceLink(
+            Acts::SourceLink{RefittingCalibrator::RefittingSourceLink{input}});
+      }
+    }
+
+    return directFitter.refit(previousTrack, initialParameters, kfOptions,
+                              tracks);
+  }
 };
 
 }  // namespace
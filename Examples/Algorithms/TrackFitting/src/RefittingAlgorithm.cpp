@@ -99,8 +99,13 @@ ActsExamples::ProcessCode ActsExamples::RefittingAlgorithm::execute(
                  << " -> " << initialParams.direction().transpose());
 
     ACTS_DEBUG("Invoke direct fitter for track " << itrack);
-    auto result = (*m_cfg.fit)(trackSourceLinks, initialParams, options,
-                               calibrator, surfSequence, tracks);
+    auto result =
+        m_cfg.linearizedRefit
+            ? m_cfg.fit->refit(track, trackSourceLinks, initialParams, options,
+                               calibrator, surfSequence,
+                               m_cfg.refitMaxParameterChange, tracks)
+            : (*m_cfg.fit)(trackSourceLinks, initialParams, options,
+                           calibrator, surfSequence, tracks);
 
     if (result.ok()) {
       // Get the fit output object
@@ -75,6 +75,8 @@ class AdaptiveMultiVertexFinderAlgorithm final : public IAlgorithm {
     SeedFinder seedFinder;
     /// Use time information in vertex seeder, finder, and fitter
     bool useTime = false;
+    /// Update the vertices of each multi-vertex fit iteration concurrently
+    bool parallelVertexFits = false;
     /// The magnetic field
     std::shared_ptr<Acts::MagneticFieldProvider> bField;
   };
@@ -8,6 +8,10 @@
 
 #pragma once
 
+#include "Acts/Utilities/ParallelFor.hpp"
+
+#include <cstddef>
+
 // uncomment to remove all use of tbb library.
 // #define ACTS_EXAMPLES_NO_TBB
 
@@ -66,7 +70,7 @@ namespace tbbWrap {
 /// This means that enableTBB(nthreads) itself is not thread-safe. That should
 /// be fine because the task_arena is initialised before spawning any threads.
 /// If multi-threading is ever enabled, then it is not disabled.
-static bool enableTBB(int nthreads = -99) {
+inline bool enableTBB(int nthreads = -99) {
   static bool setting = false;
   if (nthreads != -99) {
 #ifdef ACTS_EXAMPLES_NO_TBB
@@ -134,6 +138,17 @@ class parallel_for {
   }
 };
 
+/// Executor for the parallel loops of Acts algorithms, see
+/// Acts::ParallelForExecutor, using parallel_for above.
+inline Acts::ParallelForExecutor parallelForExecutor() {
+  return [](std::size_t size, const Acts::ParallelForBody& body) {
+    parallel_for(tbb::blocked_range<std::size_t>(0, size),
+                 [&](const tbb::blocked_range<std::size_t>& r) {
+                   body(r.begin(), r.end());
+                 });
+  };
+}
+
 /// Small wrapper for tbb::queuing_mutex and tbb::queuing_mutex::scoped_lock.
 class queuing_mutex {
 #ifndef ACTS_EXAMPLES_NO_TBB
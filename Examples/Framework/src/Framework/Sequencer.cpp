@@ -9,6 +9,7 @@
 #include "ActsExamples/Framework/Sequencer.hpp"
 
 #include "Acts/Plugins/FpeMonitoring/FpeMonitor.hpp"
+#include "Acts/Utilities/AllocationCounter.hpp"
 #include "Acts/Utilities/Helpers.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
@@ -364,6 +365,27 @@ struct StopWatch {
   ~StopWatch() { store += Clock::now() - start; }
 };
 
+// Per-algorithm resource usage accumulated over events
+struct AlgorithmUsage {
+  Duration time = Duration::zero();
+  Acts::AllocationCount allocations;
+
+  AlgorithmUsage& operator+=(const AlgorithmUsage& other) {
+    time += other.time;
+    allocations += other.allocations;
+    return *this;
+  }
+};
+
+// RAII-based meter to time execution and count allocations within a block
+struct UsageMeter {
+  StopWatch stopWatch;
+  Acts::ScopedAllocationCounter allocationCounter;
+
+  UsageMeter(AlgorithmUsage& u)
+      : stopWatch(u.time), allocationCounter(&u.allocations) {}
+};
+
 // Convert duration to a printable string w/ reasonable unit.
 template <typename D>
 inline std::string asString(D duration) {
@@ -386,24 +408,34 @@ inline std::string perEvent(D duration, std::size_t numEvents) {
 }
 
 // Store timing data
+//
+// The allocation columns are only filled if Acts was built with allocation
+// counting enabled and are zero otherwise.
 struct TimingInfo {
   std::string identifier;
   double time_total_s = 0;
   double time_perevent_s = 0;
+  double allocations_perevent = 0;
+  double bytes_perevent = 0;
 
-  DFE_NAMEDTUPLE(TimingInfo, identifier, time_total_s, time_perevent_s);
+  DFE_NAMEDTUPLE(TimingInfo, identifier, time_total_s, time_perevent_s,
+                 allocations_perevent, bytes_perevent);
 };
 
 void storeTiming(const std::vector<std::string>& identifiers,
-                 const std::vector<Duration>& durations, std::size_t numEvents,
-                 const std::string& path) {
+                 const std::vector<AlgorithmUsage>& usages,
+                 std::size_t numEvents, const std::string& path) {
   dfe::NamedTupleTsvWriter<TimingInfo> writer(path, 4);
   for (std::size_t i = 0; i < identifiers.size(); ++i) {
     TimingInfo info;
     info.identifier = identifiers[i];
     info.time_total_s =
-        std::chrono::duration_cast<Seconds>(durations[i]).count();
+        std::chrono::duration_cast<Seconds>(usages[i].time).count();
     info.time_perevent_s = info.time_total_s / numEvents;
+    info.allocations_perevent =
+        static_cast<double>(usages[i].allocations.allocations) / numEvents;
+    info.bytes_perevent =
+        static_cast<double>(usages[i].allocations.bytes) / numEvents;
     writer.append(info);
   }
 }
@@ -414,7 +446,7 @@ int Sequencer::run() {
   Timepoint clockWallStart = Clock::now();
   // per-algorithm time measures
   std::vector<std::string> names = listAlgorithmNames();
-  std::vector<Duration> clocksAlgorithms(names.size(), Duration::zero());
+  std::vector<AlgorithmUsage> clocksAlgorithms(names.size());
   tbbWrap::queuing_mutex clocksAlgorithmsMutex;
 
   // processing only works w/ a well-known number of events
@@ -467,11 +499,11 @@ int Sequencer::run() {
     tbbWrap::parallel_for(
         tbb::blocked_range<std::size_t>(eventsRange.first, eventsRange.second),
         [&](const tbb::blocked_range<std::size_t>& r) {
-          std::vector<Duration> localClocksAlgorithms(names.size(),
-                                                      Duration::zero());
+          std::vector<AlgorithmUsage> localClocksAlgorithms(names.size());
 
           for (std::size_t event = r.begin(); event != r.end(); ++event) {
             ACTS_DEBUG("start processing event " << event);
+            Acts::ScopedAllocationCounter eventAllocations;
             m_cfg.iterationCallback();
             // Use per-event store
             WhiteBoard eventStore(
@@ -485,7 +517,7 @@ int Sequencer::run() {
 
             /// Decorate the context
             for (auto& cdr : m_decorators) {
-              StopWatch sw(localClocksAlgorithms[ialgo++]);
+              UsageMeter meter(localClocksAlgorithms[ialgo++]);
               ACTS_VERBOSE("Execute context decorator: " << cdr->name());
               if (cdr->decorate(++context) != ProcessCode::SUCCESS) {
                 throw std::runtime_error("Failed to decorate event context");
@@ -500,7 +532,7 @@ int Sequencer::run() {
                 mon.emplace();
                 context.fpeMonitor = &mon.value();
               }
-              StopWatch sw(localClocksAlgorithms[ialgo++]);
+              UsageMeter meter(localClocksAlgorithms[ialgo++]);
               ACTS_VERBOSE("Execute " << getAlgorithmType(*alg) << ": "
                                       << alg->name());
               if (alg->internalExecute(++context) != ProcessCode::SUCCESS) {
@@ -545,6 +577,9 @@ int Sequencer::run() {
             nProcessedEvents++;
             if (logger().level() <= Acts::Logging::DEBUG) {
               ACTS_DEBUG("finished event " << event);
+              if (Acts::allocationCountingEnabled()) {
+                ACTS_DEBUG("  " << eventAllocations.count());
+              }
             } else if (nTotalEvents <= 100) {
               ACTS_INFO("finished event " << event);
             } else if (nProcessedEvents % 100 == 0) {
@@ -577,16 +612,28 @@ int Sequencer::run() {
 
   // summarize timing
   Duration totalWall = Clock::now() - clockWallStart;
-  Duration totalReal = std::accumulate(
-      clocksAlgorithms.begin(), clocksAlgorithms.end(), Duration::zero());
+  AlgorithmUsage totalUsage = std::accumulate(
+      clocksAlgorithms.begin(), clocksAlgorithms.end(), AlgorithmUsage{},
+      [](AlgorithmUsage lhs, const AlgorithmUsage& rhs) { return lhs += rhs; });
+  Duration totalReal = totalUsage.time;
   std::size_t numEvents = eventsRange.second - eventsRange.first;
   ACTS_INFO("Processed " << numEvents << " events in " << asString(totalWall)
                          << " (wall clock)");
   ACTS_INFO("Average time per event: " << perEvent(totalReal, numEvents));
+  if (Acts::allocationCountingEnabled() && numEvents > 0) {
+    ACTS_INFO("Average allocations per event: "
+              << totalUsage.allocations.allocations / numEvents << " ("
+              << totalUsage.allocations.bytes / numEvents << " bytes)");
+  }
   ACTS_DEBUG("Average time per algorithm:");
   for (std::size_t i = 0; i < names.size(); ++i) {
     ACTS_DEBUG("  " << names[i] << ": "
-                    << perEvent(clocksAlgorithms[i], numEvents));
+                    << perEvent(clocksAlgorithms[i].time, numEvents));
+    if (Acts::allocationCountingEnabled() && numEvents > 0) {
+      ACTS_DEBUG("    "
+                 << clocksAlgorithms[i].allocations.allocations / numEvents
+                 << " allocations/event");
+    }
   }
 
   if (!m_cfg.outputDir.empty()) {
@@ -12,6 +12,7 @@
 #include "Acts/Plugins/Json/DetectorJsonConverter.hpp"
 #include "Acts/Plugins/Json/JsonMaterialDecorator.hpp"
 #include "Acts/Plugins/Json/MaterialMapJsonConverter.hpp"
+#include "Acts/Plugins/Json/MaterialMapJsonReader.hpp"
 #include "Acts/Plugins/Json/ProtoDetectorJsonConverter.hpp"
 #include "Acts/Plugins/Python/Utilities.hpp"
 #include "Acts/Utilities/Logger.hpp"
@@ -19,6 +20,7 @@
 #include "ActsExamples/Io/Json/JsonMaterialWriter.hpp"
 #include "ActsExamples/Io/Json/JsonSurfacesReader.hpp"
 #include "ActsExamples/Io/Json/JsonSurfacesWriter.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
 
 #include <fstream>
 #include <initializer_list>
@@ -57,6 +59,19 @@ void addJson(Context& ctx) {
                       const std::string&, Acts::Logging::Level, bool, bool>(),
              py::arg("rConfig"), py::arg("jFileName"), py::arg("level"),
              py::arg("clearSurfaceMaterial") = true,
+             py::arg("clearVolumeMaterial") = true)
+        .def(py::init([](const std::string& jFileName,
+                         Acts::Logging::Level level, bool lazyDecoding,
+                         bool clearSurfaceMaterial, bool clearVolumeMaterial) {
+               // Decode the volumes with the examples thread pool
+               MaterialMapJsonReader::Config rConfig;
+               rConfig.executor = tbbWrap::parallelForExecutor();
+               return std::make_shared<JsonMaterialDecorator>(
+                   rConfig, jFileName, level, lazyDecoding,
+                   clearSurfaceMaterial, clearVolumeMaterial);
+             }),
+             py::arg("jFileName"), py::arg("level"),
+             py::arg("lazyDecoding"), py::arg("clearSurfaceMaterial") = true,
              py::arg("clearVolumeMaterial") = true);
   }
 
@@ -8,6 +8,7 @@
 
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Material/BinaryMaterialDecorator.hpp"
 #include "Acts/Material/IMaterialDecorator.hpp"
 #include "Acts/Material/SurfaceMaterialMapper.hpp"
 #include "Acts/Material/VolumeMaterialMapper.hpp"
@@ -21,6 +22,7 @@
 #include <array>
 #include <map>
 #include <memory>
+#include <string>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -82,6 +84,16 @@ void addMaterial(Context& ctx) {
     ACTS_PYTHON_STRUCT_END();
   }
 
+  {
+    py::class_<Acts::BinaryMaterialDecorator, Acts::IMaterialDecorator,
+               std::shared_ptr<Acts::BinaryMaterialDecorator>>(
+        m, "BinaryMaterialDecorator")
+        .def(py::init<const std::string&, Acts::Logging::Level, bool, bool>(),
+             py::arg("fileName"), py::arg("level"),
+             py::arg("clearSurfaceMaterial") = true,
+             py::arg("clearVolumeMaterial") = true);
+  }
+
   {
     py::class_<MappingMaterialDecorator, Acts::IMaterialDecorator,
                std::shared_ptr<MappingMaterialDecorator>>(
@@ -118,6 +130,7 @@ void addMaterial(Context& ctx) {
     ACTS_PYTHON_MEMBER(trackingGeometry);
     ACTS_PYTHON_MEMBER(geoContext);
     ACTS_PYTHON_MEMBER(magFieldContext);
+    ACTS_PYTHON_MEMBER(parallelMapping);
     ACTS_PYTHON_STRUCT_END();
   }
 
@@ -43,6 +43,7 @@
 #include "ActsExamples/Io/Root/RootTrackParameterWriter.hpp"
 #include "ActsExamples/Io/Root/RootTrackStatesWriter.hpp"
 #include "ActsExamples/Io/Root/RootTrackSummaryWriter.hpp"
+#include "ActsExamples/MaterialMapping/BinaryMaterialWriter.hpp"
 #include "ActsExamples/MaterialMapping/IMaterialWriter.hpp"
 #include "ActsExamples/Plugins/Obj/ObjPropagationStepsWriter.hpp"
 #include "ActsExamples/Plugins/Obj/ObjTrackingGeometryWriter.hpp"
@@ -268,6 +269,25 @@ void addOutput(Context& ctx) {
   py::class_<IMaterialWriter, std::shared_ptr<IMaterialWriter>>(
       mex, "IMaterialWriter");
 
+  {
+    auto cls =
+        py::class_<BinaryMaterialWriter, IMaterialWriter,
+                   std::shared_ptr<BinaryMaterialWriter>>(
+            mex, "BinaryMaterialWriter")
+            .def(py::init<const BinaryMaterialWriter::Config&,
+                          Acts::Logging::Level>(),
+                 py::arg("config"), py::arg("level"))
+            .def("writeMaterial", &BinaryMaterialWriter::writeMaterial)
+            .def_property_readonly("config", &BinaryMaterialWriter::config);
+
+    auto c = py::class_<BinaryMaterialWriter::Config>(cls, "Config")
+                 .def(py::init<>());
+
+    ACTS_PYTHON_STRUCT_BEGIN(c, BinaryMaterialWriter::Config);
+    ACTS_PYTHON_MEMBER(fileName);
+    ACTS_PYTHON_STRUCT_END();
+  }
+
   {
     using Writer = ActsExamples::RootMaterialWriter;
     auto w = py::class_<Writer, IMaterialWriter, std::shared_ptr<Writer>>(
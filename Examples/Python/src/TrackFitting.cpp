@@ -58,7 +58,8 @@ void addTrackFitting(Context& ctx) {
 
   ACTS_PYTHON_DECLARE_ALGORITHM(ActsExamples::RefittingAlgorithm, mex,
                                 "RefittingAlgorithm", inputTracks, outputTracks,
-                                fit, pickTrack);
+                                fit, pickTrack, linearizedRefit,
+                                refitMaxParameterChange);
 
   {
     py::class_<TrackFitterFunction, std::shared_ptr<TrackFitterFunction>>(
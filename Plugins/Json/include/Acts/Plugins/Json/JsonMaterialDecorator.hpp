@@ -13,6 +13,7 @@
 #include "Acts/Material/ISurfaceMaterial.hpp"
 #include "Acts/Material/IVolumeMaterial.hpp"
 #include "Acts/Plugins/Json/MaterialMapJsonConverter.hpp"
+#include "Acts/Plugins/Json/MaterialMapJsonReader.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 
 #include <fstream>
@@ -41,6 +42,21 @@ class JsonMaterialDecorator : public IMaterialDecorator {
                         bool clearSurfaceMaterial = true,
                         bool clearVolumeMaterial = true);
 
+  /// Constructor with the streaming MaterialMapJsonReader
+  ///
+  /// @param rConfig is the configuration of the reader
+  /// @param jFileName is the input file in JSON, CBOR or MessagePack encoding
+  /// @param level is the output logging level
+  /// @param lazyDecoding decodes the material of a volume only once the first
+  ///        surface or volume belonging to it is decorated
+  /// @param clearSurfaceMaterial clears the material of all surfaces
+  /// @param clearVolumeMaterial clears the material of all volumes
+  JsonMaterialDecorator(const MaterialMapJsonReader::Config& rConfig,
+                        const std::string& jFileName,
+                        Acts::Logging::Level level, bool lazyDecoding,
+                        bool clearSurfaceMaterial = true,
+                        bool clearVolumeMaterial = true);
+
   /// Decorate a surface
   ///
   /// @param surface the non-cost surface that is decorated
@@ -55,6 +71,8 @@ class JsonMaterialDecorator : public IMaterialDecorator {
   MaterialMapJsonConverter::Config m_readerConfig;
   SurfaceMaterialMap m_surfaceMaterialMap;
   VolumeMaterialMap m_volumeMaterialMap;
+  // Serves the material in the lazy decoding mode instead of the maps
+  std::unique_ptr<const MaterialMapJsonReader> m_lazyReader;
 
   bool m_clearSurfaceMaterial{true};
   bool m_clearVolumeMaterial{true};
@@ -0,0 +1,137 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Material/ISurfaceMaterial.hpp"
+#include "Acts/Material/IVolumeMaterial.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Acts {
+
+/// @brief Streaming reader for material maps written by the
+/// MaterialMapJsonConverter
+///
+/// The input is parsed entry by entry, so the document is never held as a
+/// whole. The material of every entry is kept in the compact CBOR encoding,
+/// grouped by volume, until it is decoded: either all at once with the
+/// volumes decoded in parallel, or on demand, one volume at a time.
+class MaterialMapJsonReader {
+ public:
+  using SurfaceMaterialMap =
+      std::map<GeometryIdentifier, std::shared_ptr<const ISurfaceMaterial>>;
+  using VolumeMaterialMap =
+      std::map<GeometryIdentifier, std::shared_ptr<const IVolumeMaterial>>;
+  using DetectorMaterialMaps = std::pair<SurfaceMaterialMap, VolumeMaterialMap>;
+
+  /// The supported encodings of the nlohmann::json document
+  enum class Encoding { Json, Cbor, MessagePack };
+
+  struct Config {
+    /// Executor to decode the volumes in parallel, serial if empty
+    ParallelForExecutor executor;
+  };
+
+  /// Read the material maps from a file
+  ///
+  /// @param config is the reader configuration
+  /// @param fileName is the input file, the encoding is deduced from its
+  ///        extension (.cbor, .msgpack, anything else is JSON)
+  /// @param level is the output logging level
+  MaterialMapJsonReader(const Config& config, const std::string& fileName,
+                        Acts::Logging::Level level);
+
+  /// Read the material maps from a stream
+  ///
+  /// @param config is the reader configuration
+  /// @param input is the input stream, binary encodings need binary mode
+  /// @param encoding is the encoding of the input
+  /// @param level is the output logging level
+  MaterialMapJsonReader(const Config& config, std::istream& input,
+                        Encoding encoding, Acts::Logging::Level level);
+
+  ~MaterialMapJsonReader();
+
+  /// Deduce the encoding from a file name
+  static Encoding encodingFromFileName(const std::string& fileName);
+
+  /// Decode the material of all volumes
+  ///
+  /// The volumes which are not decoded yet are decoded in parallel.
+  DetectorMaterialMaps materialMaps() const;
+
+  /// Material of a surface, decoding the volume of the surface if needed
+  ///
+  /// @param geoId is the identifier of the surface
+  ///
+  /// @return the material or nullptr if the surface has none
+  std::shared_ptr<const ISurfaceMaterial> surfaceMaterial(
+      const GeometryIdentifier& geoId) const;
+
+  /// Material of a volume, decoding the volume if needed
+  ///
+  /// @param geoId is the identifier of the volume
+  ///
+  /// @return the material or nullptr if the volume has none
+  std::shared_ptr<const IVolumeMaterial> volumeMaterial(
+      const GeometryIdentifier& geoId) const;
+
+  /// Number of volumes which have been decoded so far
+  std::size_t decodedVolumes() const;
+
+ private:
+  /// Encoded material entry
+  using Entry = std::pair<GeometryIdentifier, std::vector<std::uint8_t>>;
+
+  /// Material of all surfaces and volumes sharing a volume identifier
+  struct VolumeBlock {
+    std::vector<Entry> encodedSurfaces;
+    std::vector<Entry> encodedVolumes;
+    // The decoded material, only valid after the block has been decoded
+    SurfaceMaterialMap surfaceMaterial;
+    VolumeMaterialMap volumeMaterial;
+    std::once_flag decodeFlag;
+  };
+
+  class Handler;
+
+  void read(std::istream& input, Encoding encoding);
+
+  /// Store an encoded entry in the block of its volume
+  void addEntry(bool isSurface, const GeometryIdentifier& geoId,
+                std::vector<std::uint8_t> encoded);
+
+  /// Decodes the block once, the encoded entries are released afterwards
+  void decode(VolumeBlock& block) const;
+
+  VolumeBlock* findBlock(const GeometryIdentifier& geoId) const;
+
+  Config m_cfg;
+
+  std::map<GeometryIdentifier::Value, std::unique_ptr<VolumeBlock>> m_blocks;
+
+  mutable std::atomic<std::size_t> m_nDecoded{0};
+
+  std::unique_ptr<const Logger> m_logger;
+
+  const Logger& logger() const { return *m_logger; }
+};
+
+}  // namespace Acts
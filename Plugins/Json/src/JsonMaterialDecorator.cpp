@@ -51,6 +51,25 @@ JsonMaterialDecorator::JsonMaterialDecorator(
   ACTS_VERBOSE("JSON material description read complete");
 }
 
+JsonMaterialDecorator::JsonMaterialDecorator(
+    const MaterialMapJsonReader::Config& rConfig, const std::string& jFileName,
+    Acts::Logging::Level level, bool lazyDecoding, bool clearSurfaceMaterial,
+    bool clearVolumeMaterial)
+    : m_clearSurfaceMaterial(clearSurfaceMaterial),
+      m_clearVolumeMaterial(clearVolumeMaterial),
+      m_logger{getDefaultLogger("JsonMaterialDecorator", level)} {
+  auto reader =
+      std::make_unique<MaterialMapJsonReader>(rConfig, jFileName, level);
+  if (lazyDecoding) {
+    m_lazyReader = std::move(reader);
+    return;
+  }
+  auto maps = reader->materialMaps();
+  m_surfaceMaterialMap = std::move(maps.first);
+  m_volumeMaterialMap = std::move(maps.second);
+  ACTS_VERBOSE("Material description read complete");
+}
+
 void JsonMaterialDecorator::decorate(Surface& surface) const {
   ACTS_VERBOSE("Processing surface: " << surface.geometryId());
   // Clear the material if registered to do so
@@ -58,6 +77,13 @@ void JsonMaterialDecorator::decorate(Surface& surface) const {
     ACTS_VERBOSE("-> Clearing surface material");
     surface.assignSurfaceMaterial(nullptr);
   }
+  if (m_lazyReader) {
+    if (auto material = m_lazyReader->surfaceMaterial(surface.geometryId())) {
+      ACTS_VERBOSE("-> Found material for surface, assigning");
+      surface.assignSurfaceMaterial(std::move(material));
+    }
+    return;
+  }
   // Try to find the surface in the map
   auto sMaterial = m_surfaceMaterialMap.find(surface.geometryId());
   if (sMaterial != m_surfaceMaterialMap.end()) {
@@ -76,6 +102,13 @@ void JsonMaterialDecorator::decorate(TrackingVolume& volume) const {
     ACTS_VERBOSE("-> Clearing volume material");
     volume.assignVolumeMaterial(nullptr);
   }
+  if (m_lazyReader) {
+    if (auto material = m_lazyReader->volumeMaterial(volume.geometryId())) {
+      ACTS_VERBOSE("-> Found material for volume, assigning");
+      volume.assignVolumeMaterial(std::move(material));
+    }
+    return;
+  }
   // Try to find the volume in the map
   auto vMaterial = m_volumeMaterialMap.find(volume.geometryId());
   if (vMaterial != m_volumeMaterialMap.end()) {
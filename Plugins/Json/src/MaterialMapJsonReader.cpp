@@ -0,0 +1,397 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Plugins/Json/MaterialMapJsonReader.hpp"
+
+#include "Acts/Plugins/Json/GeometryHierarchyMapJsonConverter.hpp"
+#include "Acts/Plugins/Json/MaterialJsonConverter.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+#include <nlohmann/json.hpp>
+
+namespace {
+
+// Keys and values of the hierarchy maps written by the
+// MaterialMapJsonConverter
+constexpr const char* kVolumesKey = "Volumes";
+constexpr const char* kSurfacesKey = "Surfaces";
+constexpr const char* kHeaderKey = "acts-geometry-hierarchy-map";
+constexpr const char* kEntriesKey = "entries";
+constexpr const char* kVolumeIdentifier = "Material Volume Map";
+constexpr const char* kSurfaceIdentifier = "Material Surface Map";
+constexpr int kFormatVersion = 0;
+
+using IdentifierConverter =
+    Acts::GeometryHierarchyMapJsonConverter<const Acts::ISurfaceMaterial*>;
+
+}  // namespace
+
+/// SAX handler which builds a document for one entry at a time and hands
+/// the encoded entries over to the reader.
+class Acts::MaterialMapJsonReader::Handler {
+ public:
+  using json = nlohmann::json;
+
+  explicit Handler(MaterialMapJsonReader& reader) : m_reader(reader) {}
+
+  bool null() { return value(nullptr); }
+  bool boolean(bool val) { return value(val); }
+  bool number_integer(json::number_integer_t val) { return value(val); }
+  bool number_unsigned(json::number_unsigned_t val) { return value(val); }
+  bool number_float(json::number_float_t val, const json::string_t& /*s*/) {
+    return value(val);
+  }
+  bool string(json::string_t& val) { return value(std::move(val)); }
+  bool binary(json::binary_t& val) {
+    return value(json::binary(std::move(val)));
+  }
+
+  bool start_object(std::size_t /*size*/) {
+    if (!m_stack.empty()) {
+      m_stack.push_back(add(json::object()));
+      return true;
+    }
+    switch (m_depth) {
+      case 0:
+        ++m_depth;
+        return true;
+      case 1:
+        if (m_section == kVolumesKey || m_section == kSurfacesKey) {
+          m_headerSeen = false;
+          m_sectionKey.clear();
+          ++m_depth;
+          return true;
+        }
+        return capture(Kind::Skip, json::object());
+      case 2:
+        return capture(m_sectionKey == kHeaderKey ? Kind::Header : Kind::Skip,
+                       json::object());
+      default:
+        return capture(Kind::Entry, json::object());
+    }
+  }
+
+  bool start_array(std::size_t /*size*/) {
+    if (!m_stack.empty()) {
+      m_stack.push_back(add(json::array()));
+      return true;
+    }
+    if (m_depth == 2 && m_sectionKey == kEntriesKey) {
+      ++m_depth;
+      return true;
+    }
+    if (m_depth == 0 || m_depth == 3) {
+      throw std::invalid_argument("Invalid json material map structure");
+    }
+    return capture(Kind::Skip, json::array());
+  }
+
+  bool key(json::string_t& val) {
+    if (!m_stack.empty()) {
+      m_element = &(*m_stack.back())[val];
+    } else if (m_depth == 1) {
+      m_section = val;
+    } else {
+      m_sectionKey = val;
+    }
+    return true;
+  }
+
+  bool end_object() {
+    if (!m_stack.empty()) {
+      return end();
+    }
+    if (m_depth == 2) {
+      if (!m_headerSeen) {
+        throw std::invalid_argument(
+            "Missing header entry in json geometry hierarchy map");
+      }
+      m_sectionsSeen.push_back(m_section);
+    }
+    --m_depth;
+    return true;
+  }
+
+  bool end_array() {
+    if (!m_stack.empty()) {
+      return end();
+    }
+    --m_depth;
+    return true;
+  }
+
+  bool parse_error(std::size_t position, const std::string& /*token*/,
+                   const nlohmann::detail::exception& ex) {
+    throw std::runtime_error("Unable to parse material map at byte " +
+                             std::to_string(position) + ": " + ex.what());
+  }
+
+  /// Check that both material sections have been read
+  void checkComplete() const {
+    for (const char* section : {kVolumesKey, kSurfacesKey}) {
+      if (std::find(m_sectionsSeen.begin(), m_sectionsSeen.end(), section) ==
+          m_sectionsSeen.end()) {
+        throw std::invalid_argument(
+            "Missing header entry in json geometry hierarchy map");
+      }
+    }
+  }
+
+ private:
+  enum class Kind { Entry, Header, Skip };
+
+  /// Scalar value, which is ignored outside of a captured document
+  template <typename value_t>
+  bool value(value_t&& val) {
+    if (!m_stack.empty()) {
+      add(json(std::forward<value_t>(val)));
+    } else if (m_depth == 0 || m_depth == 3) {
+      throw std::invalid_argument("Invalid json material map structure");
+    }
+    return true;
+  }
+
+  json* add(json&& val) {
+    json* parent = m_stack.back();
+    if (parent->is_array()) {
+      parent->push_back(std::move(val));
+      return &parent->back();
+    }
+    *m_element = std::move(val);
+    return m_element;
+  }
+
+  bool capture(Kind kind, json&& container) {
+    m_kind = kind;
+    m_document = std::move(container);
+    m_stack.push_back(&m_document);
+    return true;
+  }
+
+  bool end() {
+    m_stack.pop_back();
+    if (!m_stack.empty()) {
+      return true;
+    }
+    if (m_kind == Kind::Header) {
+      checkHeader();
+    } else if (m_kind == Kind::Entry) {
+      auto valueIt = m_document.find("value");
+      if (valueIt == m_document.end()) {
+        throw std::invalid_argument("Missing value in json material map entry");
+      }
+      m_reader.addEntry(m_section == kSurfacesKey,
+                        IdentifierConverter::decodeIdentifier(m_document),
+                        json::to_cbor(*valueIt));
+    }
+    m_document = json();
+    return true;
+  }
+
+  void checkHeader() {
+    if (m_document.at("format-version").get<int>() != kFormatVersion) {
+      throw std::invalid_argument(
+          "Invalid format version in json geometry hierarchy map");
+    }
+    std::string identifier =
+        m_section == kSurfacesKey ? kSurfaceIdentifier : kVolumeIdentifier;
+    if (m_document.at("value-identifier").get<std::string>() != identifier) {
+      throw std::invalid_argument(
+          "Inconsistent value identifier in Json geometry hierarchy map");
+    }
+    m_headerSeen = true;
+  }
+
+  MaterialMapJsonReader& m_reader;
+
+  // Position outside of the captured documents
+  std::size_t m_depth = 0;
+  std::string m_section;
+  std::string m_sectionKey;
+  bool m_headerSeen = false;
+  std::vector<std::string> m_sectionsSeen;
+
+  // The captured document and the path to the current container
+  Kind m_kind = Kind::Skip;
+  json m_document;
+  std::vector<json*> m_stack;
+  json* m_element = nullptr;
+};
+
+Acts::MaterialMapJsonReader::MaterialMapJsonReader(const Config& config,
+                                                   const std::string& fileName,
+                                                   Acts::Logging::Level level)
+    : m_cfg(config),
+      m_logger{getDefaultLogger("MaterialMapJsonReader", level)} {
+  Encoding encoding = encodingFromFileName(fileName);
+  std::ifstream input(fileName, encoding == Encoding::Json
+                                    ? std::ios::in
+                                    : std::ios::in | std::ios::binary);
+  if (!input.good()) {
+    throw std::runtime_error{"Unable to open input material file: " +
+                             fileName};
+  }
+  ACTS_VERBOSE("Reading material description from: " << fileName);
+  read(input, encoding);
+}
+
+Acts::MaterialMapJsonReader::MaterialMapJsonReader(const Config& config,
+                                                   std::istream& input,
+                                                   Encoding encoding,
+                                                   Acts::Logging::Level level)
+    : m_cfg(config),
+      m_logger{getDefaultLogger("MaterialMapJsonReader", level)} {
+  read(input, encoding);
+}
+
+Acts::MaterialMapJsonReader::~MaterialMapJsonReader() = default;
+
+Acts::MaterialMapJsonReader::Encoding
+Acts::MaterialMapJsonReader::encodingFromFileName(const std::string& fileName) {
+  std::string extension = std::filesystem::path(fileName).extension();
+  if (extension == ".cbor") {
+    return Encoding::Cbor;
+  }
+  if (extension == ".msgpack") {
+    return Encoding::MessagePack;
+  }
+  return Encoding::Json;
+}
+
+void Acts::MaterialMapJsonReader::read(std::istream& input,
+                                       Encoding encoding) {
+  using json = nlohmann::json;
+  json::input_format_t format = json::input_format_t::json;
+  if (encoding == Encoding::Cbor) {
+    format = json::input_format_t::cbor;
+  } else if (encoding == Encoding::MessagePack) {
+    format = json::input_format_t::msgpack;
+  }
+
+  Handler handler(*this);
+  json::sax_parse(input, &handler, format);
+  handler.checkComplete();
+
+  std::size_t nSurfaces = 0;
+  std::size_t nVolumes = 0;
+  auto byIdentifier = [](const Entry& a, const Entry& b) {
+    return a.first < b.first;
+  };
+  auto sameIdentifier = [](const Entry& a, const Entry& b) {
+    return a.first == b.first;
+  };
+  for (auto& [volume, block] : m_blocks) {
+    for (auto* entries : {&block->encodedSurfaces, &block->encodedVolumes}) {
+      std::sort(entries->begin(), entries->end(), byIdentifier);
+      if (std::adjacent_find(entries->begin(), entries->end(),
+                             sameIdentifier) != entries->end()) {
+        throw std::invalid_argument("Input elements contain duplicates");
+      }
+    }
+    nSurfaces += block->encodedSurfaces.size();
+    nVolumes += block->encodedVolumes.size();
+  }
+  ACTS_VERBOSE("Read " << nSurfaces << " surface and " << nVolumes
+                       << " volume entries in " << m_blocks.size()
+                       << " volumes");
+}
+
+void Acts::MaterialMapJsonReader::addEntry(bool isSurface,
+                                           const GeometryIdentifier& geoId,
+                                           std::vector<std::uint8_t> encoded) {
+  auto& block = m_blocks[geoId.volume()];
+  if (!block) {
+    block = std::make_unique<VolumeBlock>();
+  }
+  (isSurface ? block->encodedSurfaces : block->encodedVolumes)
+      .emplace_back(geoId, std::move(encoded));
+}
+
+void Acts::MaterialMapJsonReader::decode(VolumeBlock& block) const {
+  std::call_once(block.decodeFlag, [&]() {
+    for (const auto& [geoId, encoded] : block.encodedSurfaces) {
+      auto material =
+          nlohmann::json::from_cbor(encoded).get<const ISurfaceMaterial*>();
+      block.surfaceMaterial.emplace(
+          geoId, std::shared_ptr<const ISurfaceMaterial>(material));
+    }
+    for (const auto& [geoId, encoded] : block.encodedVolumes) {
+      auto material =
+          nlohmann::json::from_cbor(encoded).get<const IVolumeMaterial*>();
+      block.volumeMaterial.emplace(
+          geoId, std::shared_ptr<const IVolumeMaterial>(material));
+    }
+    // Release the memory of the encoded material
+    std::vector<Entry>().swap(block.encodedSurfaces);
+    std::vector<Entry>().swap(block.encodedVolumes);
+    ++m_nDecoded;
+  });
+}
+
+Acts::MaterialMapJsonReader::VolumeBlock*
+Acts::MaterialMapJsonReader::findBlock(const GeometryIdentifier& geoId) const {
+  auto block = m_blocks.find(geoId.volume());
+  return block != m_blocks.end() ? block->second.get() : nullptr;
+}
+
+Acts::MaterialMapJsonReader::DetectorMaterialMaps
+Acts::MaterialMapJsonReader::materialMaps() const {
+  std::vector<VolumeBlock*> blocks;
+  blocks.reserve(m_blocks.size());
+  for (const auto& [volume, block] : m_blocks) {
+    blocks.push_back(block.get());
+  }
+  parallelFor(m_cfg.executor, blocks.size(),
+              [&](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) {
+                  decode(*blocks[i]);
+                }
+              });
+
+  DetectorMaterialMaps maps;
+  for (const VolumeBlock* block : blocks) {
+    maps.first.insert(block->surfaceMaterial.begin(),
+                      block->surfaceMaterial.end());
+    maps.second.insert(block->volumeMaterial.begin(),
+                       block->volumeMaterial.end());
+  }
+  return maps;
+}
+
+std::shared_ptr<const Acts::ISurfaceMaterial>
+Acts::MaterialMapJsonReader::surfaceMaterial(
+    const GeometryIdentifier& geoId) const {
+  VolumeBlock* block = findBlock(geoId);
+  if (block == nullptr) {
+    return nullptr;
+  }
+  decode(*block);
+  auto material = block->surfaceMaterial.find(geoId);
+  return material != block->surfaceMaterial.end() ? material->second
+                                                   : nullptr;
+}
+
+std::shared_ptr<const Acts::IVolumeMaterial>
+Acts::MaterialMapJsonReader::volumeMaterial(
+    const GeometryIdentifier& geoId) const {
+  VolumeBlock* block = findBlock(geoId);
+  if (block == nullptr) {
+    return nullptr;
+  }
+  decode(*block);
+  auto material = block->volumeMaterial.find(geoId);
+  return material != block->volumeMaterial.end() ? material->second : nullptr;
+}
+
+std::size_t Acts::MaterialMapJsonReader::decodedVolumes() const {
+  return m_nDecoded;
+}
@@ -542,6 +542,31 @@ class MutablePodioTrackStateContainer final
     }
   }
 
+  void addTrackStateComponents_impl(TrackIndexType istate,
+                                    TrackStatePropMask mask) {
+    auto& data = m_collection->at(istate).data();
+    if (ACTS_CHECK_BIT(mask, TrackStatePropMask::Predicted) &&
+        data.ipredicted == kInvalid) {
+      m_params->create();
+      data.ipredicted = m_params->size() - 1;
+    }
+    if (ACTS_CHECK_BIT(mask, TrackStatePropMask::Filtered) &&
+        data.ifiltered == kInvalid) {
+      m_params->create();
+      data.ifiltered = m_params->size() - 1;
+    }
+    if (ACTS_CHECK_BIT(mask, TrackStatePropMask::Smoothed) &&
+        data.ismoothed == kInvalid) {
+      m_params->create();
+      data.ismoothed = m_params->size() - 1;
+    }
+    if (ACTS_CHECK_BIT(mask, TrackStatePropMask::Jacobian) &&
+        data.ijacobian == kInvalid) {
+      m_jacs->create();
+      data.ijacobian = m_jacs->size() - 1;
+    }
+  }
+
   void clear_impl() {
     m_collection->clear();
     m_params->clear();
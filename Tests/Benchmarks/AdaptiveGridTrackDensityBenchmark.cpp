@@ -0,0 +1,146 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Vertexing/AdaptiveGridTrackDensity.hpp"
+
+#include <cmath>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/functional/hash.hpp>
+
+using namespace Acts;
+using namespace Acts::UnitLiterals;
+
+namespace {
+
+/// Tracks from a number of vertices spread along the beam line
+std::vector<BoundTrackParameters> makeTracks(std::size_t nVertices,
+                                             std::size_t nTracksPerVertex) {
+  std::mt19937 rng(31415);
+  std::normal_distribution<double> vertexZ(0., 50_mm);
+  std::normal_distribution<double> resolution(0., 1.);
+  std::uniform_real_distribution<double> sigmaD(10_um, 100_um);
+
+  auto perigee = Surface::makeShared<PerigeeSurface>(Vector3::Zero());
+  std::vector<BoundTrackParameters> tracks;
+  tracks.reserve(nVertices * nTracksPerVertex);
+  for (std::size_t iv = 0; iv < nVertices; ++iv) {
+    double z = vertexZ(rng);
+    for (std::size_t it = 0; it < nTracksPerVertex; ++it) {
+      double sigma = sigmaD(rng);
+      BoundVector params = BoundVector::Zero();
+      params[eBoundLoc0] = sigma * resolution(rng);
+      params[eBoundLoc1] = z + 2. * sigma * resolution(rng);
+      params[eBoundTheta] = M_PI_2;
+      params[eBoundQOverP] = 1_e / 1_GeV;
+      BoundSquareMatrix cov = BoundSquareMatrix::Identity();
+      cov(eBoundLoc0, eBoundLoc0) = sigma * sigma;
+      cov(eBoundLoc1, eBoundLoc1) = 4. * sigma * sigma;
+      cov(eBoundLoc0, eBoundLoc1) = cov(eBoundLoc1, eBoundLoc0) =
+          0.5 * sigma * sigma;
+      tracks.emplace_back(perigee, params, cov, ParticleHypothesis::pion());
+    }
+  }
+  return tracks;
+}
+
+/// Iterative seeding as in the AdaptiveGridDensityVertexFinder: fill the
+/// density once, then repeatedly find the maximum and remove the tracks that
+/// are compatible with it.
+template <typename grid_density_t>
+float findSeeds(const grid_density_t& gridDensity,
+                const std::vector<BoundTrackParameters>& tracks,
+                std::size_t nSeeds) {
+  typename grid_density_t::DensityMap mainDensityMap;
+  std::vector<typename grid_density_t::DensityMap> trackDensities;
+  trackDensities.reserve(tracks.size());
+  for (const auto& track : tracks) {
+    trackDensities.push_back(gridDensity.addTrack(track, mainDensityMap));
+  }
+
+  std::vector<bool> removed(tracks.size(), false);
+  float zSum = 0;
+  for (std::size_t is = 0; is < nSeeds; ++is) {
+    auto maxRes = gridDensity.getMaxZTPositionAndWidth(mainDensityMap);
+    if (!maxRes.ok()) {
+      break;
+    }
+    float z = maxRes->first.first;
+    zSum += z;
+    for (std::size_t it = 0; it < tracks.size(); ++it) {
+      if (!removed[it] &&
+          std::abs(tracks[it].parameters()[eBoundLoc1] - z) < 1_mm) {
+        gridDensity.subtractTrack(trackDensities[it], mainDensityMap);
+        removed[it] = true;
+      }
+    }
+  }
+  return zSum;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  std::size_t iterations = 3;
+  std::size_t runs = 10;
+  std::size_t nVertices = 200;
+  if (argc >= 2) {
+    iterations = std::stoi(argv[1]);
+  }
+  if (argc >= 3) {
+    runs = std::stoi(argv[2]);
+  }
+  if (argc >= 4) {
+    nVertices = std::stoi(argv[3]);
+  }
+
+  ACTS_LOCAL_LOGGER(
+      getDefaultLogger("AdaptiveGridTrackDensity", Acts::Logging::INFO));
+
+  constexpr int spatialTrkGridSize = 55;
+  using HashDensityMap = std::unordered_map<std::pair<int, int>, float,
+                                            boost::hash<std::pair<int, int>>>;
+  using SparseGridDensity = AdaptiveGridTrackDensity<spatialTrkGridSize>;
+  using HashGridDensity =
+      AdaptiveGridTrackDensity<spatialTrkGridSize, 1, HashDensityMap>;
+
+  const float binExtent = 5_um;
+  SparseGridDensity sparseDensity(SparseGridDensity::Config{binExtent});
+  HashGridDensity hashDensity(HashGridDensity::Config{binExtent});
+
+  auto tracks = makeTracks(nVertices, 50);
+  ACTS_INFO("Seeding " << nVertices << " vertices from " << tracks.size()
+                       << " tracks");
+
+  // Both storages have to find the same seeds
+  float sparseResult = findSeeds(sparseDensity, tracks, nVertices);
+  float hashResult = findSeeds(hashDensity, tracks, nVertices);
+  if (sparseResult != hashResult) {
+    ACTS_ERROR("Seeds differ: " << sparseResult << " != " << hashResult);
+    return 1;
+  }
+
+  const auto sparseBenchmark = Acts::Test::microBenchmark(
+      [&] { return findSeeds(sparseDensity, tracks, nVertices); }, iterations,
+      runs);
+  ACTS_INFO("Sorted vector density map: " << sparseBenchmark);
+
+  const auto hashBenchmark = Acts::Test::microBenchmark(
+      [&] { return findSeeds(hashDensity, tracks, nVertices); }, iterations,
+      runs);
+  ACTS_INFO("Hash map density map: " << hashBenchmark);
+}
@@ -0,0 +1,16 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Install the counting global allocation functions in the benchmark
+// executable, so that the allocations are reported regardless of the
+// library configuration. With ACTS_ENABLE_ALLOCATION_COUNTING they are
+// already provided by ActsCore.
+
+#if !defined(ACTS_ENABLE_ALLOCATION_COUNTING)
+#include "Acts/Utilities/detail/CountingAllocationOperators.hpp"
+#endif
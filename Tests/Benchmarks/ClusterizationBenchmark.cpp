@@ -0,0 +1,119 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Clusterization/Clusterization.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Acts;
+
+namespace {
+
+struct Cell {
+  Cell(int rowv, int colv) : row(rowv), col(colv) {}
+  int row;
+  int col;
+  Ccl::Label label{Ccl::NO_LABEL};
+};
+
+int getCellRow(const Cell& cell) {
+  return cell.row;
+}
+
+int getCellColumn(const Cell& cell) {
+  return cell.col;
+}
+
+Ccl::Label& getCellLabel(Cell& cell) {
+  return cell.label;
+}
+
+struct Cluster {
+  std::size_t nCells = 0;
+};
+
+void clusterAddCell(Cluster& cl, const Cell& /*cell*/) {
+  ++cl.nCells;
+}
+
+/// Pixel module with a fraction of randomly fired cells, sorted column-wise
+std::vector<Cell> makeModule(std::mt19937& rng, int nRows, int nColumns,
+                             double occupancy) {
+  std::bernoulli_distribution fired(occupancy);
+  std::vector<Cell> cells;
+  for (int col = 0; col < nColumns; ++col) {
+    for (int row = 0; row < nRows; ++row) {
+      if (fired(rng)) {
+        cells.emplace_back(row, col);
+      }
+    }
+  }
+  return cells;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  std::size_t iterations = 100;
+  std::size_t runs = 20;
+  double occupancy = 0.05;
+  if (argc >= 2) {
+    iterations = std::stoi(argv[1]);
+  }
+  if (argc >= 3) {
+    runs = std::stoi(argv[2]);
+  }
+  if (argc >= 4) {
+    occupancy = std::stod(argv[3]);
+  }
+
+  ACTS_LOCAL_LOGGER(getDefaultLogger("Clusterization", Acts::Logging::INFO));
+
+  using CellC = std::vector<Cell>;
+  using ClusterC = std::vector<Cluster>;
+
+  std::mt19937 rng(1234);
+  const CellC module = makeModule(rng, 336, 160, occupancy);
+  ACTS_INFO("Clustering " << module.size() << " cells with occupancy "
+                          << occupancy);
+
+  // Both engines have to find the same number of clusters
+  CellC cells = module;
+  std::size_t nHoshenKopelman =
+      Ccl::createClusters<CellC, ClusterC>(cells).size();
+  cells = module;
+  Ccl::labelSortedClusters<CellC>(cells);
+  std::size_t nSorted = Ccl::mergeClusters<CellC, ClusterC>(cells).size();
+  if (nHoshenKopelman != nSorted) {
+    ACTS_ERROR("Clusters differ: " << nHoshenKopelman << " != " << nSorted);
+    return 1;
+  }
+
+  const auto hkBenchmark = Acts::Test::microBenchmark(
+      [&] {
+        CellC copy = module;
+        Ccl::labelClusters<CellC>(copy);
+        return copy;
+      },
+      iterations, runs);
+  ACTS_INFO("Hoshen-Kopelman labelling: " << hkBenchmark);
+
+  const auto sortedBenchmark = Acts::Test::microBenchmark(
+      [&] {
+        CellC copy = module;
+        Ccl::labelSortedClusters<CellC>(copy);
+        return copy;
+      },
+      iterations, runs);
+  ACTS_INFO("Sorted run labelling: " << sortedBenchmark);
+}
@@ -0,0 +1,284 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/ParticleHypothesis.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/EventData/detail/TestSourceLink.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+#include "Acts/Tests/CommonHelpers/MeasurementsCreator.hpp"
+#include "Acts/Utilities/AllocationCounter.hpp"
+#include "Acts/Utilities/CalibrationContext.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <memory>
+#include <ostream>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Acts {
+namespace Test {
+
+// === EVENT GENERATION ===
+
+/// Cylindrical test detector together with everything needed to simulate
+/// measurements on it.
+struct BenchmarkDetector {
+  using SimPropagator = Acts::Propagator<Acts::EigenStepper<>, Acts::Navigator>;
+
+  Acts::GeometryContext geoCtx;
+  Acts::MagneticFieldContext magCtx;
+  Acts::CalibrationContext calCtx;
+
+  CylindricalTrackingGeometry store{geoCtx};
+  std::shared_ptr<const Acts::TrackingGeometry> geometry = store();
+
+  Acts::detail::Test::TestSourceLink::SurfaceAccessor surfaceAccessor{
+      *geometry};
+
+  double bz = 2 * UnitConstants::T;
+  std::shared_ptr<const Acts::ConstantBField> field =
+      std::make_shared<Acts::ConstantBField>(Acts::Vector3(0., 0., bz));
+
+  // all sensitive modules of the detector are pixels
+  MeasurementResolutionMap resolutions = {
+      {Acts::GeometryIdentifier(),
+       {MeasurementType::eLoc01,
+        {25 * UnitConstants::um, 50 * UnitConstants::um}}},
+  };
+
+  /// Construct a propagator that uses the detector field and navigator.
+  SimPropagator makePropagator() const {
+    Acts::Navigator::Config cfg{geometry};
+    cfg.resolvePassive = false;
+    cfg.resolveMaterial = true;
+    cfg.resolveSensitive = true;
+    return SimPropagator(Acts::EigenStepper<>(field),
+                         Acts::Navigator(std::move(cfg)));
+  }
+};
+
+/// Configuration of the generated events.
+struct BenchmarkEventConfig {
+  /// Number of pileup vertices in addition to the hard-scatter vertex
+  std::size_t pileup = 0;
+  /// Number of charged particles per vertex
+  std::size_t tracksPerVertex = 10;
+  /// Longitudinal and transverse spread of the vertices
+  double sigmaZ = 50 * UnitConstants::mm;
+  double sigmaT = 10 * UnitConstants::um;
+  /// Kinematic range of the generated particles
+  double ptMin = 1 * UnitConstants::GeV;
+  double ptMax = 10 * UnitConstants::GeV;
+  double etaMax = 1.;
+  /// Random seed; different pileup levels use different derived seeds
+  std::uint64_t seed = 42;
+};
+
+/// A simulated particle and its measurements.
+struct BenchmarkTrack {
+  /// Vertex index the particle originates from
+  std::size_t vertex = 0;
+  /// True parameters at the production vertex
+  Acts::CurvilinearTrackParameters truth;
+  /// Smeared parameters at the production vertex, used to start fits
+  Acts::CurvilinearTrackParameters start;
+  /// Measurements created along the trajectory, ordered along the track
+  std::vector<Acts::detail::Test::TestSourceLink> sourceLinks;
+};
+
+/// A full generated event.
+struct BenchmarkEvent {
+  std::vector<Acts::Vector4> vertices;
+  std::vector<BenchmarkTrack> tracks;
+  /// All measurements of the event keyed by the module they are on
+  std::unordered_multimap<Acts::GeometryIdentifier,
+                          Acts::detail::Test::TestSourceLink>
+      measurements;
+
+  std::size_t numMeasurements() const { return measurements.size(); }
+};
+
+/// Covariance used for all generated start parameters.
+inline Acts::BoundSquareMatrix benchmarkStartCovariance() {
+  Acts::BoundVector stddev;
+  stddev[Acts::eBoundLoc0] = 100 * UnitConstants::um;
+  stddev[Acts::eBoundLoc1] = 100 * UnitConstants::um;
+  stddev[Acts::eBoundTime] = 25 * UnitConstants::ns;
+  stddev[Acts::eBoundPhi] = 0.5 * UnitConstants::degree;
+  stddev[Acts::eBoundTheta] = 0.5 * UnitConstants::degree;
+  stddev[Acts::eBoundQOverP] = 0.01 / UnitConstants::GeV;
+  return stddev.cwiseProduct(stddev).asDiagonal();
+}
+
+/// Generate an event with the given configuration.
+///
+/// The generation is fully deterministic for a given configuration, so
+/// benchmark numbers of different builds are comparable.
+inline BenchmarkEvent generateEvent(const BenchmarkDetector& detector,
+                                    const BenchmarkEventConfig& cfg) {
+  std::default_random_engine rng(cfg.seed + 7919 * cfg.pileup);
+  std::normal_distribution<double> normal(0., 1.);
+  std::uniform_real_distribution<double> uniform(0., 1.);
+
+  const auto propagator = detector.makePropagator();
+  const Acts::BoundSquareMatrix cov = benchmarkStartCovariance();
+  const Acts::BoundVector stddev = cov.diagonal().cwiseSqrt();
+
+  BenchmarkEvent event;
+  const std::size_t nVertices = 1 + cfg.pileup;
+  event.vertices.reserve(nVertices);
+  event.tracks.reserve(nVertices * cfg.tracksPerVertex);
+
+  for (std::size_t iv = 0; iv < nVertices; ++iv) {
+    Acts::Vector4 vertex(cfg.sigmaT * normal(rng), cfg.sigmaT * normal(rng),
+                         cfg.sigmaZ * normal(rng), 0.);
+    event.vertices.push_back(vertex);
+
+    for (std::size_t it = 0; it < cfg.tracksPerVertex; ++it) {
+      const double pt = cfg.ptMin + (cfg.ptMax - cfg.ptMin) * uniform(rng);
+      const double eta = cfg.etaMax * (2 * uniform(rng) - 1);
+      const double phi = M_PI * (2 * uniform(rng) - 1);
+      const double theta = 2 * std::atan(std::exp(-eta));
+      const double q = uniform(rng) < 0.5 ? -1. : 1.;
+      const double qOverP = q * std::sin(theta) / pt;
+
+      Acts::CurvilinearTrackParameters truth(
+          vertex, phi, theta, qOverP, cov, Acts::ParticleHypothesis::pion());
+
+      const std::size_t sourceId = event.tracks.size();
+      auto measurements =
+          createMeasurements(propagator, detector.geoCtx, detector.magCtx,
+                             truth, detector.resolutions, rng, sourceId);
+      // skip particles that do not leave enough hits for seeding and fitting
+      if (measurements.sourceLinks.size() < 3) {
+        continue;
+      }
+
+      Acts::Vector4 startPos = vertex;
+      startPos[Acts::ePos0] += stddev[Acts::eBoundLoc0] * normal(rng);
+      startPos[Acts::ePos2] += stddev[Acts::eBoundLoc1] * normal(rng);
+      Acts::CurvilinearTrackParameters start(
+          startPos, phi + stddev[Acts::eBoundPhi] * normal(rng),
+          theta + stddev[Acts::eBoundTheta] * normal(rng),
+          qOverP + stddev[Acts::eBoundQOverP] * normal(rng), cov,
+          Acts::ParticleHypothesis::pion());
+
+      for (const auto& sl : measurements.sourceLinks) {
+        event.measurements.emplace(sl.m_geometryId, sl);
+      }
+      event.tracks.push_back(BenchmarkTrack{
+          iv, std::move(truth), std::move(start),
+          std::move(measurements.sourceLinks)});
+    }
+  }
+
+  return event;
+}
+
+// === REPORTING ===
+
+/// Benchmark result of a single kernel at a single pileup level.
+///
+/// Printed as one JSON object per line so that results of different builds
+/// can be collected and compared by scripts. The allocations are counted by
+/// the operators installed in `BenchmarkAllocations.cpp`, which is part of
+/// every reconstruction benchmark. The fields are only `null` if no counting
+/// operator new is installed in the program.
+struct BenchmarkRecord {
+  std::string kernel;
+  std::size_t pileup = 0;
+  std::size_t events = 0;
+  std::size_t calls = 0;
+  std::size_t failures = 0;
+  std::chrono::duration<double> time{0};
+  AllocationCount allocations;
+
+  double timePerCall() const {
+    return calls == 0 ? 0. : time.count() / static_cast<double>(calls);
+  }
+
+  double callsPerSecond() const {
+    return time.count() == 0 ? 0. : static_cast<double>(calls) / time.count();
+  }
+
+  double allocationsPerCall() const {
+    return calls == 0 ? 0.
+                      : static_cast<double>(allocations.allocations) /
+                            static_cast<double>(calls);
+  }
+
+  double bytesPerCall() const {
+    return calls == 0 ? 0.
+                      : static_cast<double>(allocations.bytes) /
+                            static_cast<double>(calls);
+  }
+
+  friend std::ostream& operator<<(std::ostream& os,
+                                  const BenchmarkRecord& rec) {
+    auto oldPrecision = os.precision();
+    auto oldFlags = os.flags();
+    os << std::setprecision(6) << "{\"kernel\": \"" << rec.kernel
+       << "\", \"pileup\": " << rec.pileup << ", \"events\": " << rec.events
+       << ", \"calls\": " << rec.calls << ", \"failures\": " << rec.failures
+       << ", \"time_s\": " << rec.time.count()
+       << ", \"time_per_call_us\": " << rec.timePerCall() * 1e6
+       << ", \"calls_per_s\": " << rec.callsPerSecond();
+    if (allocationCountingEnabled()) {
+      os << ", \"allocations_per_call\": " << rec.allocationsPerCall()
+         << ", \"bytes_per_call\": " << rec.bytesPerCall();
+    } else {
+      os << ", \"allocations_per_call\": null, \"bytes_per_call\": null";
+    }
+    os << "}";
+    os.precision(oldPrecision);
+    os.flags(oldFlags);
+    return os;
+  }
+};
+
+/// Run a kernel and accumulate its timing and allocations into a record.
+///
+/// @param record The record to accumulate into
+/// @param calls Number of kernel invocations performed by @p kernel
+/// @param kernel Callable that performs the work and returns the number of
+///        failed invocations
+template <typename kernel_t>
+void measure(BenchmarkRecord& record, std::size_t calls, kernel_t&& kernel) {
+  ScopedAllocationCounter allocations(&record.allocations);
+  const auto start = std::chrono::steady_clock::now();
+  const std::size_t failures = kernel();
+  const auto stop = std::chrono::steady_clock::now();
+
+  record.calls += calls;
+  record.failures += failures;
+  record.time += stop - start;
+}
+
+}  // namespace Test
+}  // namespace Acts
@@ -0,0 +1,203 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/SourceLink.hpp"
+#include "Acts/Geometry/Extent.hpp"
+#include "Acts/Seeding/BinFinder.hpp"
+#include "Acts/Seeding/BinnedSPGroup.hpp"
+#include "Acts/Seeding/Seed.hpp"
+#include "Acts/Seeding/SeedFilter.hpp"
+#include "Acts/Seeding/SeedFilterConfig.hpp"
+#include "Acts/Seeding/SeedFinder.hpp"
+#include "Acts/Seeding/SeedFinderConfig.hpp"
+#include "Acts/Seeding/SpacePointGrid.hpp"
+#include "Acts/Tests/CommonHelpers/TestSpacePoint.hpp"
+#include "Acts/Utilities/Range1D.hpp"
+
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+#include "ReconstructionBenchmarkCommon.hpp"
+
+namespace po = boost::program_options;
+using namespace Acts;
+using namespace Acts::Test;
+using namespace Acts::UnitLiterals;
+
+namespace {
+
+/// Convert all measurements of an event into space points.
+std::vector<TestSpacePoint> makeSpacePoints(const BenchmarkDetector& detector,
+                                            const BenchmarkEvent& event) {
+  std::vector<TestSpacePoint> spacePoints;
+  spacePoints.reserve(event.numMeasurements());
+  for (const auto& [geoId, sl] : event.measurements) {
+    const Surface* surface = detector.geometry->findSurface(geoId);
+    Vector3 pos = surface->localToGlobal(detector.geoCtx, sl.parameters,
+                                         Vector3::UnitZ());
+    // use the larger of the two local variances for both global directions
+    const float var = sl.covariance.diagonal().maxCoeff();
+    spacePoints.emplace_back(pos, var, var,
+                             boost::container::static_vector<SourceLink, 2>{
+                                 SourceLink{sl}});
+  }
+  return spacePoints;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  std::vector<std::size_t> pileups;
+  std::size_t events = 5;
+  std::size_t tracksPerVertex = 10;
+
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+      ("help", "produce help message")
+      ("pileup", po::value<std::vector<std::size_t>>(&pileups)->multitoken()->default_value({0, 50, 200}, "0 50 200"), "pileup levels to benchmark")
+      ("events", po::value<std::size_t>(&events)->default_value(5), "number of events per pileup level")
+      ("tracks-per-vertex", po::value<std::size_t>(&tracksPerVertex)->default_value(10), "number of particles per vertex");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help") != 0u) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  BenchmarkDetector detector;
+
+  SeedFilterConfig filterConfig;
+  filterConfig.deltaRMin = 5_mm;
+  filterConfig.maxSeedsPerSpM = 5;
+  filterConfig = filterConfig.toInternalUnits();
+
+  SeedFinderConfig<TestSpacePoint> config;
+  config.seedFilter =
+      std::make_unique<SeedFilter<TestSpacePoint>>(filterConfig);
+  config.rMin = 0_mm;
+  config.rMax = 200_mm;
+  config.deltaRMin = 5_mm;
+  config.deltaRMax = 160_mm;
+  config.deltaRMinTopSP = config.deltaRMin;
+  config.deltaRMinBottomSP = config.deltaRMin;
+  config.deltaRMaxTopSP = config.deltaRMax;
+  config.deltaRMaxBottomSP = config.deltaRMax;
+  config.collisionRegionMin = -250_mm;
+  config.collisionRegionMax = 250_mm;
+  config.zMin = -600_mm;
+  config.zMax = 600_mm;
+  config.maxSeedsPerSpM = 5;
+  config.cotThetaMax = 2.;
+  config.sigmaScattering = 5.;
+  config.radLengthPerSeed = 0.1;
+  config.minPt = 500_MeV;
+  config.impactMax = 3_mm;
+  config.useVariableMiddleSPRange = false;
+  config = config.toInternalUnits().calculateDerivedQuantities();
+
+  SeedFinderOptions options;
+  options.beamPos = {0_mm, 0_mm};
+  options.bFieldInZ = detector.bz;
+  options = options.toInternalUnits().calculateDerivedQuantities(config);
+
+  SpacePointGridConfig gridConfig;
+  gridConfig.minPt = config.minPt;
+  gridConfig.rMax = config.rMax;
+  gridConfig.zMax = config.zMax;
+  gridConfig.zMin = config.zMin;
+  gridConfig.deltaRMax = config.deltaRMax;
+  gridConfig.cotThetaMax = config.cotThetaMax;
+  gridConfig.impactMax = config.impactMax;
+  gridConfig.isInInternalUnits = true;
+  SpacePointGridOptions gridOptions;
+  gridOptions.bFieldInZ = options.bFieldInZ;
+  gridOptions.isInInternalUnits = true;
+
+  // the bin finders only reference the neighbour definitions
+  const std::vector<std::pair<int, int>> zBinNeighborsBottom;
+  const std::vector<std::pair<int, int>> zBinNeighborsTop;
+  auto bottomBinFinder = std::make_shared<const BinFinder<TestSpacePoint>>(
+      zBinNeighborsBottom, 1);
+  auto topBinFinder = std::make_shared<const BinFinder<TestSpacePoint>>(
+      zBinNeighborsTop, 1);
+
+  SeedFinder<TestSpacePoint> finder(config);
+
+  auto extractGlobal = [](const TestSpacePoint& sp, float, float,
+                          float) -> std::pair<Vector3, Vector2> {
+    return {Vector3(sp.x(), sp.y(), sp.z()),
+            Vector2(sp.varianceR(), sp.varianceZ())};
+  };
+
+  for (std::size_t pileup : pileups) {
+    BenchmarkRecord record;
+    record.kernel = "SeedFinder";
+    record.pileup = pileup;
+    std::size_t numSeeds = 0;
+
+    for (std::size_t ievent = 0; ievent < events; ++ievent) {
+      BenchmarkEventConfig eventConfig;
+      eventConfig.pileup = pileup;
+      eventConfig.tracksPerVertex = tracksPerVertex;
+      eventConfig.seed += ievent;
+      const auto event = generateEvent(detector, eventConfig);
+      const auto spacePoints = makeSpacePoints(detector, event);
+      std::vector<const TestSpacePoint*> spacePointPtrs;
+      spacePointPtrs.reserve(spacePoints.size());
+      for (const auto& sp : spacePoints) {
+        spacePointPtrs.push_back(&sp);
+      }
+
+      // one call is the full seeding of one event incl. the grid filling
+      measure(record, 1, [&]() -> std::size_t {
+        Extent rRangeSPExtent;
+        auto grid = SpacePointGridCreator::createGrid<TestSpacePoint>(
+            gridConfig, gridOptions);
+        auto spGroup = BinnedSPGroup<TestSpacePoint>(
+            spacePointPtrs.begin(), spacePointPtrs.end(), extractGlobal,
+            bottomBinFinder, topBinFinder, std::move(grid), rRangeSPExtent,
+            config, options);
+
+        std::vector<Seed<TestSpacePoint>> seeds;
+        decltype(finder)::SeedingState state;
+        state.spacePointData.resize(spacePointPtrs.size(),
+                                    config.useDetailedDoubleMeasurementInfo);
+        const Range1D<float> rMiddleSPRange;
+        for (auto [bottom, middle, top] : spGroup) {
+          finder.createSeedsForGroup(options, state, spGroup.grid(),
+                                     std::back_inserter(seeds), bottom, middle,
+                                     top, rMiddleSPRange);
+        }
+        numSeeds += seeds.size();
+        return 0;
+      });
+      ++record.events;
+    }
+
+    std::cerr << "pileup " << pileup << ": " << numSeeds << " seeds in "
+              << record.events << " events" << std::endl;
+    std::cout << record << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,177 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/SourceLink.hpp"
+#include "Acts/EventData/TrackContainer.hpp"
+#include "Acts/EventData/VectorMultiTrajectory.hpp"
+#include "Acts/EventData/VectorTrackContainer.hpp"
+#include "Acts/EventData/detail/TestSourceLink.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/TrackFinding/CombinatorialKalmanFilter.hpp"
+#include "Acts/TrackFinding/MeasurementSelector.hpp"
+#include "Acts/TrackFitting/GainMatrixSmoother.hpp"
+#include "Acts/TrackFitting/GainMatrixUpdater.hpp"
+
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+#include "ReconstructionBenchmarkCommon.hpp"
+
+namespace po = boost::program_options;
+using namespace Acts;
+using namespace Acts::Test;
+using namespace Acts::detail::Test;
+using namespace Acts::UnitLiterals;
+
+namespace {
+
+using Trajectory = VectorMultiTrajectory;
+using CkfPropagator = Acts::Propagator<EigenStepper<>, Navigator>;
+using Measurements =
+    std::unordered_multimap<GeometryIdentifier, TestSourceLink>;
+
+/// Source link accessor over all measurements of an event.
+struct MeasurementAccessor {
+  /// Iterator adapter returning a type-erased source link
+  struct Iterator {
+    using BaseIterator = Measurements::const_iterator;
+
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = SourceLink;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = SourceLink;
+
+    Iterator& operator++() {
+      ++m_iterator;
+      return *this;
+    }
+
+    bool operator==(const Iterator& other) const {
+      return m_iterator == other.m_iterator;
+    }
+
+    bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+    SourceLink operator*() const { return SourceLink{m_iterator->second}; }
+
+    BaseIterator m_iterator;
+  };
+
+  const Measurements* container = nullptr;
+
+  std::pair<Iterator, Iterator> range(const Surface& surface) const {
+    auto [begin, end] = container->equal_range(surface.geometryId());
+    return {Iterator{begin}, Iterator{end}};
+  }
+};
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  std::vector<std::size_t> pileups;
+  std::size_t events = 5;
+  std::size_t tracksPerVertex = 10;
+
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+      ("help", "produce help message")
+      ("pileup", po::value<std::vector<std::size_t>>(&pileups)->multitoken()->default_value({0, 50, 200}, "0 50 200"), "pileup levels to benchmark")
+      ("events", po::value<std::size_t>(&events)->default_value(5), "number of events per pileup level")
+      ("tracks-per-vertex", po::value<std::size_t>(&tracksPerVertex)->default_value(10), "number of particles per vertex");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help") != 0u) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  BenchmarkDetector detector;
+
+  GainMatrixUpdater kfUpdater;
+  GainMatrixSmoother kfSmoother;
+  MeasurementSelector::Config measurementSelectorCfg = {
+      {GeometryIdentifier(), {{}, {15.}, {10u}}},
+  };
+  MeasurementSelector measSel{measurementSelectorCfg};
+
+  CombinatorialKalmanFilterExtensions<Trajectory> extensions;
+  extensions.calibrator.connect<&testSourceLinkCalibrator<Trajectory>>();
+  extensions.updater.connect<&GainMatrixUpdater::operator()<Trajectory>>(
+      &kfUpdater);
+  extensions.smoother.connect<&GainMatrixSmoother::operator()<Trajectory>>(
+      &kfSmoother);
+  extensions.measurementSelector
+      .connect<&MeasurementSelector::select<Trajectory>>(&measSel);
+
+  CombinatorialKalmanFilter<CkfPropagator, Trajectory> ckf(
+      detector.makePropagator());
+
+  MeasurementAccessor accessor;
+  CombinatorialKalmanFilterOptions<MeasurementAccessor::Iterator, Trajectory>
+      options(detector.geoCtx, detector.magCtx, detector.calCtx,
+              SourceLinkAccessorDelegate<MeasurementAccessor::Iterator>{},
+              extensions, PropagatorPlainOptions());
+  options.sourcelinkAccessor.connect<&MeasurementAccessor::range>(&accessor);
+  // tracks are only returned with parameters at the smoothing target
+  auto perigee = Surface::makeShared<PerigeeSurface>(Vector3::Zero());
+  options.smoothingTargetSurface = perigee.get();
+
+  for (std::size_t pileup : pileups) {
+    BenchmarkRecord record;
+    record.kernel = "CombinatorialKalmanFilter";
+    record.pileup = pileup;
+    std::size_t numFound = 0;
+
+    for (std::size_t ievent = 0; ievent < events; ++ievent) {
+      BenchmarkEventConfig eventConfig;
+      eventConfig.pileup = pileup;
+      eventConfig.tracksPerVertex = tracksPerVertex;
+      eventConfig.seed += ievent;
+      const auto event = generateEvent(detector, eventConfig);
+      accessor.container = &event.measurements;
+
+      // one call is the track finding from one smeared truth seed
+      measure(record, event.tracks.size(), [&]() -> std::size_t {
+        TrackContainer tracks{VectorTrackContainer{}, VectorMultiTrajectory{}};
+        std::size_t failures = 0;
+        for (const auto& track : event.tracks) {
+          auto res = ckf.findTracks(track.start, options, tracks);
+          if (!res.ok()) {
+            ++failures;
+          }
+        }
+        numFound += tracks.size();
+        return failures;
+      });
+      ++record.events;
+    }
+
+    std::cerr << "pileup " << pileup << ": " << numFound << " tracks found in "
+              << record.events << " events" << std::endl;
+    std::cout << record << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,201 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/SourceLink.hpp"
+#include "Acts/EventData/TrackContainer.hpp"
+#include "Acts/EventData/VectorMultiTrajectory.hpp"
+#include "Acts/EventData/VectorTrackContainer.hpp"
+#include "Acts/EventData/detail/TestSourceLink.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/MultiEigenStepperLoop.hpp"
+#include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/TrackFitting/BetheHeitlerApprox.hpp"
+#include "Acts/TrackFitting/GainMatrixSmoother.hpp"
+#include "Acts/TrackFitting/GainMatrixUpdater.hpp"
+#include "Acts/TrackFitting/GaussianSumFitter.hpp"
+#include "Acts/TrackFitting/GlobalChiSquareFitter.hpp"
+#include "Acts/TrackFitting/GsfMixtureReduction.hpp"
+#include "Acts/TrackFitting/GsfOptions.hpp"
+#include "Acts/TrackFitting/KalmanFitter.hpp"
+
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+#include "ReconstructionBenchmarkCommon.hpp"
+
+namespace po = boost::program_options;
+using namespace Acts;
+using namespace Acts::Test;
+using namespace Acts::detail::Test;
+using namespace Acts::UnitLiterals;
+
+namespace {
+
+using Trajectory = VectorMultiTrajectory;
+using KfPropagator = Acts::Propagator<EigenStepper<>, Navigator>;
+using GsfPropagator = Acts::Propagator<MultiEigenStepperLoop<>, Navigator>;
+
+/// Fit all tracks of an event and count the failed fits.
+template <typename fitter_t, typename options_t>
+std::size_t fitEvent(const fitter_t& fitter, const options_t& options,
+                     const BenchmarkEvent& event,
+                     const std::vector<std::vector<SourceLink>>& sourceLinks) {
+  TrackContainer tracks{VectorTrackContainer{}, VectorMultiTrajectory{}};
+  std::size_t failures = 0;
+  for (std::size_t i = 0; i < event.tracks.size(); ++i) {
+    auto res = fitter.fit(sourceLinks[i].begin(), sourceLinks[i].end(),
+                          event.tracks[i].start, options, tracks);
+    if (!res.ok()) {
+      ++failures;
+    }
+  }
+  return failures;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  std::vector<std::size_t> pileups;
+  std::vector<std::string> kernels;
+  std::size_t events = 5;
+  std::size_t tracksPerVertex = 10;
+
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+      ("help", "produce help message")
+      ("pileup", po::value<std::vector<std::size_t>>(&pileups)->multitoken()->default_value({0, 50, 200}, "0 50 200"), "pileup levels to benchmark")
+      ("fitters", po::value<std::vector<std::string>>(&kernels)->multitoken()->default_value({"KalmanFitter", "GaussianSumFitter", "Gx2Fitter"}, "KalmanFitter GaussianSumFitter Gx2Fitter"), "fitters to benchmark")
+      ("events", po::value<std::size_t>(&events)->default_value(5), "number of events per pileup level")
+      ("tracks-per-vertex", po::value<std::size_t>(&tracksPerVertex)->default_value(10), "number of particles per vertex");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help") != 0u) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+
+    for (const auto& kernel : kernels) {
+      if (kernel != "KalmanFitter" && kernel != "GaussianSumFitter" &&
+          kernel != "Gx2Fitter") {
+        throw std::invalid_argument("Unknown fitter " + kernel);
+      }
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  BenchmarkDetector detector;
+
+  GainMatrixUpdater kfUpdater;
+  GainMatrixSmoother kfSmoother;
+
+  // Kalman fitter
+  KalmanFitterExtensions<Trajectory> kfExtensions;
+  kfExtensions.calibrator.connect<&testSourceLinkCalibrator<Trajectory>>();
+  kfExtensions.updater.connect<&GainMatrixUpdater::operator()<Trajectory>>(
+      &kfUpdater);
+  kfExtensions.smoother.connect<&GainMatrixSmoother::operator()<Trajectory>>(
+      &kfSmoother);
+  kfExtensions.surfaceAccessor
+      .connect<&TestSourceLink::SurfaceAccessor::operator()>(
+          &detector.surfaceAccessor);
+  KalmanFitterOptions kfOptions(detector.geoCtx, detector.magCtx,
+                                detector.calCtx, kfExtensions,
+                                PropagatorPlainOptions());
+  KalmanFitter<KfPropagator, Trajectory> kf(detector.makePropagator());
+
+  // Gaussian sum fitter
+  GsfExtensions<Trajectory> gsfExtensions;
+  gsfExtensions.calibrator.connect<&testSourceLinkCalibrator<Trajectory>>();
+  gsfExtensions.updater.connect<&GainMatrixUpdater::operator()<Trajectory>>(
+      &kfUpdater);
+  gsfExtensions.surfaceAccessor
+      .connect<&TestSourceLink::SurfaceAccessor::operator()>(
+          &detector.surfaceAccessor);
+  gsfExtensions.mixtureReducer.connect<&reduceMixtureWithKLDistance>();
+  GsfOptions<Trajectory> gsfOptions{detector.geoCtx, detector.magCtx,
+                                    detector.calCtx, gsfExtensions,
+                                    PropagatorPlainOptions()};
+  Navigator::Config navCfg{detector.geometry};
+  navCfg.resolvePassive = false;
+  navCfg.resolveMaterial = true;
+  navCfg.resolveSensitive = true;
+  GaussianSumFitter<GsfPropagator, AtlasBetheHeitlerApprox<6, 5>, Trajectory>
+      gsf(GsfPropagator(MultiEigenStepperLoop<>(detector.field),
+                        Navigator(navCfg)),
+          makeDefaultBetheHeitlerApprox());
+
+  // Global chi-square fitter
+  Experimental::Gx2FitterExtensions<Trajectory> gx2fExtensions;
+  gx2fExtensions.calibrator.connect<&testSourceLinkCalibrator<Trajectory>>();
+  gx2fExtensions.surfaceAccessor
+      .connect<&TestSourceLink::SurfaceAccessor::operator()>(
+          &detector.surfaceAccessor);
+  Experimental::Gx2FitterOptions gx2fOptions(detector.geoCtx, detector.magCtx,
+                                             detector.calCtx, gx2fExtensions,
+                                             PropagatorPlainOptions());
+  Experimental::Gx2Fitter<KfPropagator, Trajectory> gx2f(
+      detector.makePropagator());
+
+  for (std::size_t pileup : pileups) {
+    std::vector<BenchmarkRecord> records;
+    for (const auto& kernel : kernels) {
+      BenchmarkRecord& record = records.emplace_back();
+      record.kernel = kernel;
+      record.pileup = pileup;
+    }
+
+    for (std::size_t ievent = 0; ievent < events; ++ievent) {
+      BenchmarkEventConfig eventConfig;
+      eventConfig.pileup = pileup;
+      eventConfig.tracksPerVertex = tracksPerVertex;
+      eventConfig.seed += ievent;
+      const auto event = generateEvent(detector, eventConfig);
+
+      std::vector<std::vector<SourceLink>> sourceLinks;
+      sourceLinks.reserve(event.tracks.size());
+      for (const auto& track : event.tracks) {
+        auto& sls = sourceLinks.emplace_back();
+        for (const auto& sl : track.sourceLinks) {
+          sls.emplace_back(sl);
+        }
+      }
+
+      // one call is the fit of one track
+      for (auto& record : records) {
+        measure(record, event.tracks.size(), [&]() -> std::size_t {
+          if (record.kernel == "KalmanFitter") {
+            return fitEvent(kf, kfOptions, event, sourceLinks);
+          } else if (record.kernel == "GaussianSumFitter") {
+            return fitEvent(gsf, gsfOptions, event, sourceLinks);
+          }
+          return fitEvent(gx2f, gx2fOptions, event, sourceLinks);
+        });
+        ++record.events;
+      }
+    }
+
+    for (const auto& record : records) {
+      std::cout << record << std::endl;
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,162 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Utilities/AnnealingUtility.hpp"
+#include "Acts/Vertexing/AdaptiveMultiVertexFinder.hpp"
+#include "Acts/Vertexing/AdaptiveMultiVertexFitter.hpp"
+#include "Acts/Vertexing/GaussianTrackDensity.hpp"
+#include "Acts/Vertexing/HelicalTrackLinearizer.hpp"
+#include "Acts/Vertexing/ImpactPointEstimator.hpp"
+#include "Acts/Vertexing/TrackDensityVertexFinder.hpp"
+#include "Acts/Vertexing/Vertex.hpp"
+#include "Acts/Vertexing/VertexingOptions.hpp"
+
+#include <iostream>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+#include "ReconstructionBenchmarkCommon.hpp"
+
+namespace po = boost::program_options;
+using namespace Acts;
+using namespace Acts::Test;
+using namespace Acts::UnitLiterals;
+
+namespace {
+
+using VertexingPropagator = Acts::Propagator<EigenStepper<>>;
+using Linearizer = HelicalTrackLinearizer<VertexingPropagator>;
+using IPEstimator =
+    ImpactPointEstimator<BoundTrackParameters, VertexingPropagator>;
+using Fitter = AdaptiveMultiVertexFitter<BoundTrackParameters, Linearizer>;
+using VertexSeedFinder =
+    TrackDensityVertexFinder<Fitter,
+                             GaussianTrackDensity<BoundTrackParameters>>;
+using Finder = AdaptiveMultiVertexFinder<Fitter, VertexSeedFinder>;
+
+/// Express the smeared start parameters of all tracks at the beam line.
+std::vector<BoundTrackParameters> makePerigeeTracks(
+    const BenchmarkDetector& detector, const VertexingPropagator& propagator,
+    const BenchmarkEvent& event) {
+  auto perigee = Surface::makeShared<PerigeeSurface>(Vector3::Zero());
+  PropagatorOptions<> options(detector.geoCtx, detector.magCtx);
+
+  std::vector<BoundTrackParameters> tracks;
+  tracks.reserve(event.tracks.size());
+  for (const auto& track : event.tracks) {
+    auto res = propagator.propagate(track.start, *perigee, options);
+    if (!res.ok() || !res->endParameters) {
+      continue;
+    }
+    const auto& pars = *res->endParameters;
+    tracks.emplace_back(perigee, pars.parameters(), benchmarkStartCovariance(),
+                        pars.particleHypothesis());
+  }
+  return tracks;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  std::vector<std::size_t> pileups;
+  std::size_t events = 5;
+  std::size_t tracksPerVertex = 10;
+
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+      ("help", "produce help message")
+      ("pileup", po::value<std::vector<std::size_t>>(&pileups)->multitoken()->default_value({0, 50, 200}, "0 50 200"), "pileup levels to benchmark")
+      ("events", po::value<std::size_t>(&events)->default_value(5), "number of events per pileup level")
+      ("tracks-per-vertex", po::value<std::size_t>(&tracksPerVertex)->default_value(10), "number of particles per vertex");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help") != 0u) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  BenchmarkDetector detector;
+
+  auto propagator =
+      std::make_shared<VertexingPropagator>(EigenStepper<>(detector.field));
+
+  IPEstimator::Config ipEstimatorCfg(detector.field, propagator);
+  IPEstimator ipEstimator(ipEstimatorCfg);
+
+  AnnealingUtility::Config annealingConfig;
+  annealingConfig.setOfTemperatures = {8.0, 4.0, 2.0, 1.4142136, 1.2247449,
+                                       1.0};
+  Fitter::Config fitterCfg(ipEstimator);
+  fitterCfg.annealingTool = AnnealingUtility(annealingConfig);
+  fitterCfg.doSmoothing = true;
+
+  Linearizer::Config ltConfig(detector.field, propagator);
+
+  Finder::Config finderConfig(Fitter(fitterCfg), VertexSeedFinder(),
+                              ipEstimator, Linearizer(ltConfig),
+                              detector.field);
+  Finder finder(std::move(finderConfig));
+
+  VertexingOptions<BoundTrackParameters> vertexingOptions(detector.geoCtx,
+                                                          detector.magCtx);
+
+  for (std::size_t pileup : pileups) {
+    BenchmarkRecord record;
+    record.kernel = "AdaptiveMultiVertexFinder";
+    record.pileup = pileup;
+    std::size_t numVertices = 0;
+
+    for (std::size_t ievent = 0; ievent < events; ++ievent) {
+      BenchmarkEventConfig eventConfig;
+      eventConfig.pileup = pileup;
+      eventConfig.tracksPerVertex = tracksPerVertex;
+      eventConfig.seed += ievent;
+      const auto event = generateEvent(detector, eventConfig);
+      const auto tracks = makePerigeeTracks(detector, *propagator, event);
+      std::vector<const BoundTrackParameters*> trackPtrs;
+      trackPtrs.reserve(tracks.size());
+      for (const auto& trk : tracks) {
+        trackPtrs.push_back(&trk);
+      }
+
+      // one call is the vertex finding of one full event
+      measure(record, 1, [&]() -> std::size_t {
+        Finder::State state;
+        auto res = finder.find(trackPtrs, vertexingOptions, state);
+        if (!res.ok()) {
+          return 1;
+        }
+        numVertices += res->size();
+        return 0;
+      });
+      ++record.events;
+    }
+
+    std::cerr << "pileup " << pileup << ": " << numVertices
+              << " vertices found in " << record.events << " events"
+              << std::endl;
+    std::cout << record << std::endl;
+  }
+
+  return 0;
+}
@@ -11,6 +11,7 @@
 #include "Acts/Definitions/Algebra.hpp"
 #include "Acts/Definitions/Common.hpp"
 #include "Acts/EventData/SourceLink.hpp"
+#include "Acts/EventData/detail/TestSourceLink.hpp"
 
 #include <cmath>
 #include <vector>
@@ -0,0 +1,46 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Utilities/ParallelFor.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace Acts {
+namespace Test {
+
+/// Executor splitting the items into at most @p nChunks contiguous chunks
+/// of equal size and processing each chunk in its own thread.
+///
+/// The threads are started in reverse order of the chunks to make sure that
+/// the results do not depend on the order in which the chunks are processed.
+///
+/// @param nChunks Maximum number of chunks, at least one chunk is used
+inline ParallelForExecutor threadExecutor(std::size_t nChunks) {
+  nChunks = std::max<std::size_t>(nChunks, 1);
+  return [nChunks](std::size_t size, const ParallelForBody& body) {
+    std::size_t chunkSize =
+        std::max<std::size_t>(1, size / nChunks + (size % nChunks != 0));
+    std::vector<std::thread> threads;
+    for (std::size_t end = size; end > 0;) {
+      std::size_t begin = (end - 1) / chunkSize * chunkSize;
+      threads.emplace_back(body, begin, end);
+      end = begin;
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  };
+}
+
+}  // namespace Test
+}  // namespace Acts
@@ -0,0 +1,150 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/AmbiguityResolution/GreedyAmbiguityResolution.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <set>
+#include <vector>
+
+namespace Acts {
+namespace Test {
+
+namespace {
+
+using State = GreedyAmbiguityResolution::State;
+
+/// Fill the state in the same way as computeInitialState, with random tracks
+/// drawn from a limited number of measurements.
+State makeState(std::size_t nTracks, std::size_t nMeasurements,
+                std::uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<std::size_t> nMeasDist(7, 14);
+  std::uniform_int_distribution<std::size_t> measDist(0, nMeasurements - 1);
+  // Discrete chi2 values to have ties
+  std::uniform_int_distribution<int> chi2Dist(1, 5);
+
+  State state;
+  for (std::size_t iTrack = 0; iTrack < nTracks; ++iTrack) {
+    std::set<std::size_t> measurements;
+    std::size_t nMeas = nMeasDist(rng);
+    while (measurements.size() < nMeas) {
+      measurements.insert(measDist(rng));
+    }
+    state.trackTips.push_back(iTrack);
+    state.trackChi2.push_back(0.5f * chi2Dist(rng));
+    state.measurementsPerTrack.emplace_back(measurements.begin(),
+                                            measurements.end());
+    state.selectedTracks.insert(iTrack);
+    ++state.numberOfTracks;
+  }
+
+  state.tracksPerMeasurement.resize(nMeasurements);
+  for (std::size_t iTrack = 0; iTrack < nTracks; ++iTrack) {
+    for (auto iMeasurement : state.measurementsPerTrack[iTrack]) {
+      state.tracksPerMeasurement[iMeasurement].push_back(iTrack);
+    }
+  }
+  state.sharedMeasurementsPerTrack.assign(nTracks, 0);
+  for (std::size_t iTrack = 0; iTrack < nTracks; ++iTrack) {
+    for (auto iMeasurement : state.measurementsPerTrack[iTrack]) {
+      if (state.tracksPerMeasurement[iMeasurement].size() > 1) {
+        ++state.sharedMeasurementsPerTrack[iTrack];
+      }
+    }
+  }
+  return state;
+}
+
+/// Reference implementation scanning all selected tracks in each iteration
+std::set<std::size_t> resolveReference(
+    const GreedyAmbiguityResolution::Config& cfg, const State& state) {
+  std::vector<std::set<std::size_t>> tracksPerMeasurement;
+  for (const auto& tracks : state.tracksPerMeasurement) {
+    tracksPerMeasurement.emplace_back(tracks.begin(), tracks.end());
+  }
+  auto shared = state.sharedMeasurementsPerTrack;
+  std::set<std::size_t> selected(state.selectedTracks.begin(),
+                                 state.selectedTracks.end());
+
+  auto relativeShared = [&](std::size_t i) {
+    return 1.0 * shared[i] / state.measurementsPerTrack[i].size();
+  };
+
+  for (std::size_t i = 0; i < cfg.maximumIterations && !selected.empty();
+       ++i) {
+    auto maxShared = *std::max_element(
+        selected.begin(), selected.end(),
+        [&](std::size_t a, std::size_t b) { return shared[a] < shared[b]; });
+    if (shared[maxShared] < cfg.maximumSharedHits) {
+      break;
+    }
+    auto badTrack = *std::max_element(
+        selected.begin(), selected.end(), [&](std::size_t a, std::size_t b) {
+          if (relativeShared(a) != relativeShared(b)) {
+            return relativeShared(a) < relativeShared(b);
+          }
+          return state.trackChi2[a] < state.trackChi2[b];
+        });
+    for (auto iMeasurement : state.measurementsPerTrack[badTrack]) {
+      tracksPerMeasurement[iMeasurement].erase(badTrack);
+      if (tracksPerMeasurement[iMeasurement].size() == 1) {
+        --shared[*tracksPerMeasurement[iMeasurement].begin()];
+      }
+    }
+    selected.erase(badTrack);
+  }
+  return selected;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(GreedyAmbiguityResolutionMatchesReference) {
+  for (std::uint32_t seed = 0; seed < 20; ++seed) {
+    for (std::uint32_t maximumSharedHits : {0u, 1u, 3u}) {
+      GreedyAmbiguityResolution::Config cfg;
+      cfg.maximumSharedHits = maximumSharedHits;
+      cfg.maximumIterations = 150;
+      GreedyAmbiguityResolution resolution(cfg);
+
+      State state = makeState(200, 1500, seed);
+      auto expected = resolveReference(cfg, state);
+      resolution.resolve(state);
+
+      BOOST_CHECK_EQUAL(state.selectedTracks.size(), expected.size());
+      BOOST_CHECK(std::equal(state.selectedTracks.begin(),
+                             state.selectedTracks.end(), expected.begin(),
+                             expected.end()));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(GreedyAmbiguityResolutionNoSharedHits) {
+  GreedyAmbiguityResolution::Config cfg;
+  GreedyAmbiguityResolution resolution(cfg);
+
+  // Disjoint tracks are all kept
+  State state = makeState(10, 100000, 42);
+  BOOST_REQUIRE(std::all_of(state.sharedMeasurementsPerTrack.begin(),
+                            state.sharedMeasurementsPerTrack.end(),
+                            [](std::size_t n) { return n == 0; }));
+  resolution.resolve(state);
+  BOOST_CHECK_EQUAL(state.selectedTracks.size(), 10u);
+
+  // Empty input
+  State empty;
+  resolution.resolve(empty);
+  BOOST_CHECK(empty.selectedTracks.empty());
+}
+
+}  // namespace Test
+}  // namespace Acts
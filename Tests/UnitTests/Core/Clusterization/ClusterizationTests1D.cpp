@@ -129,5 +129,54 @@ BOOST_AUTO_TEST_CASE(Grid_1D_rand) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(Grid_1D_sorted) {
+  using Cell = Cell1D;
+  using CellC = std::vector<Cell>;
+  using Cluster = Cluster1D;
+  using ClusterC = std::vector<Cluster>;
+
+  std::mt19937_64 rnd(204769);
+  std::uniform_int_distribution<std::uint32_t> distr_size(1, 10);
+  std::uniform_int_distribution<std::uint32_t> distr_space(1, 10);
+
+  int col = 0;
+  CellC cells;
+  ClusterC clusters;
+  for (std::size_t i = 0; i < 100; i++) {
+    Cluster cl;
+    col += distr_space(rnd);
+    std::uint32_t size = distr_size(rnd);
+    for (std::uint32_t j = 0; j < size; j++) {
+      Cell cell(col++);
+      cells.push_back(cell);
+      clusterAddCell(cl, cell);
+    }
+    // Cells at the same position belong to the same cluster
+    cells.push_back(cells.back());
+    clusterAddCell(cl, cells.back());
+    clusters.push_back(std::move(cl));
+  }
+  for (Cluster& cl : clusters) {
+    hash(cl);
+  }
+
+  std::shuffle(cells.begin(), cells.end(), rnd);
+  std::sort(cells.begin(), cells.end(), cellComp);
+
+  Ccl::labelSortedClusters<CellC, 1>(cells);
+  ClusterC newCls = Ccl::mergeClusters<CellC, ClusterC, 1>(cells);
+  for (Cluster& cl : newCls) {
+    hash(cl);
+  }
+
+  std::sort(clusters.begin(), clusters.end(), clHashComp);
+  std::sort(newCls.begin(), newCls.end(), clHashComp);
+
+  BOOST_CHECK_EQUAL(clusters.size(), newCls.size());
+  for (std::size_t i = 0; i < clusters.size(); i++) {
+    BOOST_CHECK_EQUAL(clusters.at(i).hash, newCls.at(i).hash);
+  }
+}
+
 }  // namespace Test
 }  // namespace Acts
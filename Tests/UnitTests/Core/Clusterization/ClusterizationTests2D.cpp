@@ -10,12 +10,14 @@
 #include <boost/test/unit_test.hpp>
 
 #include "Acts/Clusterization/Clusterization.hpp"
+#include "Acts/Tests/CommonHelpers/ThreadExecutor.hpp"
 
 #include <algorithm>
 #include <array>
 #include <cstdlib>
 #include <iostream>
 #include <iterator>
+#include <map>
 #include <memory>
 #include <random>
 #include <stdexcept>
@@ -248,5 +250,94 @@ BOOST_AUTO_TEST_CASE(Grid_2D_rand) {
   }
 }
 
+BOOST_DATA_TEST_CASE(Grid_2D_sorted,
+                     boost::unit_test::data::make({true, false}),
+                     commonCorner) {
+  using Cell = Cell2D;
+  using CellC = std::vector<Cell>;
+
+  std::mt19937_64 rnd(71902647);
+  // Dense random cells
+  std::bernoulli_distribution distr_cell(0.3);
+  for (std::size_t ntries = 0; ntries < 20; ++ntries) {
+    CellC cells;
+    for (int row = 0; row < 100; ++row) {
+      for (int col = 0; col < 100; ++col) {
+        if (distr_cell(rnd)) {
+          cells.emplace_back(row, col);
+        }
+      }
+    }
+    std::shuffle(cells.begin(), cells.end(), rnd);
+
+    CellC sortedCells = cells;
+    Ccl::labelClusters<CellC>(sortedCells,
+                              Ccl::DefaultConnect<Cell>(commonCorner));
+    // labelClusters sorted the cells column-wise
+    std::vector<Ccl::Label> expected;
+    for (Cell& cell : sortedCells) {
+      expected.push_back(cell.label);
+      cell.label = Ccl::NO_LABEL;
+    }
+    Ccl::labelSortedClusters<CellC>(sortedCells, commonCorner);
+
+    // Both labellings have to describe the same partition
+    std::map<Ccl::Label, Ccl::Label> labelMap;
+    std::map<Ccl::Label, Ccl::Label> inverseLabelMap;
+    for (std::size_t i = 0; i < sortedCells.size(); ++i) {
+      Ccl::Label label = sortedCells[i].label;
+      BOOST_CHECK_NE(label, Ccl::NO_LABEL);
+      BOOST_CHECK_EQUAL(labelMap.emplace(expected[i], label).first->second,
+                        label);
+      BOOST_CHECK_EQUAL(
+          inverseLabelMap.emplace(label, expected[i]).first->second,
+          expected[i]);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Grid_2D_batch) {
+  using Cell = Cell2D;
+  using CellC = std::vector<Cell>;
+  using Cluster = Cluster2D;
+  using ClusterC = std::vector<Cluster>;
+
+  std::mt19937_64 rnd(71902647);
+  std::vector<CellC> modules;
+  std::vector<ClusterC> expected;
+  for (std::size_t i = 0; i < 20; ++i) {
+    CellC cells;
+    for (Rectangle& rect : segment(0, 0, 200, 200, rnd)) {
+      auto& [x0, y0, x1, y1] = rect;
+      Cluster cl = gencluster(x0, y0, x1, y1, rnd);
+      cells.insert(cells.end(), cl.cells.begin(), cl.cells.end());
+    }
+    std::shuffle(cells.begin(), cells.end(), rnd);
+    CellC copy = cells;
+    expected.push_back(Ccl::createClusters<CellC, ClusterC>(copy));
+    modules.push_back(std::move(cells));
+  }
+
+  // Process chunks of modules, each in its own thread
+  std::vector<ClusterC> clusters =
+      Ccl::createClustersBatch<CellC, ClusterC>(modules, threadExecutor(7));
+
+  BOOST_REQUIRE_EQUAL(clusters.size(), expected.size());
+  for (std::size_t i = 0; i < clusters.size(); ++i) {
+    for (Cluster& cl : clusters[i]) {
+      hash(cl);
+    }
+    for (Cluster& cl : expected[i]) {
+      hash(cl);
+    }
+    std::sort(clusters[i].begin(), clusters[i].end(), clHashComp);
+    std::sort(expected[i].begin(), expected[i].end(), clHashComp);
+    BOOST_CHECK_EQUAL(clusters[i].size(), expected[i].size());
+    for (std::size_t j = 0; j < clusters[i].size(); ++j) {
+      BOOST_CHECK_EQUAL(clusters[i][j].hash, expected[i][j].hash);
+    }
+  }
+}
+
 }  // namespace Test
 }  // namespace Acts
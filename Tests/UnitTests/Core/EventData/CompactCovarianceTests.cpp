@@ -0,0 +1,332 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/CompactCovariance.hpp"
+#include "Acts/EventData/CompactTrackStates.hpp"
+#include "Acts/EventData/MultiTrajectory.hpp"
+#include "Acts/EventData/VectorMultiTrajectory.hpp"
+#include "Acts/Utilities/HashedString.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory_resource>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+using namespace Acts;
+using namespace Acts::UnitLiterals;
+using namespace Acts::HashedStringLiteral;
+
+std::default_random_engine rng(42);
+
+/// Memory resource that forwards to the default resource and keeps track of
+/// the number of bytes currently allocated.
+class ByteCountingResource : public std::pmr::memory_resource {
+ public:
+  std::size_t bytes = 0;
+
+ private:
+  void* do_allocate(std::size_t n, std::size_t alignment) override {
+    bytes += n;
+    return std::pmr::get_default_resource()->allocate(n, alignment);
+  }
+
+  void do_deallocate(void* p, std::size_t n, std::size_t alignment) override {
+    bytes -= n;
+    std::pmr::get_default_resource()->deallocate(p, n, alignment);
+  }
+
+  bool do_is_equal(
+      const std::pmr::memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+};
+
+/// Generate a positive-definite covariance with realistic scales of the
+/// bound parameters and a given maximum correlation.
+BoundSquareMatrix makeCovariance(double maxCorrelation) {
+  std::uniform_real_distribution<double> uniform(-1., 1.);
+
+  BoundVector sigma;
+  sigma[eBoundLoc0] = 20_um * std::pow(10., 1.5 * std::abs(uniform(rng)));
+  sigma[eBoundLoc1] = 50_um * std::pow(10., 1.5 * std::abs(uniform(rng)));
+  sigma[eBoundPhi] = 1e-4 * std::pow(10., 2. * std::abs(uniform(rng)));
+  sigma[eBoundTheta] = 1e-4 * std::pow(10., 2. * std::abs(uniform(rng)));
+  sigma[eBoundQOverP] = 1e-3 / 1_GeV * std::pow(10., 2. * uniform(rng));
+  sigma[eBoundTime] = 1_ns * std::pow(10., std::abs(uniform(rng)));
+
+  // random correlation matrix with unit diagonal
+  BoundSquareMatrix a;
+  for (unsigned int i = 0; i < eBoundSize; ++i) {
+    for (unsigned int j = 0; j < eBoundSize; ++j) {
+      a(i, j) = uniform(rng);
+    }
+  }
+  BoundSquareMatrix corr = a * a.transpose();
+  BoundVector norm = corr.diagonal().cwiseSqrt().cwiseInverse();
+  corr = norm.asDiagonal() * corr * norm.asDiagonal();
+  // limit the off-diagonal correlation to control the condition number
+  BoundSquareMatrix id = BoundSquareMatrix::Identity();
+  corr = maxCorrelation * corr + (1. - maxCorrelation) * id;
+
+  BoundSquareMatrix cov = sigma.asDiagonal() * corr * sigma.asDiagonal();
+  // make sure the matrix is exactly symmetric
+  return 0.5 * (cov + cov.transpose());
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(EventDataCompactCovariance)
+
+BOOST_AUTO_TEST_CASE(Sizes) {
+  static_assert(CompactBoundSymMatrix::kPackedSize == 21);
+  BOOST_CHECK_LT(sizeof(CompactBoundSymMatrix), sizeof(BoundSquareMatrix) / 3);
+  BOOST_CHECK_LE(sizeof(CompactBoundMatrix), sizeof(BoundMatrix) / 2);
+}
+
+BOOST_AUTO_TEST_CASE(PackUnpackDouble) {
+  // packing without precision loss is exact
+  BoundSquareMatrix cov = makeCovariance(0.9);
+  PackedSymmetricMatrix<eBoundSize, double> packed(cov);
+  BOOST_CHECK_EQUAL(packed.unpack(), cov);
+
+  for (unsigned int i = 0; i < eBoundSize; ++i) {
+    for (unsigned int j = 0; j < eBoundSize; ++j) {
+      BOOST_CHECK_EQUAL(packed(i, j), cov(i, j));
+    }
+  }
+
+  // unpacking into a map as used by the track state proxies
+  BoundSquareMatrix target = BoundSquareMatrix::Zero();
+  Eigen::Map<BoundSquareMatrix> map{target.data()};
+  packed.unpack(map);
+  BOOST_CHECK_EQUAL(target, cov);
+
+  // temporary maps and blocks can be passed directly
+  target.setZero();
+  packed.unpack(Eigen::Map<BoundSquareMatrix>{target.data()});
+  BOOST_CHECK_EQUAL(target, cov);
+
+  ActsMatrix<eBoundSize + 1, eBoundSize> larger;
+  larger.setZero();
+  packed.unpack(larger.topRows<eBoundSize>());
+  BOOST_CHECK_EQUAL(larger.topRows<eBoundSize>(), cov);
+}
+
+BOOST_AUTO_TEST_CASE(CovariancePrecision) {
+  const double eps = std::numeric_limits<float>::epsilon();
+
+  for (double maxCorrelation : {0.5, 0.9, 0.99}) {
+    double maxElementError = 0;
+    double maxChi2Error = 0;
+    std::size_t notPositive = 0;
+
+    for (std::size_t n = 0; n < 1000; ++n) {
+      BoundSquareMatrix cov = makeCovariance(maxCorrelation);
+      BoundSquareMatrix unpacked = CompactBoundSymMatrix(cov).unpack();
+
+      // symmetry is preserved exactly
+      BOOST_CHECK_EQUAL(unpacked, unpacked.transpose());
+
+      // every element is rounded to the nearest float
+      for (unsigned int i = 0; i < eBoundSize; ++i) {
+        for (unsigned int j = 0; j < eBoundSize; ++j) {
+          double rel = std::abs(unpacked(i, j) - cov(i, j)) /
+                       std::abs(cov(i, j));
+          maxElementError = std::max(maxElementError, rel);
+        }
+      }
+
+      if (unpacked.llt().info() != Eigen::Success) {
+        ++notPositive;
+        continue;
+      }
+
+      // chi2 of a typical residual
+      BoundVector residual = cov.diagonal().cwiseSqrt();
+      double chi2 = residual.transpose() * cov.inverse() * residual;
+      double chi2Unpacked =
+          residual.transpose() * unpacked.inverse() * residual;
+      maxChi2Error =
+          std::max(maxChi2Error, std::abs(chi2Unpacked - chi2) / chi2);
+    }
+
+    BOOST_TEST_MESSAGE("max correlation " << maxCorrelation
+                                          << ": max element error "
+                                          << maxElementError
+                                          << ", max chi2 error " << maxChi2Error
+                                          << ", not positive " << notPositive);
+
+    BOOST_CHECK_LE(maxElementError, eps / 2);
+    BOOST_CHECK_EQUAL(notPositive, 0u);
+    // the error amplification is bound by the condition number
+    BOOST_CHECK_LT(maxChi2Error, maxCorrelation < 0.95 ? 1e-5 : 1e-4);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(JacobianPrecision) {
+  const double eps = std::numeric_limits<float>::epsilon();
+  std::uniform_real_distribution<double> uniform(-1., 1.);
+
+  BoundMatrix jac;
+  for (unsigned int i = 0; i < eBoundSize; ++i) {
+    for (unsigned int j = 0; j < eBoundSize; ++j) {
+      jac(i, j) = uniform(rng) * std::pow(10., 3. * uniform(rng));
+    }
+  }
+
+  CompactBoundMatrix packed(jac);
+  BoundMatrix unpacked = packed.unpack();
+  for (unsigned int i = 0; i < eBoundSize; ++i) {
+    for (unsigned int j = 0; j < eBoundSize; ++j) {
+      BOOST_CHECK_LE(std::abs(unpacked(i, j) - jac(i, j)),
+                     eps / 2 * std::abs(jac(i, j)));
+      BOOST_CHECK_EQUAL(packed(i, j), static_cast<float>(jac(i, j)));
+    }
+  }
+
+  // transported covariance
+  BoundSquareMatrix cov = makeCovariance(0.9);
+  BoundSquareMatrix transported = jac * cov * jac.transpose();
+  BoundSquareMatrix transportedPacked = unpacked * cov * unpacked.transpose();
+  BOOST_CHECK(transportedPacked.isApprox(transported, 1e-5));
+}
+
+BOOST_AUTO_TEST_CASE(DynamicColumn) {
+  VectorMultiTrajectory mtj;
+  mtj.addColumn<CompactBoundSymMatrix>("compactCov");
+
+  BoundSquareMatrix cov = makeCovariance(0.9);
+
+  auto ts = mtj.getTrackState(mtj.addTrackState());
+  ts.smoothedCovariance() = cov;
+  ts.component<CompactBoundSymMatrix>("compactCov").pack(
+      ts.smoothedCovariance());
+
+  const auto& compact =
+      ts.component<CompactBoundSymMatrix, "compactCov"_hash>();
+  BOOST_CHECK(compact.unpack().isApprox(cov, 1e-6));
+}
+
+BOOST_AUTO_TEST_CASE(PackTrackStates) {
+  using PM = TrackStatePropMask;
+
+  ByteCountingResource resource;
+  VectorMultiTrajectory mtj{&resource};
+
+  constexpr std::size_t nStates = 100;
+  std::vector<BoundVector> parameters;
+  std::vector<BoundSquareMatrix> covariances;
+  std::vector<BoundMatrix> jacobians;
+  VectorMultiTrajectory::IndexType previous = MultiTrajectoryTraits::kInvalid;
+  for (std::size_t i = 0; i < nStates; ++i) {
+    auto ts = mtj.getTrackState(mtj.addTrackState(
+        PM::Predicted | PM::Filtered | PM::Smoothed | PM::Jacobian, previous));
+    previous = ts.index();
+
+    parameters.push_back(BoundVector::Random());
+    covariances.push_back(makeCovariance(0.9));
+    jacobians.push_back(BoundMatrix::Random());
+    ts.predicted() = parameters.back();
+    ts.predictedCovariance() = covariances.back();
+    ts.filtered() = 2 * parameters.back();
+    ts.filteredCovariance() = 0.5 * covariances.back();
+    ts.smoothed() = 3 * parameters.back();
+    ts.smoothedCovariance() = 0.25 * covariances.back();
+    ts.jacobian() = jacobians.back();
+  }
+  // the last state only has the filtered component packed
+  mtj.getTrackState(previous).unset(PM::Smoothed);
+
+  const std::size_t bytesBefore = resource.bytes;
+  packTrackStates(mtj);
+  const std::size_t bytesAfter = resource.bytes;
+  BOOST_TEST_MESSAGE("Track state memory " << bytesBefore << " -> "
+                                           << bytesAfter << " bytes");
+  BOOST_CHECK_LT(bytesAfter, bytesBefore * 2 / 3);
+
+  for (std::size_t i = 0; i < nStates; ++i) {
+    auto ts = mtj.getTrackState(i);
+    BOOST_CHECK(!ts.hasPredicted());
+    BOOST_CHECK(!ts.hasFiltered());
+    BOOST_CHECK(!ts.hasSmoothed());
+    BOOST_CHECK(!ts.hasJacobian());
+  }
+
+  // read the packed components
+  VectorMultiTrajectory unpacked;
+  auto target = unpacked.getTrackState(unpacked.addTrackState());
+  for (std::size_t i = 0; i < nStates; ++i) {
+    const auto ts = mtj.getTrackState(i);
+    const PM packed = packedComponents(ts);
+    BOOST_CHECK(ACTS_CHECK_BIT(packed, PM::Predicted));
+    BOOST_CHECK(ACTS_CHECK_BIT(packed, PM::Filtered));
+    BOOST_CHECK_EQUAL(ACTS_CHECK_BIT(packed, PM::Smoothed), i + 1 < nStates);
+    BOOST_CHECK(ACTS_CHECK_BIT(packed, PM::Jacobian));
+
+    const auto& predicted = packedParameters(ts, PM::Predicted);
+    BOOST_CHECK_EQUAL(predicted.parameters, parameters[i]);
+    BOOST_CHECK(predicted.covariance.unpack().isApprox(covariances[i], 1e-6));
+    const auto& filtered = packedParameters(ts, PM::Filtered);
+    BOOST_CHECK_EQUAL(filtered.parameters, 2 * parameters[i]);
+    BOOST_CHECK(
+        filtered.covariance.unpack().isApprox(0.5 * covariances[i], 1e-6));
+    if (ACTS_CHECK_BIT(packed, PM::Smoothed)) {
+      // restore into the component of another track state
+      const auto& smoothed = packedParameters(ts, PM::Smoothed);
+      target.smoothed() = smoothed.parameters;
+      smoothed.covariance.unpack(target.smoothedCovariance());
+      BOOST_CHECK_EQUAL(target.smoothed(), 3 * parameters[i]);
+      BOOST_CHECK(target.smoothedCovariance().isApprox(
+          0.25 * covariances[i], 1e-6));
+    } else {
+      BOOST_CHECK_THROW(packedParameters(ts, PM::Smoothed),
+                        std::invalid_argument);
+    }
+    packedJacobian(ts).unpack(target.jacobian());
+    BOOST_CHECK(target.jacobian().isApprox(jacobians[i], 1e-6));
+  }
+  BOOST_CHECK_EQUAL(packedComponents(target), PM::None);
+}
+
+BOOST_AUTO_TEST_CASE(PackTrackStatesColumnsOnDemand) {
+  using PM = TrackStatePropMask;
+  namespace Columns = CompactTrackStateColumns;
+
+  VectorMultiTrajectory mtj;
+  for (std::size_t i = 0; i < 10; ++i) {
+    auto ts = mtj.getTrackState(mtj.addTrackState(PM::Predicted));
+    ts.predicted() = BoundVector::Random();
+    ts.predictedCovariance() = makeCovariance(0.9);
+  }
+  packTrackStates(mtj, PM::Predicted | PM::Smoothed);
+
+  // only the columns of packed components exist
+  BOOST_CHECK(mtj.hasColumn(hashString(Columns::mask)));
+  BOOST_CHECK(mtj.hasColumn(hashString(Columns::predicted)));
+  BOOST_CHECK(!mtj.hasColumn(hashString(Columns::filtered)));
+  BOOST_CHECK(!mtj.hasColumn(hashString(Columns::smoothed)));
+  BOOST_CHECK(!mtj.hasColumn(hashString(Columns::jacobian)));
+
+  // states added afterwards are covered by the columns
+  auto ts = mtj.getTrackState(mtj.addTrackState(PM::Predicted));
+  BOOST_CHECK_EQUAL(packedComponents(ts), PM::None);
+  packTrackState(ts, PM::Predicted);
+  BOOST_CHECK_EQUAL(packedComponents(ts), PM::Predicted);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -22,8 +22,11 @@
 #include "Acts/EventData/detail/GenerateParameters.hpp"
 #include "Acts/EventData/detail/TestTrackState.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
 #include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
 #include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Tests/CommonHelpers/DetectorElementStub.hpp"
 #include "Acts/Utilities/HashedString.hpp"
 #include "Acts/Utilities/Holders.hpp"
 #include "Acts/Utilities/Zip.hpp"
@@ -31,6 +34,7 @@
 #include <cstddef>
 #include <iterator>
 #include <memory>
+#include <memory_resource>
 #include <numeric>
 #include <random>
 #include <stdexcept>
@@ -116,6 +120,32 @@ using const_holder_types =
     holder_types_t<ConstVectorTrackContainer, ConstVectorMultiTrajectory,
                    detail::ValueHolder, detail::RefHolder, std::shared_ptr>;
 
+/// Memory resource that forwards to the default resource and keeps track of
+/// the number of outstanding allocations.
+class CountingResource : public std::pmr::memory_resource {
+ public:
+  std::size_t allocations = 0;
+  std::size_t outstanding = 0;
+
+ private:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+    ++allocations;
+    ++outstanding;
+    return std::pmr::get_default_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* p, std::size_t bytes,
+                     std::size_t alignment) override {
+    --outstanding;
+    std::pmr::get_default_resource()->deallocate(p, bytes, alignment);
+  }
+
+  bool do_is_equal(
+      const std::pmr::memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+};
+
 }  // namespace
 
 BOOST_AUTO_TEST_SUITE(EventDataTrack)
@@ -206,6 +236,144 @@ BOOST_AUTO_TEST_CASE(BuildSharedPtr) {
   BOOST_CHECK_EQUAL(vtc.get(), &copy.container());
 }
 
+BOOST_AUTO_TEST_CASE(BuildMemoryResource) {
+  CountingResource resource;
+  {
+    VectorTrackContainer vtc{&resource};
+    VectorMultiTrajectory mtj{&resource};
+    BOOST_CHECK_EQUAL(vtc.memoryResource(), &resource);
+    BOOST_CHECK_EQUAL(mtj.memoryResource(), &resource);
+
+    TrackContainer tc{std::move(vtc), std::move(mtj)};
+    BOOST_CHECK_EQUAL(tc.container().memoryResource(), &resource);
+    BOOST_CHECK_EQUAL(tc.trackStateContainer().memoryResource(), &resource);
+
+    tc.addColumn<float>("col_a");
+    BOOST_CHECK_EQUAL(resource.allocations, 0u);
+
+    auto t = tc.getTrack(tc.addTrack());
+    t.component<float>("col_a") = 5.6f;
+    for (std::size_t i = 0; i < 10; ++i) {
+      auto ts = t.appendTrackState();
+      ts.predicted() = BoundVector::Ones() * i;
+    }
+    BOOST_CHECK_GT(resource.allocations, 0u);
+    BOOST_CHECK_EQUAL(t.nTrackStates(), 10u);
+    BOOST_CHECK_EQUAL((t.component<float, "col_a"_hash>()), 5.6f);
+
+    // copies do not refer to the original resource
+    VectorMultiTrajectory copy{tc.trackStateContainer()};
+    BOOST_CHECK_EQUAL(copy.memoryResource(), std::pmr::get_default_resource());
+    BOOST_CHECK_EQUAL(copy.size(), 10u);
+  }
+  BOOST_CHECK_EQUAL(resource.outstanding, 0u);
+
+  // event-scoped arena
+  std::pmr::monotonic_buffer_resource arena;
+  TrackContainer tc{VectorTrackContainer{&arena},
+                    VectorMultiTrajectory{&arena}};
+  for (std::size_t i = 0; i < 100; ++i) {
+    auto t = tc.getTrack(tc.addTrack());
+    t.appendTrackState();
+  }
+  BOOST_CHECK_EQUAL(tc.size(), 100u);
+  BOOST_CHECK_EQUAL(tc.trackStateContainer().size(), 100u);
+}
+
+BOOST_AUTO_TEST_CASE(ReferenceSurfaceOwnership) {
+  TrackContainer tc{VectorTrackContainer{}, VectorMultiTrajectory{}};
+
+  // surfaces are owned by default
+  std::weak_ptr<const Surface> trackPerigee;
+  std::weak_ptr<const Surface> statePerigee;
+  {
+    auto perigee = Surface::makeShared<PerigeeSurface>(Vector3::Zero());
+    trackPerigee = perigee;
+    auto t = tc.getTrack(tc.addTrack());
+    t.setReferenceSurface(perigee);
+
+    perigee = Surface::makeShared<PerigeeSurface>(Vector3::Zero());
+    statePerigee = perigee;
+    auto ts = t.appendTrackState();
+    ts.setReferenceSurface(perigee);
+  }
+  BOOST_CHECK(!trackPerigee.expired());
+  BOOST_CHECK(!statePerigee.expired());
+  BOOST_CHECK_EQUAL(&tc.getTrack(0).referenceSurface(),
+                    trackPerigee.lock().get());
+
+  // copies keep them alive as well
+  {
+    VectorTrackContainer vtc{tc.container()};
+    VectorMultiTrajectory mtj{tc.trackStateContainer()};
+    tc.clear();
+    BOOST_CHECK(!trackPerigee.expired());
+    BOOST_CHECK(!statePerigee.expired());
+  }
+  BOOST_CHECK(trackPerigee.expired());
+  BOOST_CHECK(statePerigee.expired());
+
+  // replacing a surface releases the previous one
+  auto t = tc.getTrack(tc.addTrack());
+  auto ts = t.appendTrackState();
+  {
+    auto perigee = Surface::makeShared<PerigeeSurface>(Vector3::Zero());
+    statePerigee = perigee;
+    ts.setReferenceSurface(perigee);
+  }
+  BOOST_CHECK(!statePerigee.expired());
+  ts.setReferenceSurface(nullptr);
+  BOOST_CHECK(statePerigee.expired());
+  BOOST_CHECK(!ts.hasReferenceSurface());
+
+  // opt-in: detector surfaces can be referenced without ownership
+  Test::DetectorElementStub detElement{
+      Transform3::Identity(), std::make_shared<RectangleBounds>(1_m, 1_m),
+      1_mm};
+  auto detSurface = detElement.surface().getSharedPtr();
+  const auto useCount = detSurface.use_count();
+
+  t.setReferenceSurfaceUnowned(detSurface.get());
+  ts.setReferenceSurfaceUnowned(detSurface.get());
+  BOOST_CHECK_EQUAL(&t.referenceSurface(), detSurface.get());
+  BOOST_CHECK_EQUAL(&ts.referenceSurface(), detSurface.get());
+  BOOST_CHECK(!t.ownsReferenceSurface());
+  BOOST_CHECK(!ts.ownsReferenceSurface());
+  BOOST_CHECK_EQUAL(detSurface.use_count(), useCount);
+
+  {
+    VectorTrackContainer vtc{tc.container()};
+    VectorMultiTrajectory mtj{tc.trackStateContainer()};
+    BOOST_CHECK_EQUAL(detSurface.use_count(), useCount);
+    BOOST_CHECK_EQUAL(&mtj.getTrackState(ts.index()).referenceSurface(),
+                      detSurface.get());
+  }
+
+  // copying tracks keeps the surfaces unowned
+  {
+    TrackContainer copy{VectorTrackContainer{}, VectorMultiTrajectory{}};
+    auto tCopy = copy.getTrack(copy.addTrack());
+    tCopy.copyFrom(t);
+    BOOST_CHECK_EQUAL(&tCopy.referenceSurface(), detSurface.get());
+    BOOST_CHECK(!tCopy.ownsReferenceSurface());
+    BOOST_CHECK(!(*tCopy.trackStatesReversed().begin()).ownsReferenceSurface());
+    BOOST_CHECK_EQUAL(detSurface.use_count(), useCount);
+  }
+
+  // an unowned surface replaces an owned one
+  {
+    auto perigee = Surface::makeShared<PerigeeSurface>(Vector3::Zero());
+    trackPerigee = perigee;
+    t.setReferenceSurface(perigee);
+  }
+  BOOST_CHECK(!trackPerigee.expired());
+  BOOST_CHECK(t.ownsReferenceSurface());
+  t.setReferenceSurfaceUnowned(detSurface.get());
+  BOOST_CHECK(trackPerigee.expired());
+  BOOST_CHECK(!t.ownsReferenceSurface());
+  BOOST_CHECK_EQUAL(&t.referenceSurface(), detSurface.get());
+}
+
 BOOST_AUTO_TEST_CASE_TEMPLATE(Build, factory_t, holder_types) {
   factory_t factory;
 
@@ -536,6 +704,11 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(DynamicColumns, factory_t, holder_types) {
   auto t = tc.getTrack(tc.addTrack());
   t.template component<float>("col_a") = 5.6f;
   BOOST_CHECK_EQUAL((t.template component<float, "col_a"_hash>()), 5.6f);
+
+  // a column added later covers the existing tracks
+  tc.template addColumn<int>("col_b");
+  BOOST_CHECK_EQUAL((t.template component<int, "col_b"_hash>()), 0);
+  BOOST_CHECK_EQUAL((t.template component<float, "col_a"_hash>()), 5.6f);
 }
 
 BOOST_AUTO_TEST_CASE(EnsureDynamicColumns) {
@@ -551,10 +724,12 @@ BOOST_AUTO_TEST_CASE(EnsureDynamicColumns) {
   BOOST_CHECK(!tc2.hasColumn("counter"));
   BOOST_CHECK(!tc2.hasColumn("odd"));
 
+  auto t = tc2.getTrack(tc2.addTrack());
   tc2.ensureDynamicColumns(tc);
 
   BOOST_CHECK(tc2.hasColumn("counter"));
   BOOST_CHECK(tc2.hasColumn("odd"));
+  BOOST_CHECK_EQUAL((t.component<std::size_t, "counter"_hash>()), 0u);
 }
 
 BOOST_AUTO_TEST_CASE(AppendTrackState) {
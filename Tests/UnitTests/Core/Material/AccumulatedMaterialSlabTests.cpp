@@ -16,6 +16,7 @@
 
 #include <limits>
 #include <utility>
+#include <vector>
 
 namespace {
 
@@ -198,4 +199,46 @@ BOOST_AUTO_TEST_CASE(MultipleDifferentTracks) {
   }
 }
 
+// merging accumulators of disjoint tracks is the same as averaging all tracks
+BOOST_AUTO_TEST_CASE(MergeTracks) {
+  MaterialSlab unit = makeUnitSlab();
+  MaterialSlab silicon(makeSilicon(), 3 * unit.thickness());
+  MaterialSlab vac(2 * unit.thickness());
+  std::vector<MaterialSlab> tracks = {unit, silicon, vac, unit, silicon};
+
+  AccumulatedMaterialSlab all;
+  AccumulatedMaterialSlab first;
+  AccumulatedMaterialSlab second;
+  AccumulatedMaterialSlab none;
+  for (std::size_t i = 0; i < tracks.size(); ++i) {
+    all.accumulate(tracks[i]);
+    all.trackVariance(unit);
+    all.trackAverage();
+    AccumulatedMaterialSlab& part = (i < 2) ? first : second;
+    part.accumulate(tracks[i]);
+    part.trackVariance(unit);
+    part.trackAverage();
+  }
+  first.merge(second);
+  // merging an empty accumulator changes nothing
+  first.merge(none);
+
+  auto [average, trackCount] = first.totalAverage();
+  auto [expected, expectedCount] = all.totalAverage();
+  BOOST_CHECK_EQUAL(trackCount, expectedCount);
+  CHECK_CLOSE_REL(average.thickness(), expected.thickness(), 8 * eps);
+  CHECK_CLOSE_REL(average.material().X0(), expected.material().X0(), 8 * eps);
+  CHECK_CLOSE_REL(average.material().L0(), expected.material().L0(), 8 * eps);
+  CHECK_CLOSE_REL(average.material().molarDensity(),
+                  expected.material().molarDensity(), 8 * eps);
+  CHECK_CLOSE_REL(first.totalVariance().first, all.totalVariance().first,
+                  8 * eps);
+
+  // merging into an empty accumulator copies the total average
+  none.merge(first);
+  BOOST_CHECK_EQUAL(none.totalAverage().second, expectedCount);
+  BOOST_CHECK_EQUAL(none.totalAverage().first.thickness(),
+                    average.thickness());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
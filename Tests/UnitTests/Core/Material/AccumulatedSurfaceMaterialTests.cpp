@@ -19,6 +19,7 @@
 #include <array>
 #include <cstddef>
 #include <memory>
+#include <stdexcept>
 #include <vector>
 
 namespace Acts {
@@ -186,5 +187,49 @@ BOOST_AUTO_TEST_CASE(AccumulatedSurfaceMaterial_variance_0D) {
   BOOST_CHECK_EQUAL(trackCount, 2u);
 }
 
+/// Test the merging of material accumulated from different tracks
+BOOST_AUTO_TEST_CASE(AccumulatedSurfaceMaterial_merge) {
+  Material mat = Material::fromMolarDensity(1., 1., 1., 1., 1.);
+  MaterialSlab one(mat, 1.);
+  MaterialSlab two(mat, 2.);
+
+  BinUtility binUtility(2, -1., 1., open, binX);
+  AccumulatedSurfaceMaterial all(binUtility);
+  AccumulatedSurfaceMaterial first(binUtility);
+  AccumulatedSurfaceMaterial second(binUtility);
+
+  // Fill both bins with the first track and only the second bin with the
+  // second track
+  Vector3 left(-0.5, 0., 0.);
+  Vector3 right(0.5, 0., 0.);
+  for (auto* accMat : {&all, &first}) {
+    accMat->accumulate(left, one);
+    accMat->accumulate(right, one);
+    std::vector<std::array<std::size_t, 3>> trackBins = {{0, 0, 0},
+                                                          {1, 0, 0}};
+    accMat->trackAverage(trackBins);
+  }
+  for (auto* accMat : {&all, &second}) {
+    accMat->accumulate(right, two);
+    std::vector<std::array<std::size_t, 3>> trackBins = {{1, 0, 0}};
+    accMat->trackAverage(trackBins);
+  }
+  first.merge(second);
+
+  const auto& merged = first.accumulatedMaterial();
+  const auto& expected = all.accumulatedMaterial();
+  for (std::size_t ib = 0; ib < 2; ++ib) {
+    auto [average, count] = merged[0][ib].totalAverage();
+    auto [expectedAverage, expectedCount] = expected[0][ib].totalAverage();
+    BOOST_CHECK_EQUAL(count, expectedCount);
+    BOOST_CHECK_EQUAL(average.thickness(), expectedAverage.thickness());
+  }
+  BOOST_CHECK_EQUAL(merged[0][1].totalAverage().first.thickness(), 1.5);
+
+  // Different binning can not be merged
+  AccumulatedSurfaceMaterial homogeneous;
+  BOOST_CHECK_THROW(first.merge(homogeneous), std::invalid_argument);
+}
+
 }  // namespace Test
 }  // namespace Acts
@@ -104,6 +104,28 @@ BOOST_AUTO_TEST_CASE(two_materials_different_lengh) {
                   1e-4);
 }
 
+BOOST_AUTO_TEST_CASE(merge) {
+  MaterialSlab matprop1(Material::fromMolarDensity(1., 2., 3., 4., 5.), 0.5);
+  MaterialSlab matprop2(Material::fromMolarDensity(6., 7., 8., 9., 10.), 2.);
+  MaterialSlab matprop3(Material::fromMolarDensity(2., 3., 4., 5., 6.), 1.);
+
+  AccumulatedVolumeMaterial all;
+  all.accumulate(matprop1);
+  all.accumulate(matprop2);
+  all.accumulate(matprop3);
+
+  AccumulatedVolumeMaterial first;
+  AccumulatedVolumeMaterial second;
+  first.accumulate(matprop1);
+  second.accumulate(matprop2);
+  second.accumulate(matprop3);
+  first.merge(second);
+
+  auto result = first.average();
+  auto expected = all.average();
+  CHECK_CLOSE_REL(result.parameters(), expected.parameters(), 1e-4);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace Test
@@ -0,0 +1,282 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Material/BinaryMaterialDecorator.hpp"
+#include "Acts/Material/BinaryMaterialMaps.hpp"
+#include "Acts/Material/BinnedSurfaceMaterial.hpp"
+#include "Acts/Material/CompactSurfaceMaterial.hpp"
+#include "Acts/Material/HomogeneousSurfaceMaterial.hpp"
+#include "Acts/Material/HomogeneousVolumeMaterial.hpp"
+#include "Acts/Material/Material.hpp"
+#include "Acts/Material/MaterialSlab.hpp"
+#include "Acts/Material/ProtoSurfaceMaterial.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Utilities/BinUtility.hpp"
+#include "Acts/Utilities/BinningType.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Acts {
+namespace Test {
+
+namespace {
+
+std::string tempFile(const std::string& name) {
+  return (std::filesystem::temp_directory_path() / name).string();
+}
+
+MaterialSlab makeSlab(float i) {
+  return MaterialSlab(
+      Material::fromMolarDensity(1. + i, 2. + i, 3. + i, 4. + i, 5. + i),
+      0.1 + i);
+}
+
+/// Binned material where the slab of a bin only depends on bin0 % nDistinct
+std::shared_ptr<const BinnedSurfaceMaterial> makeBinned(
+    const BinUtility& binUtility, std::size_t nDistinct) {
+  MaterialSlabMatrix slabs;
+  for (std::size_t bin1 = 0; bin1 <= binUtility.max(1); ++bin1) {
+    MaterialSlabVector row;
+    for (std::size_t bin0 = 0; bin0 <= binUtility.max(0); ++bin0) {
+      row.push_back(makeSlab(static_cast<float>((bin0 + bin1) % nDistinct)));
+    }
+    slabs.push_back(row);
+  }
+  return std::make_shared<const BinnedSurfaceMaterial>(binUtility, slabs, 0.25,
+                                                       MappingType::PreMapping);
+}
+
+void checkSameMaterial(const ISurfaceMaterial& expected,
+                       const ISurfaceMaterial& actual,
+                       const BinUtility& binUtility) {
+  for (std::size_t bin1 = 0; bin1 <= binUtility.max(1); ++bin1) {
+    for (std::size_t bin0 = 0; bin0 <= binUtility.max(0); ++bin0) {
+      BOOST_CHECK(actual.materialSlab(bin0, bin1) ==
+                  expected.materialSlab(bin0, bin1));
+    }
+  }
+  for (double x = -2.; x < 2.; x += 0.13) {
+    for (double y = -4.; y < 4.; y += 0.29) {
+      BOOST_CHECK(actual.materialSlab(Vector2(x, y)) ==
+                  expected.materialSlab(Vector2(x, y)));
+      BOOST_CHECK(actual.materialSlab(Vector3(x, y, 0.)) ==
+                  expected.materialSlab(Vector3(x, y, 0.)));
+    }
+  }
+  BOOST_CHECK_EQUAL(
+      actual.factor(Direction::Negative, MaterialUpdateStage::PreUpdate),
+      expected.factor(Direction::Negative, MaterialUpdateStage::PreUpdate));
+  BOOST_CHECK_EQUAL(actual.mappingType(), expected.mappingType());
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(BinaryMaterialMaps_roundtrip) {
+  BinUtility xyBinning(20, -1., 1., open, binX);
+  xyBinning += BinUtility(30, -3., 3., open, binY);
+  auto binned2D = makeBinned(xyBinning, 7);
+
+  std::vector<float> boundaries = {-1.5, -0.2, 0.1, 0.7, 1.5};
+  BinUtility arbitraryBinning(boundaries, open, binX,
+                              Transform3(Translation3(0.3, 0., 0.)));
+  auto binned1D = makeBinned(arbitraryBinning, 3);
+
+  auto homogeneous = std::make_shared<const HomogeneousSurfaceMaterial>(
+      makeSlab(2.), 0.5, MappingType::Sensor);
+  auto volume = std::make_shared<const HomogeneousVolumeMaterial>(
+      makeSlab(11.).material());
+
+  DetectorMaterialMaps maps;
+  maps.first[GeometryIdentifier().setVolume(1).setSensitive(1)] = binned2D;
+  maps.first[GeometryIdentifier().setVolume(1).setSensitive(2)] = binned1D;
+  maps.first[GeometryIdentifier().setVolume(2).setLayer(2)] = homogeneous;
+  maps.second[GeometryIdentifier().setVolume(3)] = volume;
+
+  std::string fileName = tempFile("BinaryMaterialMaps_roundtrip.bin");
+  writeBinaryMaterialMaps(fileName, maps);
+  DetectorMaterialMaps read = readBinaryMaterialMaps(fileName);
+  // The mapping stays valid after the file is removed
+  std::filesystem::remove(fileName);
+
+  BOOST_REQUIRE_EQUAL(read.first.size(), 3u);
+  BOOST_REQUIRE_EQUAL(read.second.size(), 1u);
+
+  const auto& compact2D =
+      read.first.at(GeometryIdentifier().setVolume(1).setSensitive(1));
+  BOOST_CHECK(dynamic_cast<const CompactSurfaceMaterial*>(compact2D.get()) !=
+              nullptr);
+  checkSameMaterial(*binned2D, *compact2D, xyBinning);
+
+  const auto& compact1D =
+      read.first.at(GeometryIdentifier().setVolume(1).setSensitive(2));
+  checkSameMaterial(*binned1D, *compact1D, arbitraryBinning);
+
+  const auto& readHomogeneous =
+      read.first.at(GeometryIdentifier().setVolume(2).setLayer(2));
+  BOOST_CHECK(readHomogeneous->materialSlab(0, 0) ==
+              homogeneous->materialSlab(0, 0));
+  BOOST_CHECK_EQUAL(readHomogeneous->factor(Direction::Negative,
+                                            MaterialUpdateStage::PreUpdate),
+                    0.5);
+  BOOST_CHECK_EQUAL(readHomogeneous->mappingType(), MappingType::Sensor);
+
+  const auto& readVolume = read.second.at(GeometryIdentifier().setVolume(3));
+  BOOST_CHECK(readVolume->material(Vector3::Zero()) ==
+              volume->material(Vector3::Zero()));
+}
+
+BOOST_AUTO_TEST_CASE(BinaryMaterialMaps_wide_indices) {
+  // More distinct slabs than a 2 byte index can address
+  BinUtility xyBinning(300, -1., 1., open, binX);
+  xyBinning += BinUtility(300, -3., 3., open, binY);
+  MaterialSlabMatrix slabs;
+  for (std::size_t bin1 = 0; bin1 < 300; ++bin1) {
+    MaterialSlabVector row;
+    for (std::size_t bin0 = 0; bin0 < 300; ++bin0) {
+      row.push_back(makeSlab(0.001f * (bin0 + 300 * bin1)));
+    }
+    slabs.push_back(row);
+  }
+  auto binned = std::make_shared<const BinnedSurfaceMaterial>(xyBinning, slabs);
+
+  DetectorMaterialMaps maps;
+  maps.first[GeometryIdentifier().setVolume(1)] = binned;
+  std::string fileName = tempFile("BinaryMaterialMaps_wide.bin");
+  writeBinaryMaterialMaps(fileName, maps);
+  DetectorMaterialMaps read = readBinaryMaterialMaps(fileName);
+  std::filesystem::remove(fileName);
+
+  checkSameMaterial(*binned, *read.first.begin()->second, xyBinning);
+}
+
+BOOST_AUTO_TEST_CASE(BinaryMaterialMaps_scaling) {
+  BinUtility xBinning(10, -1., 1., open, binX);
+  DetectorMaterialMaps maps;
+  maps.first[GeometryIdentifier().setVolume(1)] = makeBinned(xBinning, 2);
+
+  std::string fileName = tempFile("BinaryMaterialMaps_scaling.bin");
+  writeBinaryMaterialMaps(fileName, maps);
+  DetectorMaterialMaps first = readBinaryMaterialMaps(fileName);
+  DetectorMaterialMaps second = readBinaryMaterialMaps(fileName);
+  std::filesystem::remove(fileName);
+
+  auto scaled = std::const_pointer_cast<ISurfaceMaterial>(
+      first.first.begin()->second);
+  (*scaled) *= 2.;
+  const auto& unscaled = *second.first.begin()->second;
+  for (std::size_t bin0 = 0; bin0 < 10; ++bin0) {
+    BOOST_CHECK_CLOSE(scaled->materialSlab(bin0, 0).thickness(),
+                      2. * unscaled.materialSlab(bin0, 0).thickness(), 1e-6);
+    BOOST_CHECK(scaled->materialSlab(bin0, 0).material() ==
+                unscaled.materialSlab(bin0, 0).material());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(BinaryMaterialMaps_errors) {
+  // Proto material only describes the binning
+  DetectorMaterialMaps maps;
+  maps.first[GeometryIdentifier().setVolume(1)] =
+      std::make_shared<const ProtoSurfaceMaterial>(
+          BinUtility(10, -1., 1., open, binX));
+  std::string fileName = tempFile("BinaryMaterialMaps_errors.bin");
+  BOOST_CHECK_THROW(writeBinaryMaterialMaps(fileName, maps),
+                    std::invalid_argument);
+
+  BOOST_CHECK_THROW(readBinaryMaterialMaps(tempFile("does_not_exist.bin")),
+                    std::runtime_error);
+
+  // Truncated file
+  maps.first[GeometryIdentifier().setVolume(1)] =
+      makeBinned(BinUtility(10, -1., 1., open, binX), 2);
+  writeBinaryMaterialMaps(fileName, maps);
+  std::filesystem::resize_file(fileName,
+                               std::filesystem::file_size(fileName) - 8);
+  BOOST_CHECK_THROW(readBinaryMaterialMaps(fileName), std::runtime_error);
+
+  // Out of range binning type and option, the offsets follow the layout of
+  // the file header, the surface record and the binning record
+  for (std::uint64_t field : {0u, 4u}) {
+    writeBinaryMaterialMaps(fileName, maps);
+    std::fstream file(fileName,
+                      std::ios::in | std::ios::out | std::ios::binary);
+    std::uint64_t surfaceOffset = 0;
+    std::uint64_t binningOffset = 0;
+    file.seekg(48);
+    file.read(reinterpret_cast<char*>(&surfaceOffset), sizeof(surfaceOffset));
+    file.seekg(surfaceOffset + 24);
+    file.read(reinterpret_cast<char*>(&binningOffset), sizeof(binningOffset));
+    std::uint32_t invalid = 7;
+    file.seekp(binningOffset + field);
+    file.write(reinterpret_cast<const char*>(&invalid), sizeof(invalid));
+    file.close();
+    BOOST_CHECK_THROW(readBinaryMaterialMaps(fileName), std::runtime_error);
+  }
+
+  // Out of range mapping type of the surface record
+  {
+    writeBinaryMaterialMaps(fileName, maps);
+    std::fstream file(fileName,
+                      std::ios::in | std::ios::out | std::ios::binary);
+    std::uint64_t surfaceOffset = 0;
+    file.seekg(48);
+    file.read(reinterpret_cast<char*>(&surfaceOffset), sizeof(surfaceOffset));
+    std::int32_t invalid = 7;
+    file.seekp(surfaceOffset + 16);
+    file.write(reinterpret_cast<const char*>(&invalid), sizeof(invalid));
+    file.close();
+    BOOST_CHECK_THROW(readBinaryMaterialMaps(fileName), std::runtime_error);
+  }
+
+  // Not a material file
+  {
+    std::ofstream out(fileName, std::ios::trunc);
+    out << "{\"Surfaces\": []}";
+  }
+  BOOST_CHECK_THROW(readBinaryMaterialMaps(fileName), std::runtime_error);
+  std::filesystem::remove(fileName);
+}
+
+BOOST_AUTO_TEST_CASE(BinaryMaterialDecorator_decorate) {
+  auto withMaterial =
+      Surface::makeShared<PlaneSurface>(Vector3::Zero(), Vector3::UnitZ());
+  withMaterial->assignGeometryId(GeometryIdentifier().setVolume(1));
+  auto withoutMaterial =
+      Surface::makeShared<PlaneSurface>(Vector3::Zero(), Vector3::UnitZ());
+  withoutMaterial->assignGeometryId(GeometryIdentifier().setVolume(2));
+  withoutMaterial->assignSurfaceMaterial(
+      std::make_shared<const HomogeneousSurfaceMaterial>(makeSlab(1.)));
+
+  DetectorMaterialMaps maps;
+  maps.first[GeometryIdentifier().setVolume(1)] =
+      makeBinned(BinUtility(10, -1., 1., open, binX), 2);
+  std::string fileName = tempFile("BinaryMaterialDecorator.bin");
+  writeBinaryMaterialMaps(fileName, maps);
+  BinaryMaterialDecorator decorator(fileName, Logging::INFO);
+  std::filesystem::remove(fileName);
+
+  decorator.decorate(*withMaterial);
+  decorator.decorate(*withoutMaterial);
+  BOOST_REQUIRE(withMaterial->surfaceMaterial() != nullptr);
+  BOOST_CHECK(withMaterial->surfaceMaterial()->materialSlab(3, 0) ==
+              maps.first.begin()->second->materialSlab(3, 0));
+  BOOST_CHECK(withoutMaterial->surfaceMaterial() == nullptr);
+}
+
+}  // namespace Test
+}  // namespace Acts
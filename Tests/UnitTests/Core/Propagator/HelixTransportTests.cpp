@@ -0,0 +1,199 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/data/test_case.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/MagneticField/NullBField.hpp"
+#include "Acts/MagneticField/SolenoidBField.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/detail/HelixTransport.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+
+#include <cmath>
+#include <memory>
+
+namespace bdata = boost::unit_test::data;
+using namespace Acts::UnitLiterals;
+
+namespace Acts {
+namespace Test {
+
+namespace {
+
+GeometryContext geoContext;
+MagneticFieldContext magFieldContext;
+
+using HelicalPropagator = Propagator<EigenStepper<>>;
+
+BoundSquareMatrix makeCovariance() {
+  BoundVector stddev;
+  stddev[eBoundLoc0] = 20_um;
+  stddev[eBoundLoc1] = 50_um;
+  stddev[eBoundPhi] = 1_mrad;
+  stddev[eBoundTheta] = 1_mrad;
+  stddev[eBoundQOverP] = 0.01_e / 1_GeV;
+  stddev[eBoundTime] = 1_ns;
+  BoundSquareMatrix corr = BoundSquareMatrix::Identity();
+  corr(eBoundLoc0, eBoundPhi) = corr(eBoundPhi, eBoundLoc0) = 0.5;
+  corr(eBoundLoc1, eBoundTheta) = corr(eBoundTheta, eBoundLoc1) = -0.3;
+  corr(eBoundLoc0, eBoundQOverP) = corr(eBoundQOverP, eBoundLoc0) = 0.2;
+  return stddev.asDiagonal() * corr * stddev.asDiagonal();
+}
+
+/// Propagate with a tight integration tolerance as reference.
+BoundTrackParameters propagate(
+    std::shared_ptr<const MagneticFieldProvider> field,
+    const BoundTrackParameters& start, const Surface& target) {
+  HelicalPropagator propagator{EigenStepper<>(std::move(field))};
+  PropagatorOptions<> options(geoContext, magFieldContext);
+  options.stepTolerance = 1e-8;
+  options.surfaceTolerance = 1e-9;
+  auto intersection = target
+                          .intersect(geoContext, start.position(geoContext),
+                                     start.direction(), BoundaryCheck(false))
+                          .closest();
+  options.direction =
+      Direction::fromScalarZeroAsPositive(intersection.pathLength());
+  return *propagator.propagate(start, target, options).value().endParameters;
+}
+
+void checkParameters(const BoundTrackParameters& helix,
+                     const BoundTrackParameters& reference) {
+  CHECK_CLOSE_ABS(helix.position(geoContext), reference.position(geoContext),
+                  1_nm);
+  CHECK_CLOSE_ABS(helix.direction(), reference.direction(), 1e-8);
+  CHECK_CLOSE_REL(helix.qOverP(), reference.qOverP(), 1e-12);
+  CHECK_CLOSE_ABS(helix.time(), reference.time(), 1e-6_ns);
+  CHECK_CLOSE_COVARIANCE(*helix.covariance(), *reference.covariance(), 1e-5);
+}
+
+auto momenta = bdata::make({0.4_GeV, 1_GeV, 10_GeV});
+auto charges = bdata::make({-1_e, 1_e});
+auto phis = bdata::make({-2.5, 0.3, 1.9});
+auto thetas = bdata::make({0.4, 1.5, 2.6});
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(PropagatorHelixTransport)
+
+BOOST_DATA_TEST_CASE(ToPlane, momenta* charges* phis* thetas, p, q, phi,
+                     theta) {
+  auto particleHypothesis = ParticleHypothesis::pion();
+  auto start = Surface::makeShared<PerigeeSurface>(Vector3(1_mm, -2_mm, 0));
+  BoundVector pars;
+  pars << 30_um, -5_mm, phi, theta, particleHypothesis.qOverP(p, q), 1_ns;
+  BoundTrackParameters params(start, pars, makeCovariance(),
+                              particleHypothesis);
+
+  // tilted field to check the general helix
+  for (const Vector3& bField :
+       {Vector3(0, 0, 2_T), Vector3(0.3_T, -0.2_T, 3.8_T)}) {
+    auto field = std::make_shared<ConstantBField>(bField);
+
+    // plane crossed after a few centimeters, oriented as in the impact point
+    // estimator
+    Vector3 normal = params.direction();
+    Vector3 center = params.position(geoContext) + 40_mm * normal;
+    auto plane = Surface::makeShared<PlaneSurface>(
+        center, Vector3(normal + Vector3(0.1, -0.2, 0.05)).normalized());
+
+    auto result =
+        detail::transportAlongHelix(geoContext, params, *plane, bField, 1e-9);
+    BOOST_REQUIRE(result.ok());
+    BOOST_CHECK_EQUAL(&result->referenceSurface(), plane.get());
+    checkParameters(*result, propagate(field, params, *plane));
+  }
+}
+
+BOOST_DATA_TEST_CASE(ToPerigee, momenta* charges* phis* thetas, p, q, phi,
+                     theta) {
+  auto particleHypothesis = ParticleHypothesis::pion();
+  auto start = Surface::makeShared<PerigeeSurface>(Vector3(0, 0, 0));
+  BoundVector pars;
+  pars << -20_um, 15_mm, phi, theta, particleHypothesis.qOverP(p, q), 0_ns;
+  BoundTrackParameters params(start, pars, makeCovariance(),
+                              particleHypothesis);
+
+  Vector3 bField(0, 0, 2_T);
+  auto field = std::make_shared<ConstantBField>(bField);
+
+  auto perigee =
+      Surface::makeShared<PerigeeSurface>(Vector3(50_um, -80_um, 14_mm));
+  auto result =
+      detail::transportAlongHelix(geoContext, params, *perigee, bField, 1e-12);
+  BOOST_REQUIRE(result.ok());
+  checkParameters(*result, propagate(field, params, *perigee));
+}
+
+BOOST_AUTO_TEST_CASE(FieldHomogeneity) {
+  auto particleHypothesis = ParticleHypothesis::pion();
+  auto start = Surface::makeShared<PerigeeSurface>(Vector3(0, 0, 0));
+  BoundVector pars;
+  pars << 0, 0, 0.3, 0.5, particleHypothesis.qOverP(1_GeV, 1_e), 0_ns;
+  BoundTrackParameters params(start, pars, makeCovariance(),
+                              particleHypothesis);
+  auto plane = Surface::makeShared<PlaneSurface>(
+      params.position(geoContext) + 1_m * params.direction(),
+      params.direction());
+
+  // homogeneous fields are accepted without checking the end point
+  ConstantBField constantField(Vector3(0, 0, 2_T));
+  auto constantCache = constantField.makeCache(magFieldContext);
+  BOOST_CHECK(detail::tryTransportAlongHelix(geoContext, params, *plane,
+                                             constantField, constantCache,
+                                             1e-4, 1e-9)
+                  .has_value());
+
+  NullBField nullField;
+  auto nullCache = nullField.makeCache(magFieldContext);
+  auto straight = detail::tryTransportAlongHelix(
+      geoContext, params, *plane, nullField, nullCache, 1e-4, 1e-9);
+  BOOST_REQUIRE(straight.has_value());
+  CHECK_CLOSE_ABS(straight->position(geoContext),
+                  Vector3(params.position(geoContext) +
+                          1_m * params.direction()),
+                  1_nm);
+
+  // the field of a finite solenoid varies over one meter
+  SolenoidBField::Config solenoidConfig;
+  solenoidConfig.radius = 1.2_m;
+  solenoidConfig.length = 2_m;
+  solenoidConfig.nCoils = 1000;
+  solenoidConfig.bMagCenter = 2_T;
+  SolenoidBField solenoid(solenoidConfig);
+  auto solenoidCache = solenoid.makeCache(magFieldContext);
+  BOOST_CHECK(!detail::tryTransportAlongHelix(geoContext, params, *plane,
+                                              solenoid, solenoidCache, 1e-4,
+                                              1e-9)
+                   .has_value());
+  // but is homogeneous within a loose tolerance close to the center
+  auto closePlane = Surface::makeShared<PlaneSurface>(
+      params.position(geoContext) + 1_mm * params.direction(),
+      params.direction());
+  BOOST_CHECK(detail::tryTransportAlongHelix(geoContext, params, *closePlane,
+                                             solenoid, solenoidCache, 1e-2,
+                                             1e-9)
+                  .has_value());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
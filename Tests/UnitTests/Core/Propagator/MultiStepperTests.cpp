@@ -260,6 +260,82 @@ BOOST_AUTO_TEST_CASE(multi_eigen_vs_single_eigen) {
   test_multi_stepper_vs_eigen_stepper<MultiStepperLoop>();
 }
 
+////////////////////////////////////////////////////////////////////
+// Compare the Multi-Stepper against independent Eigen-Steppers for
+// components at different and at shared positions
+////////////////////////////////////////////////////////////////////
+template <typename multi_stepper_t>
+void test_multi_stepper_vs_eigen_steppers_distinct_components() {
+  using MultiState = typename multi_stepper_t::State;
+  using MultiStepper = multi_stepper_t;
+
+  // The first components share a position like after the material
+  // convolution of the GSF, more components than fit into one batch
+  const std::size_t n = 2 * MultiStepper::batchSize + 3;
+  std::vector<std::tuple<double, BoundVector, std::optional<BoundSquareMatrix>>>
+      cmps;
+  std::vector<BoundTrackParameters> single_pars;
+  auto surface = Acts::Surface::makeShared<Acts::PlaneSurface>(
+      Vector3::Zero(), Vector3{1., 0., 0.});
+  for (auto i = 0ul; i < n; ++i) {
+    BoundVector pars = BoundVector::Random();
+    if (i < 6) {
+      pars.head<4>() = BoundVector::Ones().head<4>();
+    }
+    pars[eBoundTheta] = 0.5 * M_PI + 0.5 * pars[eBoundTheta];
+    pars[eBoundQOverP] = (i % 2 == 0 ? 1. : -1.) / (1. + i);
+    cmps.push_back({1. / n, pars, BoundSquareMatrix::Identity()});
+    single_pars.emplace_back(surface, pars, BoundSquareMatrix::Identity(),
+                             particleHypothesis);
+  }
+  MultiComponentBoundTrackParameters multi_pars(surface, cmps,
+                                                particleHypothesis);
+
+  MultiStepper multi_stepper(defaultBField);
+  SingleStepper single_stepper(defaultBField);
+  MultiState multi_state(geoCtx, magCtx, defaultBField, multi_pars,
+                         defaultStepSize);
+  std::vector<SingleStepper::State> single_states;
+  for (const auto &pars : single_pars) {
+    single_states.emplace_back(geoCtx, defaultBField->makeCache(magCtx), pars,
+                               defaultStepSize);
+  }
+
+  for (auto cmp : multi_stepper.componentIterable(multi_state)) {
+    cmp.status() = Acts::Intersection3D::Status::reachable;
+  }
+
+  for (int i = 0; i < 10; ++i) {
+    auto multi_prop_state = DummyPropState(defaultNDir, multi_state);
+    auto multi_result = multi_stepper.step(multi_prop_state, mockNavigator);
+    BOOST_REQUIRE(multi_result.ok());
+    BOOST_REQUIRE_EQUAL(multi_state.components.size(), n);
+
+    double path = 0.;
+    for (auto j = 0ul; j < n; ++j) {
+      auto single_prop_state = DummyPropState(defaultNDir, single_states[j]);
+      auto single_result =
+          single_stepper.step(single_prop_state, mockNavigator);
+      BOOST_REQUIRE(single_result.ok());
+      path += multi_state.components[j].weight * *single_result;
+
+      const auto &a = single_states[j];
+      const auto &b = multi_state.components[j].state;
+      BOOST_CHECK_EQUAL(a.pars, b.pars);
+      BOOST_CHECK_EQUAL(a.jacTransport, b.jacTransport);
+      BOOST_CHECK_EQUAL(a.derivative, b.derivative);
+      BOOST_CHECK_EQUAL(a.pathAccumulated, b.pathAccumulated);
+      BOOST_CHECK_EQUAL(a.stepSize.accuracy(), b.stepSize.accuracy());
+      BOOST_CHECK_EQUAL(a.stepSize.nStepTrials, b.stepSize.nStepTrials);
+    }
+    BOOST_CHECK_EQUAL(path, *multi_result);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(multi_eigen_vs_single_eigen_distinct_components) {
+  test_multi_stepper_vs_eigen_steppers_distinct_components<MultiStepperLoop>();
+}
+
 /////////////////////////////
 // Test stepsize accessors
 /////////////////////////////
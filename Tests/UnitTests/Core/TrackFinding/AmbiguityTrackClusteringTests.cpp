@@ -0,0 +1,101 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Tests/CommonHelpers/ThreadExecutor.hpp"
+#include "Acts/TrackFinding/detail/AmbiguityTrackClustering.hpp"
+
+#include <map>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace Acts {
+namespace Test {
+
+namespace {
+
+using TrackMap = std::multimap<int, std::pair<int, std::vector<int>>>;
+
+TrackMap makeTracks(std::size_t nTracks, int nHits, std::uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<std::size_t> nMeasDist(7, 12);
+  std::uniform_int_distribution<int> hitDist(0, nHits - 1);
+
+  TrackMap trackMap;
+  for (std::size_t iTrack = 0; iTrack < nTracks; ++iTrack) {
+    std::set<int> hits;
+    std::size_t nMeas = nMeasDist(rng);
+    while (hits.size() < nMeas) {
+      hits.insert(hitDist(rng));
+    }
+    std::vector<int> trackHits(hits.begin(), hits.end());
+    trackMap.emplace(static_cast<int>(nMeas),
+                     std::make_pair(static_cast<int>(iTrack), trackHits));
+  }
+  return trackMap;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(connected_track_components) {
+  // Tracks 0 and 2 share a hit, track 1 is connected to track 2 only through
+  // track 3
+  TrackMap trackMap;
+  trackMap.emplace(3, std::make_pair(0, std::vector<int>{1, 2, 3}));
+  trackMap.emplace(3, std::make_pair(1, std::vector<int>{10, 11, 12}));
+  trackMap.emplace(4, std::make_pair(2, std::vector<int>{3, 4, 5, 6}));
+  trackMap.emplace(2, std::make_pair(3, std::vector<int>{12, 6}));
+  trackMap.emplace(2, std::make_pair(4, std::vector<int>{20, 21}));
+
+  for (std::size_t nChunks : {1u, 5u}) {
+    auto components =
+        detail::connectedTrackComponents(trackMap, threadExecutor(nChunks));
+    std::vector<std::vector<int>> expected = {{2, 1, 0, 3}, {4}};
+    BOOST_CHECK(components == expected);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(parallel_cluster_duplicate_tracks) {
+  for (std::uint32_t seed = 0; seed < 10; ++seed) {
+    // Few hits per track to have components of very different sizes
+    TrackMap trackMap = makeTracks(2000, 100000, seed);
+    auto expected = detail::clusterDuplicateTracks(trackMap);
+
+    for (std::size_t nChunks : {1u, 3u, 16u}) {
+      auto cluster =
+          detail::clusterDuplicateTracks(trackMap, threadExecutor(nChunks));
+      BOOST_CHECK(cluster == expected);
+    }
+    BOOST_CHECK(detail::clusterDuplicateTracks(trackMap, {}) == expected);
+
+    // Every cluster is contained in a single component
+    auto components = detail::connectedTrackComponents(trackMap);
+    std::map<int, std::size_t> componentOfTrack;
+    std::size_t nTracks = 0;
+    for (std::size_t i = 0; i < components.size(); ++i) {
+      for (int track : components[i]) {
+        componentOfTrack[track] = i;
+      }
+      nTracks += components[i].size();
+    }
+    BOOST_CHECK_EQUAL(nTracks, trackMap.size());
+    BOOST_CHECK_EQUAL(componentOfTrack.size(), trackMap.size());
+    for (const auto& [primary, tracks] : expected) {
+      for (int track : tracks) {
+        BOOST_CHECK_EQUAL(componentOfTrack.at(track),
+                          componentOfTrack.at(primary));
+      }
+    }
+  }
+}
+
+}  // namespace Test
+}  // namespace Acts
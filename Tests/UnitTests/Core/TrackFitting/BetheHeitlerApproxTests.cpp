@@ -0,0 +1,102 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/TrackFitting/BetheHeitlerApprox.hpp"
+
+#include <cmath>
+#include <vector>
+
+namespace {
+
+std::vector<Acts::ActsScalar> makeXOverX0s() {
+  // covers the thin material, both parameterizations and the cap
+  std::vector<Acts::ActsScalar> xs = {0., 0.00005, 0.001, 0.002, 0.1, 0.2};
+  for (double x = 0.0003; x < 0.3; x *= 1.07) {
+    xs.push_back(x);
+  }
+  return xs;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TrackFittingBetheHeitlerApprox)
+
+BOOST_AUTO_TEST_CASE(BatchedEqualsScalar) {
+  const auto approx = Acts::makeDefaultBetheHeitlerApprox();
+  const auto xs = makeXOverX0s();
+
+  Acts::detail::GaussianMixtureBatch batch;
+  Acts::detail::evaluateMixtures(approx, xs.data(), xs.size(), batch);
+  BOOST_REQUIRE_EQUAL(batch.size(), xs.size());
+
+  for (std::size_t k = 0; k < xs.size(); ++k) {
+    const auto mixture = approx.mixture(xs[k]);
+    BOOST_REQUIRE_EQUAL(batch.sizes[k], mixture.size());
+    double weightSum = 0;
+    for (std::size_t i = 0; i < mixture.size(); ++i) {
+      const std::size_t idx = k * batch.maxComponents + i;
+      BOOST_CHECK_EQUAL(batch.weights[idx], mixture[i].weight);
+      BOOST_CHECK_EQUAL(batch.means[idx], mixture[i].mean);
+      BOOST_CHECK_EQUAL(batch.vars[idx], mixture[i].var);
+      weightSum += mixture[i].weight;
+    }
+    BOOST_CHECK_CLOSE(weightSum, 1., 1e-8);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Tabulated) {
+  const auto approx = Acts::makeDefaultBetheHeitlerApprox();
+  const Acts::TabulatedBetheHeitlerApprox<6> tabulated(approx, 512);
+  const auto xs = makeXOverX0s();
+
+  BOOST_CHECK_EQUAL(tabulated.numComponents(), 6);
+  BOOST_CHECK(tabulated.validXOverX0(0.15));
+  BOOST_CHECK(!tabulated.validXOverX0(0.25));
+
+  Acts::detail::GaussianMixtureBatch batch;
+  Acts::detail::evaluateMixtures(tabulated, xs.data(), xs.size(), batch);
+
+  for (std::size_t k = 0; k < xs.size(); ++k) {
+    const auto exact = approx.mixture(xs[k]);
+    const auto interpolated = tabulated.mixture(xs[k]);
+    BOOST_REQUIRE_EQUAL(interpolated.size(), exact.size());
+    BOOST_REQUIRE_EQUAL(batch.sizes[k], exact.size());
+    double weightSum = 0;
+    for (std::size_t i = 0; i < exact.size(); ++i) {
+      BOOST_CHECK_SMALL(interpolated[i].weight - exact[i].weight, 1e-3);
+      BOOST_CHECK_SMALL(interpolated[i].mean - exact[i].mean, 1e-3);
+      BOOST_CHECK_CLOSE(interpolated[i].var, exact[i].var, 1.);
+      weightSum += interpolated[i].weight;
+
+      const std::size_t idx = k * batch.maxComponents + i;
+      BOOST_CHECK_EQUAL(batch.weights[idx], interpolated[i].weight);
+      BOOST_CHECK_EQUAL(batch.means[idx], interpolated[i].mean);
+      BOOST_CHECK_EQUAL(batch.vars[idx], interpolated[i].var);
+    }
+    BOOST_CHECK_CLOSE(weightSum, 1., 1e-8);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(GenericBatch) {
+  // approximations without a batched evaluation use mixture(x)
+  Acts::BetheHeitlerApproxSingleCmp approx;
+  const std::vector<Acts::ActsScalar> xs = {0.0005, 0.001};
+
+  Acts::detail::GaussianMixtureBatch batch;
+  Acts::detail::evaluateMixtures(approx, xs.data(), xs.size(), batch);
+  BOOST_REQUIRE_EQUAL(batch.size(), 2u);
+  for (std::size_t k = 0; k < xs.size(); ++k) {
+    BOOST_CHECK_EQUAL(batch.sizes[k], 1u);
+    BOOST_CHECK_EQUAL(batch.means[k], approx.mixture(xs[k])[0].mean);
+    BOOST_CHECK_EQUAL(batch.vars[k], approx.mixture(xs[k])[0].var);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -20,6 +20,8 @@
 
 #include <cmath>
 #include <cstddef>
+#include <limits>
+#include <vector>
 
 namespace {
 
@@ -123,4 +125,115 @@ BOOST_AUTO_TEST_CASE(Smooth) {
   CHECK_CLOSE_ABS(ts3.smoothedCovariance(), expCov, tol);
 }
 
+BOOST_AUTO_TEST_CASE(SmoothTrajectories) {
+  // Trajectories of different lengths in the same container, smoothed in
+  // lockstep and one by one
+  VectorMultiTrajectory traj;
+  std::vector<std::size_t> batchedEntries;
+  std::vector<std::size_t> singleEntries;
+  for (std::size_t length : {3u, 1u, 5u, 2u, 5u}) {
+    std::vector<BoundVector> predicted;
+    std::vector<BoundVector> filtered;
+    std::vector<BoundMatrix> jacobians;
+    for (std::size_t i = 0; i < length; ++i) {
+      predicted.push_back(BoundVector::Random());
+      filtered.push_back(predicted.back() + 0.1 * BoundVector::Random());
+      jacobians.push_back(BoundMatrix::Identity() +
+                          0.1 * BoundMatrix::Random());
+    }
+    CovarianceMatrix covTrk = CovarianceMatrix::Zero();
+    covTrk.diagonal() << 0.08, 0.3, 1, 1, 1, 1;
+
+    for (auto* entries : {&batchedEntries, &singleEntries}) {
+      auto index = MultiTrajectoryTraits::kInvalid;
+      for (std::size_t i = 0; i < length; ++i) {
+        index = traj.addTrackState(TrackStatePropMask::All, index);
+        auto ts = traj.getTrackState(index);
+        ts.predicted() = predicted[i];
+        ts.predictedCovariance() = 2 * covTrk;
+        ts.filtered() = filtered[i];
+        ts.filteredCovariance() = covTrk;
+        ts.jacobian() = jacobians[i];
+      }
+      entries->push_back(index);
+    }
+  }
+
+  GainMatrixSmoother smoother;
+  auto results = smoother.smoothTrajectories(tgContext, traj, batchedEntries);
+  BOOST_REQUIRE_EQUAL(results.size(), batchedEntries.size());
+  for (std::size_t t = 0; t < batchedEntries.size(); ++t) {
+    BOOST_CHECK(results[t].ok());
+    BOOST_CHECK(smoother(tgContext, traj, singleEntries[t]).ok());
+
+    std::vector<std::size_t> batchedStates;
+    std::vector<std::size_t> singleStates;
+    traj.visitBackwards(batchedEntries[t], [&](const auto& ts) {
+      batchedStates.push_back(ts.index());
+    });
+    traj.visitBackwards(singleEntries[t], [&](const auto& ts) {
+      singleStates.push_back(ts.index());
+    });
+    BOOST_REQUIRE_EQUAL(batchedStates.size(), singleStates.size());
+    for (std::size_t i = 0; i < batchedStates.size(); ++i) {
+      auto batched = traj.getTrackState(batchedStates[i]);
+      auto single = traj.getTrackState(singleStates[i]);
+      CHECK_CLOSE_ABS(batched.smoothed(), single.smoothed(), 1e-12);
+      CHECK_CLOSE_ABS(batched.smoothedCovariance(),
+                      single.smoothedCovariance(), 1e-12);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(SmoothTrajectoriesFailure) {
+  // A failing trajectory is dropped without affecting the others
+  VectorMultiTrajectory traj;
+  std::vector<std::size_t> entries;
+  CovarianceMatrix covTrk = CovarianceMatrix::Zero();
+  covTrk.diagonal() << 0.08, 0.3, 1, 1, 1, 1;
+  for (std::size_t t = 0; t < 3; ++t) {
+    auto index = MultiTrajectoryTraits::kInvalid;
+    for (std::size_t i = 0; i < 4; ++i) {
+      index = traj.addTrackState(TrackStatePropMask::All, index);
+      auto ts = traj.getTrackState(index);
+      ts.predicted() = BoundVector::Random();
+      ts.predictedCovariance() = 2 * covTrk;
+      ts.filtered() = ts.predicted() + 0.1 * BoundVector::Random();
+      ts.filteredCovariance() = covTrk;
+      ts.smoothed() = BoundVector::Zero();
+      ts.jacobian() = BoundMatrix::Identity();
+    }
+    entries.push_back(index);
+  }
+  // the second trajectory fails at the first smoothing step
+  traj.getTrackState(entries[1]).predictedCovariance()(0, 0) =
+      std::numeric_limits<double>::quiet_NaN();
+
+  VectorMultiTrajectory reference = traj;
+
+  GainMatrixSmoother smoother;
+  auto results = smoother.smoothTrajectories(tgContext, traj, entries);
+  BOOST_REQUIRE_EQUAL(results.size(), 3u);
+  BOOST_CHECK(results[0].ok());
+  BOOST_CHECK(!results[1].ok());
+  BOOST_CHECK(results[2].ok());
+
+  for (std::size_t t : {0u, 2u}) {
+    BOOST_CHECK(smoother(tgContext, reference, entries[t]).ok());
+    traj.visitBackwards(entries[t], [&](const auto& ts) {
+      auto expected = reference.getTrackState(ts.index());
+      CHECK_CLOSE_ABS(ts.smoothed(), expected.smoothed(), 1e-12);
+      CHECK_CLOSE_ABS(ts.smoothedCovariance(), expected.smoothedCovariance(),
+                      1e-12);
+    });
+  }
+
+  // the states before the failure are not smoothed
+  traj.visitBackwards(entries[1], [&](const auto& ts) {
+    if (ts.index() != entries[1]) {
+      BOOST_CHECK_EQUAL(ts.smoothed(), BoundVector::Zero());
+    }
+  });
+}
+
 BOOST_AUTO_TEST_SUITE_END()
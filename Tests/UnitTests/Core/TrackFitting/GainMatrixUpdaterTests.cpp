@@ -23,7 +23,9 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <utility>
+#include <vector>
 
 namespace {
 
@@ -94,4 +96,46 @@ BOOST_AUTO_TEST_CASE(Update) {
   CHECK_CLOSE_ABS(ts.chi2(), 1.33958, 1e-4);
 }
 
+BOOST_AUTO_TEST_CASE(UpdateBatch) {
+  // Mixed 1d and 2d measurements, updated in batches and one by one
+  VectorMultiTrajectory traj;
+  std::vector<VectorMultiTrajectory::TrackStateProxy> batched;
+  std::vector<VectorMultiTrajectory::TrackStateProxy> single;
+  for (std::size_t i = 0; i < 7; ++i) {
+    ParametersVector trkPar = ParametersVector::Random();
+    CovarianceMatrix trkCov = CovarianceMatrix::Zero();
+    trkCov.diagonal() = ParametersVector::Random().cwiseAbs();
+    trkCov.diagonal().array() += 0.1;
+
+    SourceLink sourceLink{TestSourceLink(eBoundLoc0, 0.1 * i, 0.04)};
+    if (i % 3 != 0) {
+      sourceLink = SourceLink{TestSourceLink(eBoundLoc1, eBoundTheta,
+                                             Vector2(-0.1, 0.01 * i),
+                                             Vector2(0.04, 0.1).asDiagonal())};
+    }
+
+    for (auto* trackStates : {&batched, &single}) {
+      auto ts = traj.getTrackState(traj.addTrackState());
+      ts.predicted() = trkPar;
+      ts.predictedCovariance() = trkCov;
+      testSourceLinkCalibrator<VectorMultiTrajectory>(
+          tgContext, CalibrationContext{}, sourceLink, ts);
+      trackStates->push_back(ts);
+    }
+  }
+
+  GainMatrixUpdater updater;
+  auto results = updater.updateTrackStates(tgContext, batched);
+  BOOST_REQUIRE_EQUAL(results.size(), batched.size());
+  for (std::size_t i = 0; i < batched.size(); ++i) {
+    BOOST_CHECK(results[i].ok());
+    BOOST_CHECK(
+        updater.operator()<VectorMultiTrajectory>(tgContext, single[i]).ok());
+    CHECK_CLOSE_ABS(batched[i].filtered(), single[i].filtered(), 1e-12);
+    CHECK_CLOSE_ABS(batched[i].filteredCovariance(),
+                    single[i].filteredCovariance(), 1e-12);
+    CHECK_CLOSE_ABS(batched[i].chi2(), single[i].chi2(), 1e-12);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -12,6 +12,7 @@
 #include "Acts/Definitions/TrackParametrization.hpp"
 #include "Acts/Definitions/Units.hpp"
 #include "Acts/TrackFitting/GsfMixtureReduction.hpp"
+#include "Acts/TrackFitting/detail/KlMixtureReduction.hpp"
 #include "Acts/TrackFitting/detail/SymmetricKlDistanceMatrix.hpp"
 
 #include <algorithm>
@@ -19,6 +20,7 @@
 #include <cstddef>
 #include <memory>
 #include <numeric>
+#include <random>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -164,6 +166,59 @@ BOOST_AUTO_TEST_CASE(test_mixture_reduction) {
   BOOST_CHECK_CLOSE(cmps[0].weight, 1.0, 1.e-8);
 }
 
+BOOST_AUTO_TEST_CASE(test_kl_reducer_matches_distance_matrix) {
+  // Reference: the greedy reduction with the full distance matrix
+  auto reduceWithMatrix = [](std::vector<GsfComponent> &cmps,
+                             std::size_t maxCmps, const auto &desc) {
+    const auto proj = [](auto &a) -> decltype(auto) { return a; };
+    detail::SymmetricKLDistanceMatrix distances(cmps, proj);
+    for (auto remaining = cmps.size(); remaining > maxCmps; --remaining) {
+      const auto [minI, minJ] = distances.minDistancePair();
+      cmps[minI] = detail::mergeComponents(cmps[minI], cmps[minJ], proj, desc);
+      distances.recomputeAssociatedDistances(minI, cmps, proj);
+      cmps[minJ].weight = -1.0;
+      distances.maskAssociatedDistances(minJ);
+    }
+    std::sort(cmps.begin(), cmps.end(), [](const auto &a, const auto &b) {
+      return a.weight < b.weight;
+    });
+    cmps.erase(std::remove_if(cmps.begin(), cmps.end(),
+                              [](const auto &a) { return a.weight == -1.0; }),
+               cmps.end());
+  };
+
+  std::mt19937 rng(1234);
+  std::uniform_real_distribution<double> uniform(0.5, 1.5);
+  detail::AngleDescription<Surface::Plane>::Desc desc;
+  detail::KLDistanceMixtureReducer reducer;
+
+  // The reducer is reused to check that no state leaks between calls
+  for (std::size_t nCmps : {144u, 20u, 37u}) {
+    std::vector<GsfComponent> cmps;
+    for (std::size_t i = 0; i < nCmps; ++i) {
+      GsfComponent cmp;
+      cmp.weight = uniform(rng);
+      cmp.boundPars = BoundVector::Constant(uniform(rng));
+      // Some components with identical q/p to have ties
+      cmp.boundPars[eBoundQOverP] = 1. / (i % 5 == 0 ? 1. : uniform(rng));
+      cmp.boundCov = BoundSquareMatrix::Identity() * uniform(rng);
+      cmp.boundCov(eBoundQOverP, eBoundQOverP) = 0.01 * uniform(rng);
+      cmps.push_back(cmp);
+    }
+
+    auto expected = cmps;
+    reduceWithMatrix(expected, 12, desc);
+    reducer.reduce(cmps, 12, desc);
+
+    BOOST_REQUIRE_EQUAL(cmps.size(), expected.size());
+    for (std::size_t i = 0; i < cmps.size(); ++i) {
+      BOOST_CHECK_EQUAL(cmps[i].weight, expected[i].weight);
+      BOOST_CHECK(cmps[i].boundPars == expected[i].boundPars);
+      BOOST_CHECK(cmps[i].boundCov == expected[i].boundCov);
+    }
+  }
+}
+
 BOOST_AUTO_TEST_CASE(test_weight_cut_reduction) {
   auto dummy = Acts::Surface::makeShared<PlaneSurface>(Vector3{0, 0, 0},
                                                        Vector3{1, 0, 0});
@@ -96,6 +96,14 @@ using GSF =
 const GSF gsfZero(makeConstantFieldPropagator<Stepper>(tester.geometry, 0_T),
                   makeDefaultBetheHeitlerApprox());
 
+using TabulatedGSF =
+    GaussianSumFitter<Propagator, TabulatedBetheHeitlerApprox<6>,
+                      VectorMultiTrajectory>;
+
+const TabulatedGSF tabulatedGsfZero(
+    makeConstantFieldPropagator<Stepper>(tester.geometry, 0_T),
+    TabulatedBetheHeitlerApprox<6>(makeDefaultBetheHeitlerApprox()));
+
 std::default_random_engine rng(42);
 
 auto makeDefaultGsfOptions() {
@@ -175,6 +183,14 @@ BOOST_AUTO_TEST_CASE(ZeroFieldWithSurfaceForward) {
                                           true, false, false);
 }
 
+BOOST_AUTO_TEST_CASE(ZeroFieldWithSurfaceForwardTabulated) {
+  auto multi_pars = makeParameters();
+  auto options = makeDefaultGsfOptions();
+
+  tester.test_ZeroFieldWithSurfaceForward(tabulatedGsfZero, options, multi_pars,
+                                          rng, true, false, false);
+}
+
 BOOST_AUTO_TEST_CASE(ZeroFieldWithSurfaceBackward) {
   auto multi_pars = makeParameters();
   auto options = makeDefaultGsfOptions();
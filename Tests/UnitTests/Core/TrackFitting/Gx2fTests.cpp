@@ -30,8 +30,10 @@
 #include "Acts/Tests/CommonHelpers/MeasurementsCreator.hpp"
 #include "Acts/Tests/CommonHelpers/PredefinedMaterials.hpp"
 #include "Acts/TrackFitting/GlobalChiSquareFitter.hpp"
+#include "Acts/TrackFitting/detail/Gx2fNormalEquations.hpp"
 #include "Acts/Utilities/Logger.hpp"
 
+#include <algorithm>
 #include <vector>
 
 #include "FitterTestsCommon.hpp"
@@ -177,6 +179,25 @@ struct Detector {
   std::shared_ptr<const TrackingGeometry> geometry;
 };
 
+/// Additional parameter for one surface: an offset of the measurement in loc0
+struct SurfaceOffset {
+  GeometryIdentifier geoId;
+
+  bool operator()(const GeometryContext& /*gctx*/,
+                  Experimental::Gx2FitterExtensions<
+                      VectorMultiTrajectory>::ConstTrackStateProxy state,
+                  ActsDynamicMatrix& derivatives,
+                  ActsDynamicVector& priorVariances) const {
+    if (state.referenceSurface().geometryId() != geoId) {
+      return false;
+    }
+    derivatives = ActsDynamicMatrix::Zero(state.calibratedSize(), 1);
+    derivatives(0, 0) = 1;
+    priorVariances = ActsDynamicVector::Constant(1, 10_mm * 10_mm);
+    return true;
+  }
+};
+
 BOOST_AUTO_TEST_SUITE(Gx2fTest)
 ACTS_LOCAL_LOGGER(Acts::getDefaultLogger("Gx2fTests", logLevel))
 
@@ -663,6 +684,190 @@ BOOST_AUTO_TEST_CASE(relChi2changeCutOff) {
 
   ACTS_INFO("*** Test: relChi2changeCutOff -- Finish");
 }
+
+BOOST_AUTO_TEST_CASE(NormalEquationsBlockBanded) {
+  ACTS_INFO("*** Test: NormalEquationsBlockBanded -- Start");
+
+  // Global parameters and blocks, each block couples to its neighbours
+  const std::size_t nGlobal = 3;
+  const std::vector<std::size_t> sizes = {2, 3, 1, 2, 2};
+  std::vector<std::size_t> offsets = {nGlobal};
+  for (std::size_t size : sizes) {
+    offsets.push_back(offsets.back() + size);
+  }
+  const std::size_t n = offsets.back();
+
+  // Dense positive definite reference. Each group of rows of the Jacobian
+  // depends on the global parameters and on the blocks k and k + 1 only, so
+  // the normal matrix is zero outside of the band and the neighbouring
+  // blocks are coupled.
+  const std::size_t nRows = 3;
+  ActsDynamicMatrix jacobian =
+      ActsDynamicMatrix::Zero(nRows * sizes.size(), n);
+  for (std::size_t k = 0; k < sizes.size(); ++k) {
+    const std::size_t end = std::min(k + 2, sizes.size());
+    jacobian.block(nRows * k, 0, nRows, nGlobal).setRandom();
+    jacobian.block(nRows * k, offsets[k], nRows, offsets[end] - offsets[k])
+        .setRandom();
+  }
+  ActsDynamicMatrix dense = jacobian.transpose() * jacobian;
+  for (std::size_t k = 0; k < sizes.size(); ++k) {
+    for (std::size_t j = 0; j < sizes.size(); ++j) {
+      const auto block =
+          dense.block(offsets[k], offsets[j], sizes[k], sizes[j]);
+      if (j + 1 < k || k + 1 < j) {
+        BOOST_CHECK(block.isZero());
+      } else {
+        BOOST_CHECK(!block.isZero());
+      }
+    }
+  }
+  dense += ActsDynamicMatrix::Identity(n, n);
+  const ActsDynamicVector vector = ActsDynamicVector::Random(n);
+
+  Acts::detail::Gx2fNormalEquations equations(nGlobal, 1);
+  equations.globalMatrix() = dense.topLeftCorner(nGlobal, nGlobal);
+  equations.globalVector() = vector.head(nGlobal);
+  for (std::size_t k = 0; k < sizes.size(); ++k) {
+    BOOST_CHECK_EQUAL(equations.addBlock(sizes[k]), k);
+    equations.couplingMatrix(k) =
+        dense.block(offsets[k], 0, sizes[k], nGlobal);
+    equations.blockVector(k) = vector.segment(offsets[k], sizes[k]);
+    for (std::size_t j = (k > 0 ? k - 1 : 0); j <= k; ++j) {
+      equations.blockMatrix(k, j) =
+          dense.block(offsets[k], offsets[j], sizes[k], sizes[j]);
+    }
+  }
+  BOOST_REQUIRE(equations.solve());
+
+  const ActsDynamicVector expected = dense.llt().solve(vector);
+  const ActsDynamicMatrix expectedCovariance =
+      dense.inverse().topLeftCorner(nGlobal, nGlobal);
+  CHECK_CLOSE_ABS(equations.globalDelta(), expected.head(nGlobal), 1e-10);
+  CHECK_CLOSE_ABS(equations.globalCovariance(), expectedCovariance, 1e-10);
+  for (std::size_t k = 0; k < sizes.size(); ++k) {
+    CHECK_CLOSE_ABS(equations.blockDelta(k),
+                    expected.segment(offsets[k], sizes[k]), 1e-10);
+  }
+
+  // A block without any constraint cannot be solved
+  Acts::detail::Gx2fNormalEquations singular(nGlobal);
+  singular.globalMatrix().setIdentity();
+  singular.addBlock(2);
+  BOOST_CHECK(!singular.solve());
+
+  ACTS_INFO("*** Test: NormalEquationsBlockBanded -- Finish");
+}
+
+BOOST_AUTO_TEST_CASE(FitExtraParameters) {
+  ACTS_INFO("*** Test: FitExtraParameters -- Start");
+
+  std::default_random_engine rng(42);
+
+  ACTS_DEBUG("Create the detector");
+  const std::size_t nSurfaces = 5;
+  Detector detector;
+  detector.geometry = makeToyDetector(geoCtx, nSurfaces);
+
+  ACTS_DEBUG("Set the start parameters for measurement creation and fit");
+  const auto parametersMeasurements = makeParameters();
+  const auto startParametersFit = makeParameters(
+      7_mm, 11_mm, 15_mm, 42_ns, 10_degree, 80_degree, 1_GeV, 1_e);
+
+  ACTS_DEBUG("Create the measurements and shift the one on the third surface");
+  using SimPropagator =
+      Acts::Propagator<Acts::StraightLineStepper, Acts::Navigator>;
+  const SimPropagator simPropagator = makeStraightPropagator(detector.geometry);
+  const auto measurements =
+      createMeasurements(simPropagator, geoCtx, magCtx, parametersMeasurements,
+                         resMapAllPixel, rng);
+  BOOST_REQUIRE_EQUAL(measurements.sourceLinks.size(), nSurfaces);
+  const double shift = 1_mm;
+  auto shiftedMeasurements = measurements.sourceLinks;
+  shiftedMeasurements[2].parameters[0] += shift;
+  const auto sourceLinks = prepareSourceLinks(measurements.sourceLinks);
+  const auto shiftedSourceLinks = prepareSourceLinks(shiftedMeasurements);
+
+  ACTS_DEBUG("Set up the fitter");
+  const Surface* rSurface = &parametersMeasurements.referenceSurface();
+
+  using RecoStepper = EigenStepper<>;
+  const auto recoPropagator =
+      makeConstantFieldPropagator<RecoStepper>(detector.geometry, 0_T);
+
+  using RecoPropagator = decltype(recoPropagator);
+  using Gx2Fitter =
+      Experimental::Gx2Fitter<RecoPropagator, VectorMultiTrajectory>;
+  const Gx2Fitter fitter(recoPropagator, gx2fLogger->clone());
+
+  Experimental::Gx2FitterExtensions<VectorMultiTrajectory> extensions;
+  extensions.calibrator
+      .connect<&testSourceLinkCalibrator<VectorMultiTrajectory>>();
+  TestSourceLink::SurfaceAccessor surfaceAccessor{*detector.geometry};
+  extensions.surfaceAccessor
+      .connect<&TestSourceLink::SurfaceAccessor::operator()>(&surfaceAccessor);
+
+  const Experimental::Gx2FitterOptions gx2fOptions(
+      geoCtx, magCtx, calCtx, extensions, PropagatorPlainOptions(), rSurface,
+      false, false, FreeToBoundCorrection(false), 10, true, 1e-5);
+
+  SurfaceOffset offset{shiftedMeasurements[2].m_geometryId};
+  auto extraExtensions = extensions;
+  extraExtensions.extraParameterDerivatives
+      .connect<&SurfaceOffset::operator()>(&offset);
+  const Experimental::Gx2FitterOptions extraOptions(
+      geoCtx, magCtx, calCtx, extraExtensions, PropagatorPlainOptions(),
+      rSurface, false, false, FreeToBoundCorrection(false), 10, true, 1e-5);
+
+  Acts::TrackContainer tracks{Acts::VectorTrackContainer{},
+                              Acts::VectorMultiTrajectory{}};
+  Acts::TrackContainer extraTracks{Acts::VectorTrackContainer{},
+                                   Acts::VectorMultiTrajectory{}};
+
+  ACTS_DEBUG("Fit the unshifted measurements without additional parameters");
+  const auto res = fitter.fit(sourceLinks.begin(), sourceLinks.end(),
+                              startParametersFit, gx2fOptions, tracks);
+  BOOST_REQUIRE(res.ok());
+
+  ACTS_DEBUG("Fit the shifted measurements with an offset of the surface");
+  const auto extraRes =
+      fitter.fit(shiftedSourceLinks.begin(), shiftedSourceLinks.end(),
+                 startParametersFit, extraOptions, extraTracks);
+  BOOST_REQUIRE(extraRes.ok());
+
+  const auto& track = *res;
+  const auto& extraTrack = *extraRes;
+  BOOST_CHECK_EQUAL(extraTrack.nMeasurements(), nSurfaces);
+  BOOST_CHECK_LT(extraTrack.chi2(), track.chi2() + 1.);
+
+  // The offset absorbs the shift, the track follows the other measurements
+  CHECK_CLOSE_ABS(extraTrack.parameters()[eBoundLoc0],
+                  track.parameters()[eBoundLoc0], 50_um);
+  CHECK_CLOSE_ABS(extraTrack.parameters()[eBoundLoc1],
+                  track.parameters()[eBoundLoc1], 1_um);
+  CHECK_CLOSE_ABS(extraTrack.parameters()[eBoundPhi],
+                  track.parameters()[eBoundPhi], 1e-4);
+  BOOST_CHECK_GT(extraTrack.covariance()(eBoundLoc0, eBoundLoc0),
+                 track.covariance()(eBoundLoc0, eBoundLoc0));
+
+  std::size_t nStatesWithOffset = 0;
+  for (const auto trackState : extraTrack.trackStatesReversed()) {
+    const auto& values = trackState.template component<
+        ActsDynamicVector,
+        hashString(Experimental::Gx2fConstants::gx2fExtraParametersColumn)>();
+    if (trackState.referenceSurface().geometryId() == offset.geoId) {
+      BOOST_REQUIRE_EQUAL(values.size(), 1);
+      CHECK_CLOSE_ABS(values[0], shift, 150_um);
+      ++nStatesWithOffset;
+    } else {
+      BOOST_CHECK_EQUAL(values.size(), 0);
+    }
+  }
+  BOOST_CHECK_EQUAL(nStatesWithOffset, 1u);
+
+  ACTS_INFO("*** Test: FitExtraParameters -- Finish");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace Test
 }  // namespace Acts
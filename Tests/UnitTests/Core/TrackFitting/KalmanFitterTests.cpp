@@ -14,6 +14,7 @@
 #include "Acts/Definitions/Units.hpp"
 #include "Acts/EventData/GenericCurvilinearTrackParameters.hpp"
 #include "Acts/EventData/MultiTrajectory.hpp"
+#include "Acts/EventData/TrackHelpers.hpp"
 #include "Acts/EventData/TrackParameters.hpp"
 #include "Acts/EventData/TrackStatePropMask.hpp"
 #include "Acts/EventData/VectorMultiTrajectory.hpp"
@@ -88,8 +89,46 @@ const auto kfZeroPropagator =
     makeConstantFieldPropagator<ConstantFieldStepper>(tester.geometry, 0_T);
 const auto kfZero = KalmanFitter(kfZeroPropagator, std::move(kfLogger));
 
+// reconstruction propagator and fitter with a magnetic field, also used for
+// the simulation
+const auto kfFieldPropagator =
+    makeConstantFieldPropagator<ConstantFieldStepper>(tester.geometry, 0.5_T);
+const auto kfField = KalmanFitter(
+    kfFieldPropagator, getDefaultLogger("KalmanFilter", Logging::INFO));
+
 std::default_random_engine rng(42);
 
+// Emulates an updated calibration which moves the measurement on one surface
+struct ShiftedCalibrator {
+  GeometryIdentifier geoId;
+  double shift = 0;
+
+  void operator()(const GeometryContext& gctx, const CalibrationContext& cctx,
+                  const SourceLink& sourceLink,
+                  VectorMultiTrajectory::TrackStateProxy trackState) const {
+    testSourceLinkCalibrator<VectorMultiTrajectory>(gctx, cctx, sourceLink,
+                                                    trackState);
+    if (trackState.referenceSurface().geometryId() == geoId) {
+      trackState.effectiveCalibrated()[0] += shift;
+    }
+  }
+};
+
+// Smoother which keeps the filtered parameters, differs from the gain matrix
+// smoother
+Result<void> filteredSmoother(const GeometryContext& /*gctx*/,
+                              VectorMultiTrajectory& trajectory,
+                              std::size_t entryIndex,
+                              const Logger& /*logger*/) {
+  trajectory.applyBackwards(entryIndex, [](auto trackState) {
+    if (trackState.hasFiltered()) {
+      trackState.smoothed() = trackState.filtered();
+      trackState.smoothedCovariance() = trackState.filteredCovariance();
+    }
+  });
+  return Result<void>::success();
+}
+
 auto makeDefaultKalmanFitterOptions() {
   KalmanFitterExtensions<VectorMultiTrajectory> extensions;
   extensions.calibrator
@@ -246,6 +285,227 @@ BOOST_AUTO_TEST_CASE(ZeroFieldWithReverseFiltering) {
   test(0.1_GeV, true, true, false);
 }
 
+BOOST_AUTO_TEST_CASE(Refit) {
+  auto start = makeParameters();
+  auto kfOptions = makeDefaultKalmanFitterOptions();
+  kfOptions.referenceSurface = &start.referenceSurface();
+
+  auto measurements =
+      createMeasurements(tester.simPropagator, tester.geoCtx, tester.magCtx,
+                         start, tester.resolutions, rng);
+  auto sourceLinks = tester.prepareSourceLinks(measurements.sourceLinks);
+
+  Acts::TrackContainer tracks{Acts::VectorTrackContainer{},
+                              Acts::VectorMultiTrajectory{}};
+  auto res =
+      kfZero.fit(sourceLinks.begin(), sourceLinks.end(), start, kfOptions,
+                 tracks);
+  BOOST_REQUIRE(res.ok());
+  const auto& track = *res;
+
+  // Unchanged calibration reproduces the previous fit
+  auto refitRes = kfZero.refit(track, start, kfOptions, tracks);
+  BOOST_REQUIRE(refitRes.ok());
+  const auto& refitted = *refitRes;
+  BOOST_CHECK_EQUAL(refitted.nMeasurements(), track.nMeasurements());
+  BOOST_CHECK_EQUAL(refitted.nTrackStates(), track.nTrackStates());
+  BOOST_CHECK_CLOSE(refitted.chi2(), track.chi2(), 1e-6);
+  CHECK_CLOSE_ABS(refitted.parameters(), track.parameters(), 1e-6);
+  CHECK_CLOSE_ABS(refitted.covariance(), track.covariance(), 1e-9);
+
+  // A small change of the calibration agrees with a fit with propagation
+  ShiftedCalibrator calibrator{measurements.sourceLinks[0].m_geometryId,
+                               10_um};
+  kfOptions.extensions.calibrator.connect<&ShiftedCalibrator::operator()>(
+      &calibrator);
+  auto fullRes = kfZero.fit(sourceLinks.begin(), sourceLinks.end(), start,
+                            kfOptions, tracks);
+  BOOST_REQUIRE(fullRes.ok());
+  const auto& full = *fullRes;
+  auto shiftedRes = kfZero.refit(track, start, kfOptions, tracks);
+  BOOST_REQUIRE(shiftedRes.ok());
+  const auto& shifted = *shiftedRes;
+  BOOST_CHECK_CLOSE(shifted.chi2(), full.chi2(), 1e-3);
+  CHECK_CLOSE_ABS(shifted.parameters(), full.parameters(), 1e-6);
+  CHECK_CLOSE_ABS(shifted.covariance(), full.covariance(), 1e-9);
+
+  // Changes above the threshold are propagated again
+  kfOptions.refitMaxParameterChange = 0;
+  auto fallbackRes = kfZero.refit(track, start, kfOptions, tracks);
+  BOOST_REQUIRE(fallbackRes.ok());
+  const auto& fallback = *fallbackRes;
+  BOOST_CHECK_EQUAL(fallback.chi2(), full.chi2());
+  BOOST_CHECK_EQUAL(fallback.parameters(), full.parameters());
+}
+
+BOOST_AUTO_TEST_CASE(RefitFieldMaterial) {
+  // Bending track with material effects, simulated in the same field
+  auto base = makeParameters();
+  CurvilinearTrackParameters start(base.fourPosition(tester.geoCtx),
+                                   base.phi(), base.theta(), 1_e / 10_GeV,
+                                   base.covariance(), pion);
+  auto kfOptions = makeDefaultKalmanFitterOptions();
+  kfOptions.referenceSurface = &start.referenceSurface();
+  BOOST_REQUIRE(kfOptions.multipleScattering && kfOptions.energyLoss);
+
+  auto measurements =
+      createMeasurements(kfFieldPropagator, tester.geoCtx, tester.magCtx, start,
+                         tester.resolutions, rng);
+  auto sourceLinks = tester.prepareSourceLinks(measurements.sourceLinks);
+  BOOST_REQUIRE_EQUAL(sourceLinks.size(), tester.nMeasurements);
+
+  Acts::TrackContainer tracks{Acts::VectorTrackContainer{},
+                              Acts::VectorMultiTrajectory{}};
+  auto& states = tracks.trackStateContainer();
+  std::size_t nStates = states.size();
+  auto res = kfField.fit(sourceLinks.begin(), sourceLinks.end(), start,
+                         kfOptions, tracks);
+  BOOST_REQUIRE(res.ok());
+  const auto& track = *res;
+  const std::size_t nFitStates = states.size() - nStates;
+
+  // Unchanged calibration reproduces the previous fit
+  nStates = states.size();
+  auto refitRes = kfField.refit(track, start, kfOptions, tracks);
+  BOOST_REQUIRE(refitRes.ok());
+  const auto& refitted = *refitRes;
+  BOOST_CHECK_EQUAL(states.size() - nStates, refitted.nTrackStates());
+  BOOST_CHECK_EQUAL(refitted.nMeasurements(), track.nMeasurements());
+  BOOST_CHECK_EQUAL(refitted.nTrackStates(), track.nTrackStates());
+  BOOST_CHECK_CLOSE(refitted.chi2(), track.chi2(), 1e-6);
+  CHECK_CLOSE_OR_SMALL(refitted.parameters(), track.parameters(), 1e-6,
+                       1e-9);
+  CHECK_CLOSE_OR_SMALL(refitted.covariance(), track.covariance(), 1e-6,
+                       1e-12);
+
+  // A small change of the calibration agrees with a fit with propagation
+  ShiftedCalibrator calibrator{measurements.sourceLinks[0].m_geometryId,
+                               10_um};
+  kfOptions.extensions.calibrator.connect<&ShiftedCalibrator::operator()>(
+      &calibrator);
+  auto fullRes = kfField.fit(sourceLinks.begin(), sourceLinks.end(), start,
+                             kfOptions, tracks);
+  BOOST_REQUIRE(fullRes.ok());
+  const auto& full = *fullRes;
+  auto shiftedRes = kfField.refit(track, start, kfOptions, tracks);
+  BOOST_REQUIRE(shiftedRes.ok());
+  const auto& shifted = *shiftedRes;
+  BOOST_CHECK_CLOSE(shifted.chi2(), full.chi2(), 1e-2);
+  CHECK_CLOSE_OR_SMALL(shifted.parameters(), full.parameters(), 1e-4, 1e-6);
+  CHECK_CLOSE_OR_SMALL(shifted.covariance(), full.covariance(), 1e-3, 1e-9);
+
+  // The fallback to the fit with propagation only adds the states of that
+  // fit, the states of the linearized refit are discarded
+  kfOptions.refitMaxParameterChange = 0;
+  nStates = states.size();
+  auto fallbackRes = kfField.refit(track, start, kfOptions, tracks);
+  BOOST_REQUIRE(fallbackRes.ok());
+  const auto& fallback = *fallbackRes;
+  BOOST_CHECK_EQUAL(states.size() - nStates, nFitStates);
+  BOOST_CHECK_EQUAL(fallback.chi2(), full.chi2());
+  BOOST_CHECK_EQUAL(fallback.parameters(), full.parameters());
+}
+
+BOOST_AUTO_TEST_CASE(FilteredOutput) {
+  // The fitted parameters of the filtered output equal the smoothed fit,
+  // including the material effects between the first state and the target
+  for (bool materialEffects : {false, true}) {
+    BOOST_TEST_CONTEXT("material effects " << materialEffects) {
+      auto start = makeParameters();
+      auto kfOptions = makeDefaultKalmanFitterOptions();
+      kfOptions.referenceSurface = &start.referenceSurface();
+      kfOptions.multipleScattering = materialEffects;
+      kfOptions.energyLoss = materialEffects;
+
+      auto measurements =
+          createMeasurements(tester.simPropagator, tester.geoCtx,
+                             tester.magCtx, start, tester.resolutions, rng);
+      auto sourceLinks = tester.prepareSourceLinks(measurements.sourceLinks);
+
+      Acts::TrackContainer tracks{Acts::VectorTrackContainer{},
+                                  Acts::VectorMultiTrajectory{}};
+      auto smoothedRes = kfZero.fit(sourceLinks.begin(), sourceLinks.end(),
+                                    start, kfOptions, tracks);
+      BOOST_REQUIRE(smoothedRes.ok());
+      const auto& smoothedTrack = *smoothedRes;
+
+      kfOptions.outputPolicy = KalmanFitterOutputPolicy::filtered;
+      auto res = kfZero.fit(sourceLinks.begin(), sourceLinks.end(), start,
+                            kfOptions, tracks);
+      BOOST_REQUIRE(res.ok());
+      auto track = *res;
+      BOOST_CHECK(track.hasReferenceSurface());
+      BOOST_CHECK_EQUAL(track.nMeasurements(), smoothedTrack.nMeasurements());
+      BOOST_CHECK_EQUAL(track.nTrackStates(), smoothedTrack.nTrackStates());
+      BOOST_CHECK_CLOSE(track.chi2(), smoothedTrack.chi2(), 1e-6);
+      for (const auto trackState : track.trackStatesReversed()) {
+        BOOST_CHECK(trackState.hasFiltered());
+        BOOST_CHECK(!trackState.hasSmoothed());
+        // detector surfaces are referenced without ownership
+        BOOST_CHECK(!trackState.ownsReferenceSurface());
+      }
+      CHECK_CLOSE_OR_SMALL(track.parameters(), smoothedTrack.parameters(),
+                           1e-6, 1e-9);
+      CHECK_CLOSE_OR_SMALL(track.covariance(), smoothedTrack.covariance(),
+                           1e-6, 1e-12);
+
+      // Smoothing on demand reproduces the smoothed fit
+      auto smoothRes = smoothTrack(tester.geoCtx, track, KalmanSmoother{});
+      BOOST_REQUIRE(smoothRes.ok());
+      auto states = track.trackStatesReversed();
+      auto smoothedStates = smoothedTrack.trackStatesReversed();
+      auto it = smoothedStates.begin();
+      for (const auto trackState : states) {
+        BOOST_REQUIRE(it != smoothedStates.end());
+        const auto smoothedState = *it;
+        BOOST_REQUIRE(trackState.hasSmoothed());
+        CHECK_CLOSE_ABS(trackState.smoothed(), smoothedState.smoothed(), 1e-9);
+        CHECK_CLOSE_ABS(trackState.smoothedCovariance(),
+                        smoothedState.smoothedCovariance(), 1e-12);
+        ++it;
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(FilteredOutputConfiguredSmoother) {
+  // The filtered output uses the configured smoother for the fitted
+  // parameters
+  auto start = makeParameters();
+  auto kfOptions = makeDefaultKalmanFitterOptions();
+  kfOptions.referenceSurface = &start.referenceSurface();
+  kfOptions.extensions.smoother.connect<&filteredSmoother>();
+
+  auto measurements =
+      createMeasurements(tester.simPropagator, tester.geoCtx, tester.magCtx,
+                         start, tester.resolutions, rng);
+  auto sourceLinks = tester.prepareSourceLinks(measurements.sourceLinks);
+
+  Acts::TrackContainer tracks{Acts::VectorTrackContainer{},
+                              Acts::VectorMultiTrajectory{}};
+  auto smoothedRes = kfZero.fit(sourceLinks.begin(), sourceLinks.end(), start,
+                                kfOptions, tracks);
+  BOOST_REQUIRE(smoothedRes.ok());
+  const auto& smoothedTrack = *smoothedRes;
+
+  kfOptions.outputPolicy = KalmanFitterOutputPolicy::filtered;
+  auto res = kfZero.fit(sourceLinks.begin(), sourceLinks.end(), start,
+                        kfOptions, tracks);
+  BOOST_REQUIRE(res.ok());
+  auto track = *res;
+  CHECK_CLOSE_OR_SMALL(track.parameters(), smoothedTrack.parameters(), 1e-6,
+                       1e-9);
+  CHECK_CLOSE_OR_SMALL(track.covariance(), smoothedTrack.covariance(), 1e-6,
+                       1e-12);
+
+  // The gain matrix smoother gives different parameters
+  kfOptions.extensions = makeDefaultKalmanFitterOptions().extensions;
+  auto gainMatrixRes = kfZero.fit(sourceLinks.begin(), sourceLinks.end(),
+                                  start, kfOptions, tracks);
+  BOOST_REQUIRE(gainMatrixRes.ok());
+  BOOST_CHECK(!gainMatrixRes->covariance().isApprox(track.covariance()));
+}
+
 // TODO this is not really Kalman fitter specific. is probably better tested
 // with a synthetic trajectory.
 BOOST_AUTO_TEST_CASE(GlobalCovariance) {
@@ -0,0 +1,89 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Utilities/AllocationCounter.hpp"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace Acts {
+namespace Test {
+
+BOOST_AUTO_TEST_SUITE(AllocationCounterTests)
+
+BOOST_AUTO_TEST_CASE(Arithmetic) {
+  AllocationCount a{3, 2, 100};
+  AllocationCount b{1, 1, 40};
+
+  AllocationCount sum = a + b;
+  BOOST_CHECK_EQUAL(sum.allocations, 4u);
+  BOOST_CHECK_EQUAL(sum.deallocations, 3u);
+  BOOST_CHECK_EQUAL(sum.bytes, 140u);
+
+  AllocationCount diff = a - b;
+  BOOST_CHECK_EQUAL(diff.allocations, 2u);
+  BOOST_CHECK_EQUAL(diff.deallocations, 1u);
+  BOOST_CHECK_EQUAL(diff.bytes, 60u);
+}
+
+BOOST_AUTO_TEST_CASE(ScopedCounting) {
+  AllocationCount sink;
+  {
+    ScopedAllocationCounter counter(&sink);
+    auto ptr = std::make_unique<std::vector<double>>(100);
+    if (allocationCountingEnabled()) {
+      // the vector object and its buffer
+      BOOST_CHECK_GE(counter.count().allocations, 2u);
+      BOOST_CHECK_GE(counter.count().bytes, 100 * sizeof(double));
+    } else {
+      BOOST_CHECK_EQUAL(counter.count().allocations, 0u);
+    }
+  }
+
+  if (allocationCountingEnabled()) {
+    BOOST_CHECK_GE(sink.allocations, 2u);
+    BOOST_CHECK_GE(sink.deallocations, 2u);
+  } else {
+    BOOST_CHECK_EQUAL(sink.allocations, 0u);
+    BOOST_CHECK_EQUAL(sink.deallocations, 0u);
+    BOOST_CHECK_EQUAL(sink.bytes, 0u);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ThreadLocalCounting) {
+  ScopedAllocationCounter counter;
+  AllocationCount before = globalAllocationCount();
+
+  // allocations on another thread do not show up in this thread's counter,
+  // but do show up in the global count
+  std::thread worker([]() {
+    std::vector<std::unique_ptr<int>> values;
+    for (int i = 0; i < 10; ++i) {
+      values.push_back(std::make_unique<int>(i));
+    }
+  });
+  // the thread object itself might allocate on this thread
+  AllocationCount spawn = counter.count();
+  worker.join();
+  AllocationCount joined = counter.count();
+
+  BOOST_CHECK_EQUAL(joined.allocations, spawn.allocations);
+  if (allocationCountingEnabled()) {
+    BOOST_CHECK_GE((globalAllocationCount() - before).allocations, 10u);
+  } else {
+    BOOST_CHECK_EQUAL(globalAllocationCount().allocations, 0u);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
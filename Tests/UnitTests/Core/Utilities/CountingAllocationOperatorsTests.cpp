@@ -0,0 +1,129 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Utilities/AllocationCounter.hpp"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// Install the counting allocation functions in this test executable, unless
+// ActsCore already provides them
+#if !defined(ACTS_ENABLE_ALLOCATION_COUNTING)
+#include "Acts/Utilities/detail/CountingAllocationOperators.hpp"
+#endif
+
+namespace Acts {
+namespace Test {
+
+namespace {
+
+struct alignas(64) OverAligned {
+  std::array<char, 80> data;
+};
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(CountingAllocationOperatorsTests)
+
+BOOST_AUTO_TEST_CASE(CountAllocations) {
+  BOOST_CHECK(allocationCountingEnabled());
+
+  // Keep the checks out of the counted scopes, they might allocate
+  AllocationCount allocated;
+  AllocationCount released;
+  {
+    ScopedAllocationCounter counter;
+    auto buffer = std::make_unique<std::array<char, 1000>>();
+    allocated = counter.count();
+    buffer.reset();
+    released = counter.count();
+  }
+  BOOST_CHECK_EQUAL(allocated.allocations, 1u);
+  BOOST_CHECK_EQUAL(allocated.deallocations, 0u);
+  BOOST_CHECK_EQUAL(allocated.bytes, 1000u);
+  BOOST_CHECK_EQUAL(released.allocations, 1u);
+  BOOST_CHECK_EQUAL(released.deallocations, 1u);
+
+  // Over-aligned types use the aligned operator new
+  AllocationCount aligned;
+  {
+    ScopedAllocationCounter counter;
+    auto value = std::make_unique<OverAligned>();
+    aligned = counter.count();
+    BOOST_CHECK_EQUAL(reinterpret_cast<std::uintptr_t>(value.get()) % 64, 0u);
+  }
+  BOOST_CHECK_EQUAL(aligned.allocations, 1u);
+  BOOST_CHECK_EQUAL(aligned.bytes, sizeof(OverAligned));
+}
+
+BOOST_AUTO_TEST_CASE(NestedScopes) {
+  AllocationCount outerSink;
+  AllocationCount innerSink;
+  AllocationCount inner;
+  AllocationCount outer;
+  {
+    ScopedAllocationCounter outerCounter(&outerSink);
+    auto first = std::make_unique<std::array<char, 100>>();
+    {
+      ScopedAllocationCounter innerCounter(&innerSink);
+      auto second = std::make_unique<std::array<char, 200>>();
+      auto third = std::make_unique<std::array<char, 300>>();
+      inner = innerCounter.count();
+    }
+    outer = outerCounter.count();
+  }
+
+  // The inner scope only sees its own allocations, the outer scope also
+  // contains the ones of the inner scope
+  BOOST_CHECK_EQUAL(inner.allocations, 2u);
+  BOOST_CHECK_EQUAL(inner.bytes, 500u);
+  BOOST_CHECK_EQUAL(innerSink.allocations, 2u);
+  BOOST_CHECK_EQUAL(innerSink.deallocations, 2u);
+  BOOST_CHECK_EQUAL(outer.allocations, 3u);
+  BOOST_CHECK_EQUAL(outer.deallocations, 2u);
+  BOOST_CHECK_EQUAL(outer.bytes, 600u);
+  BOOST_CHECK_EQUAL(outerSink.allocations, 3u);
+  BOOST_CHECK_EQUAL(outerSink.deallocations, 3u);
+  BOOST_CHECK_EQUAL(outerSink.bytes, 600u);
+}
+
+BOOST_AUTO_TEST_CASE(OtherThreads) {
+  ScopedAllocationCounter counter;
+  AllocationCount globalBefore = globalAllocationCount();
+
+  AllocationCount worker;
+  std::thread thread([&worker]() {
+    ScopedAllocationCounter workerCounter;
+    std::vector<std::unique_ptr<int>> values;
+    values.reserve(10);
+    for (int i = 0; i < 10; ++i) {
+      values.push_back(std::make_unique<int>(i));
+    }
+    worker = workerCounter.count();
+  });
+  AllocationCount spawned = counter.count();
+  thread.join();
+  AllocationCount joined = counter.count();
+  AllocationCount global = globalAllocationCount() - globalBefore;
+
+  // The allocations of the worker only show up in its own counter and in
+  // the global count
+  BOOST_CHECK_EQUAL(worker.allocations, 11u);
+  BOOST_CHECK_EQUAL(joined.allocations, spawned.allocations);
+  BOOST_CHECK_GE(global.allocations, spawned.allocations + 11u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
@@ -23,8 +23,10 @@
 #include "Acts/Propagator/EigenStepper.hpp"
 #include "Acts/Propagator/Propagator.hpp"
 #include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Tests/CommonHelpers/ThreadExecutor.hpp"
 #include "Acts/Utilities/AnnealingUtility.hpp"
 #include "Acts/Utilities/Helpers.hpp"
+#include "Acts/Utilities/ParallelFor.hpp"
 #include "Acts/Utilities/Result.hpp"
 #include "Acts/Vertexing/AdaptiveGridDensityVertexFinder.hpp"
 #include "Acts/Vertexing/AdaptiveMultiVertexFinder.hpp"
@@ -660,5 +662,98 @@ BOOST_AUTO_TEST_CASE(
   }
 }
 
+/// @brief AMVF test comparing sequential and concurrent vertex fits
+BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_finder_parallel_fit_test) {
+  // Set up constant B-Field
+  auto bField = std::make_shared<ConstantBField>(Vector3(0., 0., 2_T));
+
+  // Set up propagator with void navigator
+  EigenStepper<> stepper(bField);
+  auto propagator = std::make_shared<Propagator>(stepper);
+
+  using IPEstimator = ImpactPointEstimator<BoundTrackParameters, Propagator>;
+  IPEstimator::Config ipEstimatorCfg(bField, propagator);
+  IPEstimator ipEstimator(ipEstimatorCfg);
+
+  std::vector<double> temperatures{8.0, 4.0, 2.0, 1.4142136, 1.2247449, 1.0};
+  AnnealingUtility::Config annealingConfig;
+  annealingConfig.setOfTemperatures = temperatures;
+  AnnealingUtility annealingUtility(annealingConfig);
+
+  using Fitter = AdaptiveMultiVertexFitter<BoundTrackParameters, Linearizer>;
+  using SeedFinder =
+      TrackDensityVertexFinder<Fitter,
+                               GaussianTrackDensity<BoundTrackParameters>>;
+  using Finder = AdaptiveMultiVertexFinder<Fitter, SeedFinder>;
+
+  auto csvData = readTracksAndVertexCSV(toolString);
+  auto tracks = std::get<TracksData>(csvData);
+  std::vector<const BoundTrackParameters*> tracksPtr;
+  for (const auto& trk : tracks) {
+    tracksPtr.push_back(&trk);
+  }
+
+  Vertex<BoundTrackParameters> bsConstr = std::get<BeamSpotData>(csvData);
+  VertexingOptions<BoundTrackParameters> vertexingOptions(
+      geoContext, magFieldContext, bsConstr);
+
+  // Executor processing (almost) every vertex in its own thread
+  std::size_t nConcurrentCalls = 0;
+  ParallelForExecutor threads = threadExecutor(64);
+  ParallelForExecutor executor = [&](std::size_t size,
+                                     const ParallelForBody& body) {
+    ++nConcurrentCalls;
+    threads(size, body);
+  };
+
+  auto findVertices = [&](const ParallelForExecutor& vertexExecutor,
+                          double cacheTolerance) {
+    Fitter::Config fitterCfg(ipEstimator);
+    fitterCfg.annealingTool = annealingUtility;
+    fitterCfg.doSmoothing = true;
+    fitterCfg.vertexExecutor = vertexExecutor;
+    fitterCfg.linearizationCacheTolerance = cacheTolerance;
+    Fitter fitter(fitterCfg);
+
+    Linearizer::Config ltConfig(bField, propagator);
+    Linearizer linearizer(ltConfig);
+
+    Finder::Config finderConfig(std::move(fitter), SeedFinder(), ipEstimator,
+                                std::move(linearizer), bField);
+    Finder finder(std::move(finderConfig));
+    Finder::State state;
+
+    auto findResult = finder.find(tracksPtr, vertexingOptions, state);
+    BOOST_REQUIRE(findResult.ok());
+    return *findResult;
+  };
+
+  // Reused linearizations must not depend on the scheduling either
+  for (double cacheTolerance : {0., 10_um}) {
+    auto serialVertices = findVertices(nullptr, cacheTolerance);
+    auto parallelVertices = findVertices(executor, cacheTolerance);
+
+    BOOST_REQUIRE_EQUAL(serialVertices.size(), parallelVertices.size());
+    BOOST_CHECK_GT(serialVertices.size(), 0u);
+    for (std::size_t i = 0; i < serialVertices.size(); ++i) {
+      const auto& serialVtx = serialVertices[i];
+      const auto& parallelVtx = parallelVertices[i];
+      // Results must be bit-identical
+      BOOST_CHECK_EQUAL(serialVtx.fullPosition(), parallelVtx.fullPosition());
+      BOOST_CHECK_EQUAL(serialVtx.fullCovariance(),
+                        parallelVtx.fullCovariance());
+      BOOST_CHECK_EQUAL(serialVtx.fitQuality().first,
+                        parallelVtx.fitQuality().first);
+      BOOST_REQUIRE_EQUAL(serialVtx.tracks().size(),
+                          parallelVtx.tracks().size());
+      for (std::size_t j = 0; j < serialVtx.tracks().size(); ++j) {
+        BOOST_CHECK_EQUAL(serialVtx.tracks()[j].trackWeight,
+                          parallelVtx.tracks()[j].trackWeight);
+      }
+    }
+  }
+  BOOST_CHECK_GT(nConcurrentCalls, 0u);
+}
+
 }  // namespace Test
 }  // namespace Acts
@@ -209,33 +209,31 @@ BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_test) {
   AdaptiveMultiVertexFitter<BoundTrackParameters, Linearizer>::State state(
       *bField, magFieldContext);
 
+  for (auto& vtx : vtxPtrList) {
+    state.addVertex(*vtx);
+  }
+
   for (unsigned int iTrack = 0; iTrack < nTracksPerVtx * vtxPosVec.size();
        iTrack++) {
     // Index of current vertex
     int vtxIdx = (int)(iTrack / nTracksPerVtx);
-    state.vtxInfoMap[&(vtxList[vtxIdx])].trackLinks.push_back(
-        &(allTracks[iTrack]));
-    state.tracksAtVerticesMap.insert(
-        std::make_pair(std::make_pair(&(allTracks[iTrack]), &(vtxList[vtxIdx])),
-                       TrackAtVertex<BoundTrackParameters>(
-                           1., allTracks[iTrack], &(allTracks[iTrack]))));
+    state.addTrackToVertex(vtxList[vtxIdx], &(allTracks[iTrack]),
+                           TrackAtVertex<BoundTrackParameters>(
+                               1., allTracks[iTrack], &(allTracks[iTrack])));
 
     // Use first track also for second vertex to let vtx1 and vtx2
     // share this track
     if (iTrack == 0) {
-      state.vtxInfoMap[&(vtxList.at(1))].trackLinks.push_back(
-          &(allTracks[iTrack]));
-      state.tracksAtVerticesMap.insert(
-          std::make_pair(std::make_pair(&(allTracks[iTrack]), &(vtxList.at(1))),
-                         TrackAtVertex<BoundTrackParameters>(
-                             1., allTracks[iTrack], &(allTracks[iTrack]))));
+      state.addTrackToVertex(vtxList.at(1), &(allTracks[iTrack]),
+                             TrackAtVertex<BoundTrackParameters>(
+                                 1., allTracks[iTrack], &(allTracks[iTrack])));
     }
   }
 
   for (auto& vtx : vtxPtrList) {
-    state.addVertexToMultiMap(*vtx);
+    state.addVertexToAdjacency(*vtx);
     ACTS_DEBUG("Vertex, with ptr: " << vtx);
-    for (auto& trk : state.vtxInfoMap[vtx].trackLinks) {
+    for (auto& trk : state.vertexInfo(*vtx).trackLinks) {
       ACTS_DEBUG("\t track ptr: " << trk);
     }
   }
@@ -243,9 +241,8 @@ BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_test) {
   ACTS_DEBUG("Checking all vertices linked to a single track:");
   for (auto& trk : allTracks) {
     ACTS_DEBUG("Track with ptr: " << &trk);
-    auto range = state.trackToVerticesMultiMap.equal_range(&trk);
-    for (auto vtxIter = range.first; vtxIter != range.second; ++vtxIter) {
-      ACTS_DEBUG("\t used by vertex: " << vtxIter->second);
+    for (auto vtx : state.verticesOfTrack(&trk)) {
+      ACTS_DEBUG("\t used by vertex: " << vtx);
     }
   }
 
@@ -260,7 +257,7 @@ BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_test) {
   for (auto& vtx : vtxPtrList) {
     c++;
     ACTS_DEBUG(c << ". vertex, with ptr: " << vtx);
-    for (auto& trk : state.vtxInfoMap[vtx].trackLinks) {
+    for (auto& trk : state.vertexInfo(*vtx).trackLinks) {
       ACTS_DEBUG("\t track ptr: " << trk);
     }
   }
@@ -268,9 +265,8 @@ BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_test) {
   ACTS_DEBUG("Checking all vertices linked to a single track AFTER fit:");
   for (auto& trk : allTracks) {
     ACTS_DEBUG("Track with ptr: " << &trk);
-    auto range = state.trackToVerticesMultiMap.equal_range(&trk);
-    for (auto vtxIter = range.first; vtxIter != range.second; ++vtxIter) {
-      ACTS_DEBUG("\t used by vertex: " << vtxIter->second);
+    for (auto vtx : state.verticesOfTrack(&trk)) {
+      ACTS_DEBUG("\t used by vertex: " << vtx);
     }
   }
 
@@ -422,16 +418,14 @@ BOOST_AUTO_TEST_CASE(time_fitting) {
   AdaptiveMultiVertexFitter<BoundTrackParameters, Linearizer>::State state(
       *bField, magFieldContext);
 
+  state.addVertex(vtx);
   for (const auto& trk : trks) {
     ACTS_DEBUG("Track parameters:\n" << trk);
-    // Index of current vertex
-    state.vtxInfoMap[&vtx].trackLinks.push_back(&trk);
-    state.tracksAtVerticesMap.insert(
-        std::make_pair(std::make_pair(&trk, &vtx),
-                       TrackAtVertex<BoundTrackParameters>(1., trk, &trk)));
+    state.addTrackToVertex(vtx, &trk,
+                           TrackAtVertex<BoundTrackParameters>(1., trk, &trk));
   }
 
-  state.addVertexToMultiMap(vtx);
+  state.addVertexToAdjacency(vtx);
 
   auto res = fitter.addVtxToFit(state, vtx, linearizer, vertexingOptions);
 
@@ -460,6 +454,94 @@ BOOST_AUTO_TEST_CASE(time_fitting) {
   CHECK_CLOSE_ABS(vtxCov - vtxCov.transpose(), SquareMatrix4::Zero(), 1e-5);
 }
 
+/// @brief Unit test for reusing the track linearizations of earlier fits
+///
+BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_linearization_cache) {
+  // Set up RNG
+  int mySeed = 31415;
+  std::mt19937 gen(mySeed);
+
+  // Set up constant B-Field
+  auto bField = std::make_shared<ConstantBField>(Vector3{0.0, 0.0, 1_T});
+
+  // Set up propagator with void navigator
+  EigenStepper<> stepper(bField);
+  auto propagator = std::make_shared<Propagator>(stepper);
+
+  VertexingOptions<BoundTrackParameters> vertexingOptions(geoContext,
+                                                          magFieldContext);
+
+  using IPEstimator = ImpactPointEstimator<BoundTrackParameters, Propagator>;
+  IPEstimator::Config ip3dEstCfg(bField, propagator);
+  IPEstimator ip3dEst(ip3dEstCfg);
+
+  Linearizer::Config ltConfig(bField, propagator);
+  Linearizer linearizer(ltConfig);
+
+  using Fitter = AdaptiveMultiVertexFitter<BoundTrackParameters, Linearizer>;
+
+  // Tracks from a common vertex
+  Vector3 vtxPos(-0.15_mm, -0.1_mm, -1.5_mm);
+  std::vector<BoundTrackParameters> tracks;
+  for (unsigned int iTrack = 0; iTrack < 6; iTrack++) {
+    double q = qDist(gen) < 0 ? -1. : 1.;
+    double resIP = resIPDist(gen);
+    double resAng = resAngDist(gen);
+    Covariance covMat = Covariance::Identity();
+    covMat.diagonal() << resIP * resIP, resIP * resIP, resAng * resAng,
+        resAng * resAng, 1e-4 / 1_GeV / 1_GeV, 1.;
+
+    BoundTrackParameters::ParametersVector paramVec;
+    paramVec << d0Dist(gen), z0Dist(gen), phiDist(gen), thetaDist(gen),
+        q / pTDist(gen), 0.;
+    tracks.emplace_back(Surface::makeShared<PerigeeSurface>(vtxPos), paramVec,
+                        std::move(covMat), ParticleHypothesis::pion());
+  }
+
+  // Fit two vertices with the same seed and the same tracks one after the
+  // other. The second vertex is linearized at the linearization point of
+  // the first one.
+  auto fitVertices = [&](double cacheTolerance) {
+    Fitter::Config fitterCfg(ip3dEst);
+    fitterCfg.linearizationCacheTolerance = cacheTolerance;
+    Fitter fitter(std::move(fitterCfg));
+    Fitter::State state(*bField, magFieldContext);
+
+    std::vector<Vertex<BoundTrackParameters>> vertices(
+        2, Vertex<BoundTrackParameters>(vtxPos));
+    for (auto& vtx : vertices) {
+      vtx.setFullCovariance(SquareMatrix4::Identity());
+      state.addVertex(vtx, VertexInfo<BoundTrackParameters>(
+                               Vertex<BoundTrackParameters>(),
+                               vtx.fullPosition()));
+      for (const auto& trk : tracks) {
+        state.addTrackToVertex(
+            vtx, &trk, TrackAtVertex<BoundTrackParameters>(1., trk, &trk));
+      }
+      state.addVertexToAdjacency(vtx);
+      BOOST_REQUIRE(
+          fitter.addVtxToFit(state, vtx, linearizer, vertexingOptions).ok());
+    }
+    return std::make_pair(vertices, state.linearizationCache.statistics());
+  };
+
+  auto [vertices, statistics] = fitVertices(0.);
+  auto [cachedVertices, cachedStatistics] = fitVertices(1_nm);
+
+  BOOST_CHECK_EQUAL(statistics.hits + statistics.misses, 0u);
+  BOOST_CHECK_EQUAL(cachedStatistics.hits, tracks.size());
+  BOOST_CHECK_GE(cachedStatistics.misses, tracks.size());
+
+  // The cached linearizations were made at the same point, so the results
+  // are identical
+  for (std::size_t i = 0; i < vertices.size(); ++i) {
+    BOOST_CHECK_EQUAL(vertices[i].fullPosition(),
+                      cachedVertices[i].fullPosition());
+    BOOST_CHECK_EQUAL(vertices[i].fullCovariance(),
+                      cachedVertices[i].fullCovariance());
+  }
+}
+
 /// @brief Unit test for AdaptiveMultiVertexFitter
 /// based on Athena unit test, i.e. same setting and
 /// test values are used here
@@ -615,11 +697,10 @@ BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_test_athena) {
   vtxInfo1.oldPosition = vtxInfo1.linPoint;
   vtxInfo1.seedPosition = vtxInfo1.linPoint;
 
+  state.addVertex(vtx1, std::move(vtxInfo1));
   for (const auto& trk : params1) {
-    vtxInfo1.trackLinks.push_back(&trk);
-    state.tracksAtVerticesMap.insert(
-        std::make_pair(std::make_pair(&trk, &vtx1),
-                       TrackAtVertex<BoundTrackParameters>(1.5, trk, &trk)));
+    state.addTrackToVertex(vtx1, &trk,
+                           TrackAtVertex<BoundTrackParameters>(1.5, trk, &trk));
   }
 
   // Prepare second vertex
@@ -642,18 +723,14 @@ BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_test_athena) {
   vtxInfo2.oldPosition = vtxInfo2.linPoint;
   vtxInfo2.seedPosition = vtxInfo2.linPoint;
 
+  state.addVertex(vtx2, std::move(vtxInfo2));
   for (const auto& trk : params2) {
-    vtxInfo2.trackLinks.push_back(&trk);
-    state.tracksAtVerticesMap.insert(
-        std::make_pair(std::make_pair(&trk, &vtx2),
-                       TrackAtVertex<BoundTrackParameters>(1.5, trk, &trk)));
+    state.addTrackToVertex(vtx2, &trk,
+                           TrackAtVertex<BoundTrackParameters>(1.5, trk, &trk));
   }
 
-  state.vtxInfoMap[&vtx1] = std::move(vtxInfo1);
-  state.vtxInfoMap[&vtx2] = std::move(vtxInfo2);
-
-  state.addVertexToMultiMap(vtx1);
-  state.addVertexToMultiMap(vtx2);
+  state.addVertexToAdjacency(vtx1);
+  state.addVertexToAdjacency(vtx2);
 
   // Fit vertices
   fitter.fit(state, linearizer, vertexingOptions);
@@ -661,21 +738,20 @@ BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_test_athena) {
   auto vtx1Fitted = state.vertexCollection.at(0);
   auto vtx1PosFitted = vtx1Fitted->position();
   auto vtx1CovFitted = vtx1Fitted->covariance();
-  auto trks1 = state.vtxInfoMap.at(vtx1Fitted).trackLinks;
+  auto trks1 = state.vertexInfo(*vtx1Fitted).trackLinks;
   auto vtx1FQ = vtx1Fitted->fitQuality();
 
   auto vtx2Fitted = state.vertexCollection.at(1);
   auto vtx2PosFitted = vtx2Fitted->position();
   auto vtx2CovFitted = vtx2Fitted->covariance();
-  auto trks2 = state.vtxInfoMap.at(vtx2Fitted).trackLinks;
+  auto trks2 = state.vertexInfo(*vtx2Fitted).trackLinks;
   auto vtx2FQ = vtx2Fitted->fitQuality();
 
   // Vertex 1
   ACTS_DEBUG("Vertex 1, position: " << vtx1PosFitted);
   ACTS_DEBUG("Vertex 1, covariance: " << vtx1CovFitted);
   for (const auto& trk : trks1) {
-    auto& trkAtVtx =
-        state.tracksAtVerticesMap.at(std::make_pair(trk, vtx1Fitted));
+    auto& trkAtVtx = state.trackAtVertex(trk, *vtx1Fitted);
     ACTS_DEBUG("\tTrack weight:" << trkAtVtx.trackWeight);
   }
   ACTS_DEBUG("Vertex 1, chi2: " << vtx1FQ.first);
@@ -685,8 +761,7 @@ BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_test_athena) {
   ACTS_DEBUG("Vertex 2, position: " << vtx2PosFitted);
   ACTS_DEBUG("Vertex 2, covariance: " << vtx2CovFitted);
   for (const auto& trk : trks2) {
-    auto& trkAtVtx =
-        state.tracksAtVerticesMap.at(std::make_pair(trk, vtx2Fitted));
+    auto& trkAtVtx = state.trackAtVertex(trk, *vtx2Fitted);
     ACTS_DEBUG("\tTrack weight:" << trkAtVtx.trackWeight);
   }
   ACTS_DEBUG("Vertex 2, chi2: " << vtx2FQ.first);
@@ -721,8 +796,7 @@ BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_test_athena) {
   CHECK_CLOSE_ABS(vtx1CovFitted, expVtx1Cov, 0.001_mm);
   int trkCount = 0;
   for (const auto& trk : trks1) {
-    auto& trkAtVtx =
-        state.tracksAtVerticesMap.at(std::make_pair(trk, vtx1Fitted));
+    auto& trkAtVtx = state.trackAtVertex(trk, *vtx1Fitted);
     CHECK_CLOSE_ABS(trkAtVtx.trackWeight, expVtx1TrkWeights[trkCount], 0.001);
     trkCount++;
   }
@@ -734,8 +808,7 @@ BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_fitter_test_athena) {
   CHECK_CLOSE_ABS(vtx2CovFitted, expVtx2Cov, 0.001_mm);
   trkCount = 0;
   for (const auto& trk : trks2) {
-    auto& trkAtVtx =
-        state.tracksAtVerticesMap.at(std::make_pair(trk, vtx2Fitted));
+    auto& trkAtVtx = state.trackAtVertex(trk, *vtx2Fitted);
     CHECK_CLOSE_ABS(trkAtVtx.trackWeight, expVtx2TrkWeights[trkCount], 0.001);
     trkCount++;
   }
@@ -18,14 +18,19 @@
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/Surfaces/PerigeeSurface.hpp"
 #include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
 #include "Acts/Utilities/Result.hpp"
+#include "Acts/Vertexing/DynamicGaussianGridTrackDensity.hpp"
 #include "Acts/Vertexing/GaussianGridTrackDensity.hpp"
 
 #include <algorithm>
 #include <cstddef>
 #include <memory>
 #include <optional>
+#include <random>
+#include <stdexcept>
 #include <utility>
+#include <vector>
 
 namespace bdata = boost::unit_test::data;
 using namespace Acts::UnitLiterals;
@@ -309,5 +314,80 @@ BOOST_AUTO_TEST_CASE(gaussian_grid_seed_width_test) {
   BOOST_CHECK_NE(width, 0.);
 }
 
+/// @brief Tests that the runtime-sized grid density agrees with the
+/// GaussianGridTrackDensity
+BOOST_AUTO_TEST_CASE(dynamic_gaussian_grid_density_test) {
+  constexpr int mainGridSize = 400;
+  constexpr int trkGridSize = 15;
+  const float zMinMax = 20;
+
+  using Grid = GaussianGridTrackDensity<mainGridSize, trkGridSize>;
+  Grid grid(Grid::Config{zMinMax});
+  DynamicGaussianGridTrackDensity dynamicGrid(
+      DynamicGaussianGridTrackDensity::Config(zMinMax, mainGridSize,
+                                              trkGridSize));
+
+  // Track grids have to be odd and smaller than the main grid
+  BOOST_CHECK_THROW(DynamicGaussianGridTrackDensity(
+                        DynamicGaussianGridTrackDensity::Config(10, 100, 14)),
+                    std::invalid_argument);
+  BOOST_CHECK_THROW(DynamicGaussianGridTrackDensity(
+                        DynamicGaussianGridTrackDensity::Config(10, 15, 15)),
+                    std::invalid_argument);
+
+  auto perigeeSurface =
+      Surface::makeShared<PerigeeSurface>(Vector3(0., 0., 0.));
+  std::mt19937 gen(4242);
+  std::uniform_real_distribution<double> dDist(-0.5, 0.5);
+  // Includes tracks at the edges and outside of the grid
+  std::uniform_real_distribution<double> zDist(-zMinMax - 1, zMinMax + 1);
+  std::uniform_real_distribution<double> sigmaDist(0.05, 0.3);
+
+  Grid::MainGridVector mainGrid = grid.emptyMainGrid();
+  auto dynamicMainGrid = dynamicGrid.emptyMainGrid();
+  BOOST_CHECK_EQUAL(dynamicMainGrid.size(), mainGridSize);
+  BOOST_CHECK(!dynamicGrid.getMaxZPosition(dynamicMainGrid).ok());
+
+  std::vector<std::pair<int, DynamicGaussianGridTrackDensity::TrackGridVector>>
+      trackGrids;
+  for (int i = 0; i < 200; ++i) {
+    double sigmaD = sigmaDist(gen);
+    double sigmaZ = sigmaDist(gen);
+    Covariance covMat = Covariance::Identity();
+    covMat(0, 0) = sigmaD * sigmaD;
+    covMat(1, 1) = sigmaZ * sigmaZ;
+    covMat(0, 1) = covMat(1, 0) = 0.3 * sigmaD * sigmaZ;
+    BoundVector paramVec;
+    paramVec << dDist(gen), zDist(gen), 0, 0, 0, 0;
+    BoundTrackParameters params(perigeeSurface, paramVec, covMat,
+                                ParticleHypothesis::pion());
+
+    auto binAndTrackGrid = grid.addTrack(params, mainGrid);
+    auto dynamicBinAndTrackGrid = dynamicGrid.addTrack(params, dynamicMainGrid);
+    BOOST_CHECK_EQUAL(binAndTrackGrid.first, dynamicBinAndTrackGrid.first);
+    for (int j = 0; j < trkGridSize; ++j) {
+      CHECK_CLOSE_OR_SMALL(dynamicBinAndTrackGrid.second(j),
+                           binAndTrackGrid.second(j), 1e-5, 1e-5);
+    }
+    trackGrids.push_back(std::move(dynamicBinAndTrackGrid));
+  }
+
+  for (int j = 0; j < mainGridSize; ++j) {
+    CHECK_CLOSE_OR_SMALL(dynamicMainGrid(j), mainGrid(j), 1e-5, 1e-4);
+  }
+  auto maxZ = grid.getMaxZPositionAndWidth(mainGrid);
+  auto dynamicMaxZ = dynamicGrid.getMaxZPositionAndWidth(dynamicMainGrid);
+  BOOST_REQUIRE(maxZ.ok());
+  BOOST_REQUIRE(dynamicMaxZ.ok());
+  BOOST_CHECK_EQUAL(maxZ->first, dynamicMaxZ->first);
+  CHECK_CLOSE_REL(maxZ->second, dynamicMaxZ->second, 1e-3);
+
+  // Removing all tracks again leaves an empty grid up to rounding
+  for (const auto& [zBin, trackGrid] : trackGrids) {
+    dynamicGrid.removeTrackGridFromMainGrid(zBin, trackGrid, dynamicMainGrid);
+  }
+  BOOST_CHECK(dynamicMainGrid.isZero(1e-3));
+}
+
 }  // namespace Test
 }  // namespace Acts
@@ -27,6 +27,7 @@
 #include "Acts/Utilities/UnitVectors.hpp"
 #include "Acts/Vertexing/AdaptiveGridDensityVertexFinder.hpp"
 #include "Acts/Vertexing/AdaptiveGridTrackDensity.hpp"
+#include "Acts/Vertexing/DynamicGaussianGridTrackDensity.hpp"
 #include "Acts/Vertexing/GaussianGridTrackDensity.hpp"
 #include "Acts/Vertexing/GridDensityVertexFinder.hpp"
 #include "Acts/Vertexing/Vertex.hpp"
@@ -118,6 +119,17 @@ BOOST_AUTO_TEST_CASE(grid_density_vertex_finder_test) {
   Finder2 finder2(cfg2);
   Finder2::State state2;
 
+  // Same grid as Finder1, but with the grid sizes configured at runtime
+  using Finder3 =
+      GridDensityVertexFinder<mainGridSize, trkGridSize, DummyVertexFitter<>,
+                              DynamicGaussianGridTrackDensity>;
+  Finder3::Config cfg3(DynamicGaussianGridTrackDensity(
+      DynamicGaussianGridTrackDensity::Config(100, mainGridSize,
+                                              trkGridSize)));
+  cfg3.cacheGridStateForTrackRemoval = false;
+  Finder3 finder3(cfg3);
+  Finder3::State state3;
+
   int mySeed = 31415;
   std::mt19937 gen(mySeed);
   unsigned int nTracks = 200;
@@ -192,6 +204,10 @@ BOOST_AUTO_TEST_CASE(grid_density_vertex_finder_test) {
 
   // Both finders should give same results
   BOOST_CHECK_EQUAL(zResult1, zResult2);
+
+  auto res3 = finder3.find(trackPtrVec, vertexingOptions, state3);
+  BOOST_REQUIRE(res3.ok());
+  BOOST_CHECK_EQUAL((*res3).back().position()[eZ], zResult1);
 }
 
 BOOST_AUTO_TEST_CASE(grid_density_vertex_finder_track_caching_test) {
@@ -93,13 +93,14 @@ auto vt0s = bd::make({0_ns, -2_ns, 2_ns});
 auto vertices = vx0s * vy0s * vz0s * vt0s;
 
 // Construct an impact point estimator for a constant bfield along z.
-Estimator makeEstimator(double bZ) {
+Estimator makeEstimator(double bZ, bool useAnalyticHelix = false) {
   auto field = std::make_shared<MagneticField>(Vector3(0, 0, bZ));
   Stepper stepper(field);
   Estimator::Config cfg(field,
                         std::make_shared<Propagator>(
                             std::move(stepper), detail::VoidNavigator(),
                             getDefaultLogger("Prop", Logging::Level::WARNING)));
+  cfg.useAnalyticHelix = useAnalyticHelix;
   return Estimator(cfg);
 }
 
@@ -194,6 +195,43 @@ BOOST_DATA_TEST_CASE(SingleTrackDistanceParametersCompatibility3D, tracks, d0,
   BOOST_CHECK_GT(compatibility, 0);
 }
 
+// Check that the analytic helix transport in `estimate3DImpactParameters`
+// agrees with the propagator.
+BOOST_DATA_TEST_CASE(AnalyticHelix3DImpactParameters, tracks, d0, l0, t0, phi,
+                     theta, p, q) {
+  auto particleHypothesis = ParticleHypothesis::pion();
+
+  BoundVector par;
+  par[eBoundLoc0] = d0;
+  par[eBoundLoc1] = l0;
+  par[eBoundTime] = t0;
+  par[eBoundPhi] = phi;
+  par[eBoundTheta] = theta;
+  par[eBoundQOverP] = particleHypothesis.qOverP(p, q);
+
+  Estimator ipEstimator = makeEstimator(2_T);
+  Estimator helixEstimator = makeEstimator(2_T, true);
+  Estimator::State state(magFieldCache());
+
+  auto perigeeSurface = Surface::makeShared<PerigeeSurface>(Vector3::Zero());
+  BoundTrackParameters myTrack(
+      perigeeSurface, par, makeBoundParametersCovariance(), particleHypothesis);
+
+  Vector3 vtxPos(10_um, -10_um, 25_mm);
+  auto propagated = ipEstimator
+                        .estimate3DImpactParameters(geoContext, magFieldContext,
+                                                    myTrack, vtxPos, state)
+                        .value();
+  auto helix = helixEstimator
+                   .estimate3DImpactParameters(geoContext, magFieldContext,
+                                               myTrack, vtxPos, state)
+                   .value();
+
+  // the propagator stops within the default surface tolerance
+  CHECK_CLOSE_ABS(helix.parameters(), propagated.parameters(), 1_um);
+  CHECK_CLOSE_COVARIANCE(*helix.covariance(), *propagated.covariance(), 1e-4);
+}
+
 BOOST_DATA_TEST_CASE(TimeAtPca, tracksWithoutIPs* vertices, t0, phi, theta, p,
                      q, vx0, vy0, vz0, vt0) {
   using Propagator = Acts::Propagator<Stepper>;
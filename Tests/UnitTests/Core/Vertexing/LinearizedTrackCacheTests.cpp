@@ -0,0 +1,174 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Utilities/Result.hpp"
+#include "Acts/Vertexing/LinearizedTrack.hpp"
+#include "Acts/Vertexing/LinearizedTrackCache.hpp"
+#include "Acts/Vertexing/VertexingError.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+using namespace Acts::UnitLiterals;
+
+namespace Acts {
+namespace Test {
+
+namespace {
+
+/// Fake linearizer that records the number of calls
+struct CountingLinearizer {
+  std::size_t calls = 0;
+
+  Result<LinearizedTrack> operator()(const Vector4& linPoint) {
+    ++calls;
+    LinearizedTrack linTrack;
+    linTrack.linearizationPoint = linPoint;
+    linTrack.constantTerm.setConstant(static_cast<double>(calls));
+    return linTrack;
+  }
+};
+
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(linearized_track_cache_reuse) {
+  LinearizedTrackCache cache;
+  CountingLinearizer linearizer;
+  const double tolerance = 1_um;
+
+  auto get = [&](std::size_t track, const Vector4& linPoint) {
+    return cache
+        .get(track, linPoint, tolerance,
+             [&]() { return linearizer(linPoint); })
+        .value();
+  };
+
+  Vector4 linPoint(0.1234_mm, -0.2345_mm, 15.0004_mm, 0.);
+  auto first = get(0, linPoint);
+  BOOST_CHECK_EQUAL(linearizer.calls, 1u);
+  BOOST_CHECK_EQUAL(first.linearizationPoint, linPoint);
+
+  // Same track at a slightly different point is served from the cache and
+  // keeps the original linearization point
+  Vector4 shifted = linPoint + Vector4(0.1_nm, -0.1_nm, 0.1_nm, 0.);
+  auto second = get(0, shifted);
+  BOOST_CHECK_EQUAL(linearizer.calls, 1u);
+  BOOST_CHECK_EQUAL(second.linearizationPoint, linPoint);
+  BOOST_CHECK_EQUAL(second.constantTerm, first.constantTerm);
+
+  // Other tracks and distant points require a new linearization
+  get(1, linPoint);
+  BOOST_CHECK_EQUAL(linearizer.calls, 2u);
+  get(0, linPoint + Vector4(0., 0., 10_um, 0.));
+  BOOST_CHECK_EQUAL(linearizer.calls, 3u);
+  get(0, linPoint + Vector4(0., 0., 0., 1_ns));
+  BOOST_CHECK_EQUAL(linearizer.calls, 4u);
+
+  auto statistics = cache.statistics();
+  BOOST_CHECK_EQUAL(statistics.hits, 1u);
+  BOOST_CHECK_EQUAL(statistics.misses, 4u);
+  BOOST_CHECK_EQUAL(cache.size(), 4u);
+
+  // A linearization is never reused beyond the tolerance, even if its
+  // quantization cell matches one of a smaller tolerance
+  Vector4 coarse(0.5_mm, -0.5_mm, 15.5_mm, 0.);
+  cache.get(2, coarse, 1_mm, [&]() { return linearizer(coarse); }).value();
+  BOOST_CHECK_EQUAL(linearizer.calls, 5u);
+  Vector4 fine(0.5_um, -0.5_um, 15.5_um, 0.);
+  BOOST_CHECK_EQUAL(get(2, fine).linearizationPoint, fine);
+  BOOST_CHECK_EQUAL(linearizer.calls, 6u);
+
+  cache.clear();
+  BOOST_CHECK_EQUAL(cache.size(), 0u);
+  BOOST_CHECK_EQUAL(cache.statistics().hits, 0u);
+  BOOST_CHECK_EQUAL(cache.statistics().misses, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(linearized_track_cache_insertions) {
+  static_assert(std::is_copy_constructible_v<LinearizedTrackCache>);
+
+  LinearizedTrackCache cache;
+  CountingLinearizer linearizer;
+  const double tolerance = 1_um;
+  Vector4 linPoint(0.1234_mm, -0.2345_mm, 15.0004_mm, 0.);
+  Vector4 shifted = linPoint + Vector4(0.1_nm, -0.1_nm, 0.1_nm, 0.);
+
+  // Pending linearizations are not visible to other lookups, so the result
+  // does not depend on the order of the lookups
+  LinearizedTrackCache::Insertions first;
+  LinearizedTrackCache::Insertions second;
+  auto firstLinTrack =
+      cache
+          .get(0, linPoint, tolerance, [&]() { return linearizer(linPoint); },
+               first)
+          .value();
+  auto secondLinTrack =
+      cache
+          .get(0, shifted, tolerance, [&]() { return linearizer(shifted); },
+               second)
+          .value();
+  BOOST_CHECK_EQUAL(linearizer.calls, 2u);
+  BOOST_CHECK_EQUAL(firstLinTrack.linearizationPoint, linPoint);
+  BOOST_CHECK_EQUAL(secondLinTrack.linearizationPoint, shifted);
+  BOOST_CHECK_EQUAL(first.size(), 1u);
+  BOOST_CHECK_EQUAL(cache.size(), 0u);
+
+  // Later commits replace earlier ones in the same cell
+  cache.commit(first);
+  cache.commit(second);
+  BOOST_CHECK_EQUAL(first.size(), 0u);
+  BOOST_CHECK_EQUAL(cache.size(), 1u);
+  BOOST_CHECK_EQUAL(cache.statistics().misses, 2u);
+
+  LinearizedTrackCache::Insertions third;
+  auto thirdLinTrack =
+      cache
+          .get(0, linPoint, tolerance, [&]() { return linearizer(linPoint); },
+               third)
+          .value();
+  BOOST_CHECK_EQUAL(linearizer.calls, 2u);
+  BOOST_CHECK_EQUAL(thirdLinTrack.linearizationPoint, shifted);
+  BOOST_CHECK_EQUAL(third.size(), 0u);
+  cache.commit(third);
+  BOOST_CHECK_EQUAL(cache.statistics().hits, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(linearized_track_cache_disabled) {
+  LinearizedTrackCache cache;
+  CountingLinearizer linearizer;
+  Vector4 linPoint(0., 0., 1_mm, 0.);
+
+  for (std::size_t i = 0; i < 3; ++i) {
+    BOOST_CHECK(
+        cache.get(0, linPoint, 0., [&]() { return linearizer(linPoint); })
+            .ok());
+  }
+  BOOST_CHECK_EQUAL(linearizer.calls, 3u);
+  BOOST_CHECK_EQUAL(cache.size(), 0u);
+  BOOST_CHECK_EQUAL(cache.statistics().misses, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(linearized_track_cache_error) {
+  LinearizedTrackCache cache;
+  Vector4 linPoint(0., 0., 1_mm, 0.);
+
+  // Failed linearizations are not cached
+  auto result =
+      cache.get(0, linPoint, 1_um, []() -> Result<LinearizedTrack> {
+        return VertexingError::NumericFailure;
+      });
+  BOOST_CHECK(!result.ok());
+  BOOST_CHECK_EQUAL(cache.size(), 0u);
+}
+
+}  // namespace Test
+}  // namespace Acts
@@ -174,6 +174,13 @@ BOOST_AUTO_TEST_CASE(linearized_track_factory_test) {
   AnalyticalLinearizer linFactory(linConfig);
   AnalyticalLinearizer::State linState(constField->makeCache(magFieldContext));
 
+  // Linearizer for constant field using the analytic helix transport
+  AnalyticalLinearizer::Config helixLinConfig(constField, propagator);
+  helixLinConfig.useAnalyticHelix = true;
+  AnalyticalLinearizer helixLinFactory(helixLinConfig);
+  AnalyticalLinearizer::State helixLinState(
+      constField->makeCache(magFieldContext));
+
   NumericalLinearizer::Config numLinConfig(constField, propagator);
   NumericalLinearizer numLinFactory(numLinConfig);
   NumericalLinearizer::State numLinState(
@@ -268,6 +275,10 @@ BOOST_AUTO_TEST_CASE(linearized_track_factory_test) {
       checkLinearizers(linFactory, linState, numLinFactory, numLinState, trk,
                        vtxPos, geoContext, magFieldContext);
     }
+    BOOST_TEST_CONTEXT("Linearization with analytic helix transport") {
+      checkLinearizers(helixLinFactory, helixLinState, numLinFactory,
+                       numLinState, trk, vtxPos, geoContext, magFieldContext);
+    }
     BOOST_TEST_CONTEXT("Linearization without magnetic field") {
       checkLinearizers(straightLinFactory, straightLinState,
                        numStraightLinFactory, numStraightLinState, trk, vtxPos,
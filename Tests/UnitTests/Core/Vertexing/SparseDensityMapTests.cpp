@@ -0,0 +1,112 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Vertexing/SparseDensityMap.hpp"
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <utility>
+
+namespace Acts {
+namespace Test {
+
+using Bin = SparseDensityMap::Bin;
+
+BOOST_AUTO_TEST_CASE(sparse_density_map_access) {
+  SparseDensityMap densityMap;
+  BOOST_CHECK(densityMap.empty());
+  BOOST_CHECK(densityMap.maxEntry() == densityMap.end());
+
+  densityMap[Bin(3, 0)] = 1.f;
+  densityMap[Bin(-2, 0)] = 2.f;
+  densityMap[Bin(0, -1)] = 0.5f;
+  densityMap[Bin(3, 0)] += 1.5f;
+  BOOST_CHECK_EQUAL(densityMap.size(), 3u);
+  BOOST_CHECK_EQUAL(densityMap.count(Bin(3, 0)), 1u);
+  BOOST_CHECK_EQUAL(densityMap.count(Bin(3, 1)), 0u);
+  BOOST_CHECK_EQUAL(densityMap.at(Bin(3, 0)), 2.5f);
+  BOOST_CHECK_THROW(densityMap.at(Bin(1, 0)), std::out_of_range);
+
+  // Iteration is ordered by t first and z second
+  std::vector<Bin> bins;
+  for (const auto& [bin, density] : densityMap) {
+    bins.push_back(bin);
+  }
+  std::vector<Bin> expected = {Bin(0, -1), Bin(-2, 0), Bin(3, 0)};
+  BOOST_CHECK(bins == expected);
+
+  BOOST_CHECK(densityMap.maxEntry()->first == Bin(3, 0));
+  // Mutable access invalidates the maximum
+  densityMap.at(Bin(3, 0)) = 0.f;
+  BOOST_CHECK(densityMap.maxEntry()->first == Bin(-2, 0));
+
+  densityMap.clear();
+  BOOST_CHECK(densityMap.empty());
+}
+
+BOOST_AUTO_TEST_CASE(sparse_density_map_accumulate) {
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int> zDist(-50, 50);
+  std::uniform_int_distribution<int> tDist(-2, 2);
+  std::uniform_real_distribution<float> densityDist(0.f, 1.f);
+
+  // Reference implementation with an ordered map
+  auto less = [](const Bin& a, const Bin& b) {
+    return std::make_pair(a.second, a.first) <
+           std::make_pair(b.second, b.first);
+  };
+  std::map<Bin, float, decltype(less)> reference(less);
+
+  SparseDensityMap densityMap;
+  std::vector<SparseDensityMap> added;
+  for (int i = 0; i < 100; ++i) {
+    // A track covers a contiguous range of z bins for a few t bins
+    SparseDensityMap track;
+    int z0 = zDist(rng);
+    int t0 = tDist(rng);
+    for (int t = t0; t < t0 + 2; ++t) {
+      for (int z = z0; z < z0 + 7; ++z) {
+        track[Bin(z, t)] = densityDist(rng);
+      }
+    }
+    densityMap.accumulate(track);
+    for (const auto& [bin, density] : track) {
+      reference[bin] += density;
+    }
+    added.push_back(std::move(track));
+
+    // Remove every third track again
+    if (i % 3 == 2) {
+      densityMap.accumulate(added[i - 1], -1.f);
+      for (const auto& [bin, density] : added[i - 1]) {
+        reference[bin] -= density;
+      }
+    }
+
+    BOOST_REQUIRE_EQUAL(densityMap.size(), reference.size());
+    auto it = densityMap.begin();
+    for (const auto& [bin, density] : reference) {
+      BOOST_CHECK(it->first == bin);
+      BOOST_CHECK_CLOSE(it->second, density, 1e-3);
+      ++it;
+    }
+
+    // The tracked maximum agrees with a full scan
+    auto maxReference = std::max_element(
+        densityMap.begin(), densityMap.end(),
+        [](const auto& a, const auto& b) { return a.second < b.second; });
+    BOOST_CHECK(densityMap.maxEntry() == maxReference);
+  }
+}
+
+}  // namespace Test
+}  // namespace Acts
@@ -0,0 +1,217 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/GeometryHierarchyMap.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Tests/CommonHelpers/CubicTrackingGeometry.hpp"
+#include "Acts/Tests/CommonHelpers/WhiteBoardUtilities.hpp"
+#include "Acts/Utilities/BinUtility.hpp"
+#include "Acts/Utilities/BinningData.hpp"
+#include "ActsExamples/Digitization/DigitizationAlgorithm.hpp"
+#include "ActsExamples/Digitization/DigitizationConfig.hpp"
+#include "ActsExamples/Digitization/Smearers.hpp"
+#include "ActsExamples/EventData/Cluster.hpp"
+#include "ActsExamples/EventData/Index.hpp"
+#include "ActsExamples/EventData/IndexSourceLink.hpp"
+#include "ActsExamples/EventData/Measurement.hpp"
+#include "ActsExamples/EventData/SimHit.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/ProcessCode.hpp"
+#include "ActsExamples/Framework/RandomNumbers.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+#include "ActsExamples/Utilities/tbbWrap.hpp"
+
+#include <memory>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+using namespace Acts;
+using namespace Acts::Test;
+using namespace Acts::UnitLiterals;
+using namespace ActsExamples;
+
+namespace {
+
+const GeometryContext geoCtx;
+CubicTrackingGeometry cGeometry(geoCtx);
+const auto geometry = cGeometry();
+
+struct DigitizationOutput {
+  MeasurementContainer measurements;
+  ClusterContainer clusters;
+  IndexMultimap<SimBarcode> measurementParticlesMap;
+  IndexMultimap<Index> measurementSimHitsMap;
+};
+
+/// Tilted hits at random positions on all sensitive surfaces.
+SimHitContainer makeSimHits(std::size_t nHitsPerSurface) {
+  std::mt19937 gen(23);
+  std::uniform_real_distribution<double> distLocal(-400_mm, 400_mm);
+
+  std::vector<const Surface*> surfaces;
+  geometry->visitSurfaces(
+      [&](const Surface* surface) { surfaces.push_back(surface); });
+
+  SimHitContainer simHits;
+  std::uint64_t particle = 1;
+  for (const Surface* surface : surfaces) {
+    RotationMatrix3 rotation = surface->transform(geoCtx).linear();
+    // Cross a few cells within the sensor thickness
+    const Vector3 dir = (rotation.col(2) + 0.4 * rotation.col(0) +
+                         0.3 * rotation.col(1))
+                            .normalized();
+    for (std::size_t ih = 0; ih < nHitsPerSurface; ++ih, ++particle) {
+      Vector2 local(distLocal(gen), distLocal(gen));
+      Vector3 pos = surface->localToGlobal(geoCtx, local, dir);
+      Vector4 pos4(pos.x(), pos.y(), pos.z(), 0.);
+      Vector4 mom4(dir.x(), dir.y(), dir.z(), 1.);
+      mom4 *= 1_GeV;
+      SimBarcode particleId =
+          SimBarcode().setVertexPrimary(1).setParticle(particle);
+      simHits.insert(SimHit(surface->geometryId(), particleId, pos4, mom4,
+                            mom4, 0));
+    }
+  }
+  return simHits;
+}
+
+const auto simHits = makeSimHits(20);
+
+/// Pixel digitization of all modules, with random charge and time smearing
+/// if requested.
+DigitizationConfig makeConfig(bool smeared, bool parallelModules) {
+  DigiComponentsConfig digiCfg;
+  GeometricConfig& geoCfg = digiCfg.geometricDigiConfig;
+  geoCfg.indices = {eBoundLoc0, eBoundLoc1};
+  geoCfg.segmentation += BinningData(BinningOption::open, BinningValue::binX,
+                                     10000, -500_mm, 500_mm);
+  geoCfg.segmentation += BinningData(BinningOption::open, BinningValue::binY,
+                                     10000, -500_mm, 500_mm);
+  geoCfg.thickness = 0.15_mm;
+  if (smeared) {
+    geoCfg.chargeSmearer = Digitization::Gauss(1_um);
+    digiCfg.smearingDigiConfig = {{eBoundTime, Digitization::Gauss(1_ns)}};
+  } else {
+    geoCfg.digital = true;
+  }
+
+  // The global default entry applies to all modules
+  DigitizationConfig cfg(GeometryHierarchyMap<DigiComponentsConfig>{
+      {GeometryIdentifier(), digiCfg}});
+  cfg.trackingGeometry = geometry;
+  cfg.randomNumbers = std::make_shared<RandomNumbers>(RandomNumbers::Config{});
+  cfg.parallelModules = parallelModules;
+  return cfg;
+}
+
+DigitizationOutput digitize(const DigitizationConfig& cfg, int nThreads) {
+  WhiteBoard board;
+  AlgorithmContext ctx(0, 42, board);
+  addToWhiteBoard(cfg.inputSimHits, simHits, board);
+
+  DigitizationAlgorithm algorithm(cfg, Logging::WARNING);
+  tbbWrap::task_arena arena(nThreads);
+  ProcessCode code = ProcessCode::ABORT;
+  arena.execute([&]() { code = algorithm.execute(ctx); });
+  BOOST_REQUIRE(code == ProcessCode::SUCCESS);
+
+  DigitizationOutput output;
+  output.measurements =
+      getFromWhiteBoard<MeasurementContainer>(cfg.outputMeasurements, board);
+  output.clusters =
+      getFromWhiteBoard<ClusterContainer>(cfg.outputClusters, board);
+  output.measurementParticlesMap =
+      getFromWhiteBoard<IndexMultimap<SimBarcode>>(
+          cfg.outputMeasurementParticlesMap, board);
+  output.measurementSimHitsMap = getFromWhiteBoard<IndexMultimap<Index>>(
+      cfg.outputMeasurementSimHitsMap, board);
+  return output;
+}
+
+void checkSameStructure(const DigitizationOutput& a,
+                        const DigitizationOutput& b) {
+  BOOST_REQUIRE_EQUAL(a.measurements.size(), b.measurements.size());
+  BOOST_REQUIRE_EQUAL(a.clusters.size(), b.clusters.size());
+  BOOST_CHECK(a.measurementParticlesMap == b.measurementParticlesMap);
+  BOOST_CHECK(a.measurementSimHitsMap == b.measurementSimHitsMap);
+}
+
+void checkIdentical(const DigitizationOutput& a, const DigitizationOutput& b) {
+  checkSameStructure(a, b);
+
+  for (std::size_t i = 0; i < a.measurements.size(); ++i) {
+    BOOST_REQUIRE_EQUAL(a.measurements[i].index(), b.measurements[i].index());
+    std::visit(
+        [&](const auto& ma) {
+          using measurement_t = std::decay_t<decltype(ma)>;
+          const auto& mb = std::get<measurement_t>(b.measurements[i]);
+          const auto& slA = ma.sourceLink().template get<IndexSourceLink>();
+          const auto& slB = mb.sourceLink().template get<IndexSourceLink>();
+          BOOST_CHECK_EQUAL(slA.geometryId(), slB.geometryId());
+          BOOST_CHECK_EQUAL(slA.index(), slB.index());
+          BOOST_CHECK(ma.indices() == mb.indices());
+          BOOST_CHECK(ma.parameters() == mb.parameters());
+          BOOST_CHECK(ma.covariance() == mb.covariance());
+        },
+        a.measurements[i]);
+  }
+
+  for (std::size_t i = 0; i < a.clusters.size(); ++i) {
+    const Cluster& ca = a.clusters[i];
+    const Cluster& cb = b.clusters[i];
+    BOOST_CHECK_EQUAL(ca.sizeLoc0, cb.sizeLoc0);
+    BOOST_CHECK_EQUAL(ca.sizeLoc1, cb.sizeLoc1);
+    BOOST_REQUIRE_EQUAL(ca.channels.size(), cb.channels.size());
+    for (std::size_t ic = 0; ic < ca.channels.size(); ++ic) {
+      BOOST_CHECK(ca.channels[ic].bin == cb.channels[ic].bin);
+      BOOST_CHECK(ca.channels[ic].path2D == cb.channels[ic].path2D);
+      BOOST_CHECK_EQUAL(ca.channels[ic].activation,
+                        cb.channels[ic].activation);
+    }
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(DigitizationAlgorithmTests)
+
+BOOST_AUTO_TEST_CASE(ParallelModulesMatchSequential) {
+  // The sequential mode draws from a single random number stream for the
+  // whole event, so bitwise agreement is only expected if the digitization
+  // does not consume random numbers.
+  auto sequential = digitize(makeConfig(false, false), 1);
+  auto parallel = digitize(makeConfig(false, true), 4);
+
+  BOOST_CHECK_EQUAL(sequential.measurements.size(), simHits.size());
+  checkIdentical(sequential, parallel);
+}
+
+BOOST_AUTO_TEST_CASE(ParallelModulesIndependentOfThreads) {
+  auto sequential = digitize(makeConfig(true, false), 1);
+  auto singleThread = digitize(makeConfig(true, true), 1);
+  auto multiThread = digitize(makeConfig(true, true), 4);
+  auto multiThreadAgain = digitize(makeConfig(true, true), 4);
+
+  // Per-module random number streams only change the smeared values
+  checkSameStructure(sequential, singleThread);
+  checkIdentical(singleThread, multiThread);
+  checkIdentical(multiThread, multiThreadAgain);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,195 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2023 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Plugins/Json/IVolumeMaterialJsonDecorator.hpp"
+#include "Acts/Plugins/Json/JsonMaterialDecorator.hpp"
+#include "Acts/Plugins/Json/MaterialMapJsonConverter.hpp"
+#include "Acts/Plugins/Json/MaterialMapJsonReader.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Tests/CommonHelpers/DataDirectory.hpp"
+#include "Acts/Tests/CommonHelpers/ThreadExecutor.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+namespace {
+
+using Acts::GeometryIdentifier;
+using Acts::MaterialMapJsonReader;
+using Acts::Test::threadExecutor;
+
+class DummyDecorator : public Acts::IVolumeMaterialJsonDecorator {
+ public:
+  void decorate(const Acts::ISurfaceMaterial& /*material*/,
+                nlohmann::json& /*json*/) const override {}
+
+  void decorate(const Acts::IVolumeMaterial& /*material*/,
+                nlohmann::json& /*json*/) const override {}
+};
+
+nlohmann::json referenceJson() {
+  std::ifstream refFile(Acts::Test::getDataPath("material-map.json"));
+  nlohmann::json refJson;
+  refFile >> refJson;
+  return refJson;
+}
+
+nlohmann::json toJson(const MaterialMapJsonReader::DetectorMaterialMaps& maps) {
+  DummyDecorator decorator;
+  Acts::MaterialMapJsonConverter converter({}, Acts::Logging::INFO);
+  return converter.materialMapsToJson(maps, &decorator);
+}
+
+std::string encode(const nlohmann::json& document,
+                   MaterialMapJsonReader::Encoding encoding) {
+  std::vector<std::uint8_t> bytes;
+  switch (encoding) {
+    case MaterialMapJsonReader::Encoding::Cbor:
+      bytes = nlohmann::json::to_cbor(document);
+      break;
+    case MaterialMapJsonReader::Encoding::MessagePack:
+      bytes = nlohmann::json::to_msgpack(document);
+      break;
+    default:
+      return document.dump();
+  }
+  return std::string(bytes.begin(), bytes.end());
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(MaterialMapJsonReader)
+
+BOOST_AUTO_TEST_CASE(AllEncodings) {
+  nlohmann::json refJson = referenceJson();
+
+  for (auto encoding : {Acts::MaterialMapJsonReader::Encoding::Json,
+                        Acts::MaterialMapJsonReader::Encoding::Cbor,
+                        Acts::MaterialMapJsonReader::Encoding::MessagePack}) {
+    for (std::size_t nChunks : {0u, 3u}) {
+      Acts::MaterialMapJsonReader::Config cfg;
+      if (nChunks > 0) {
+        cfg.executor = threadExecutor(nChunks);
+      }
+      std::istringstream input(encode(refJson, encoding));
+      Acts::MaterialMapJsonReader reader(cfg, input, encoding,
+                                         Acts::Logging::INFO);
+      // the decoded maps are identical to the ones of the converter
+      BOOST_CHECK_EQUAL(toJson(reader.materialMaps()), refJson);
+      BOOST_CHECK_EQUAL(reader.decodedVolumes(), 4u);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(LazyDecoding) {
+  std::istringstream input(referenceJson().dump());
+  Acts::MaterialMapJsonReader reader(
+      {}, input, Acts::MaterialMapJsonReader::Encoding::Json,
+      Acts::Logging::INFO);
+  BOOST_CHECK_EQUAL(reader.decodedVolumes(), 0u);
+
+  auto approach = GeometryIdentifier().setVolume(13).setLayer(2).setApproach(2);
+  BOOST_CHECK(reader.surfaceMaterial(approach) != nullptr);
+  BOOST_CHECK_EQUAL(reader.decodedVolumes(), 1u);
+  // the other surface of the volume is already decoded
+  BOOST_CHECK(reader.surfaceMaterial(approach.setLayer(4)) != nullptr);
+  BOOST_CHECK(reader.surfaceMaterial(approach.setLayer(6)) == nullptr);
+  BOOST_CHECK_EQUAL(reader.decodedVolumes(), 1u);
+  // unknown volumes are not decoded
+  BOOST_CHECK(reader.surfaceMaterial(GeometryIdentifier().setVolume(1)) ==
+              nullptr);
+  BOOST_CHECK_EQUAL(reader.decodedVolumes(), 1u);
+
+  BOOST_CHECK(reader.volumeMaterial(GeometryIdentifier().setVolume(2)) !=
+              nullptr);
+  BOOST_CHECK_EQUAL(reader.decodedVolumes(), 2u);
+
+  // the remaining volumes are decoded with the full maps
+  BOOST_CHECK_EQUAL(toJson(reader.materialMaps()), referenceJson());
+  BOOST_CHECK_EQUAL(reader.decodedVolumes(), 4u);
+}
+
+BOOST_AUTO_TEST_CASE(Decorator) {
+  std::string fileName =
+      (std::filesystem::temp_directory_path() / "MaterialMapJsonReader.cbor")
+          .string();
+  {
+    std::ofstream out(fileName, std::ios::binary);
+    out << encode(referenceJson(),
+                  Acts::MaterialMapJsonReader::Encoding::Cbor);
+  }
+  Acts::MaterialMapJsonReader::Config cfg;
+  Acts::JsonMaterialDecorator eager(cfg, fileName, Acts::Logging::INFO, false);
+  Acts::JsonMaterialDecorator lazy(cfg, fileName, Acts::Logging::INFO, true);
+  std::filesystem::remove(fileName);
+
+  auto surface = Acts::Surface::makeShared<Acts::PlaneSurface>(
+      Acts::Vector3::Zero(), Acts::Vector3::UnitZ());
+  surface->assignGeometryId(GeometryIdentifier().setVolume(14).setBoundary(1));
+  eager.decorate(*surface);
+  BOOST_REQUIRE(surface->surfaceMaterial() != nullptr);
+  auto eagerSlab = surface->surfaceMaterial()->materialSlab(0, 0);
+  lazy.decorate(*surface);
+  BOOST_REQUIRE(surface->surfaceMaterial() != nullptr);
+  BOOST_CHECK(surface->surfaceMaterial()->materialSlab(0, 0) == eagerSlab);
+
+  surface->assignGeometryId(GeometryIdentifier().setVolume(14).setBoundary(2));
+  lazy.decorate(*surface);
+  BOOST_CHECK(surface->surfaceMaterial() == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(Errors) {
+  auto read = [](const std::string& document) {
+    std::istringstream input(document);
+    Acts::MaterialMapJsonReader reader(
+        {}, input, Acts::MaterialMapJsonReader::Encoding::Json,
+        Acts::Logging::INFO);
+  };
+
+  nlohmann::json refJson = referenceJson();
+  std::string valid = refJson.dump();
+  BOOST_CHECK_NO_THROW(read(valid));
+
+  // truncated document
+  BOOST_CHECK_THROW(read(valid.substr(0, valid.size() / 2)),
+                    std::runtime_error);
+
+  // missing section
+  nlohmann::json noVolumes = refJson;
+  noVolumes.erase("Volumes");
+  BOOST_CHECK_THROW(read(noVolumes.dump()), std::invalid_argument);
+
+  // wrong header
+  nlohmann::json wrongHeader = refJson;
+  wrongHeader["Surfaces"]["acts-geometry-hierarchy-map"]["value-identifier"] =
+      "Material Volume Map";
+  BOOST_CHECK_THROW(read(wrongHeader.dump()), std::invalid_argument);
+
+  // duplicated entry
+  nlohmann::json duplicate = refJson;
+  duplicate["Surfaces"]["entries"].push_back(
+      duplicate["Surfaces"]["entries"][0]);
+  BOOST_CHECK_THROW(read(duplicate.dump()), std::invalid_argument);
+
+  BOOST_CHECK_THROW(Acts::MaterialMapJsonReader({}, "does_not_exist.json",
+                                                Acts::Logging::INFO),
+                    std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()